@@ -178,6 +178,8 @@ bool AppsContainer::processEvent(Ion::Events::Event event) {
        * pictogram. */
       updateBatteryState();
       switchToBuiltinApp(usbConnectedAppSnapshot());
+      // The host reads the records from the start of the storage
+      Ion::Storage::FileSystem::sharedFileSystem->packRecords();
       Ion::USB::DFU();
       // Update LED when exiting DFU mode
       Ion::LED::updateColorWithPlugAndCharge();
@@ -148,11 +148,21 @@ ExpiringPointer<Calculation> CalculationStore::push(
       // Parse and compute the expression
       inputExpression = Expression::Parse(inputText, context, false);
       assert(!inputExpression.isUninitialized());
-      PoincareHelpers::CloneAndSimplifyAndApproximate(
-          inputExpression, &exactOutputExpression, &approximateOutputExpression,
-          context,
-          {.symbolicComputation = SymbolicComputation::
-               ReplaceAllSymbolsWithDefinitionsOrUndefined});
+      if (ExpressionDisplayPermissions::ReductionOfInputCanBeSkipped(
+              inputExpression, context)) {
+        /* Only the approximation is displayed, the reduction would only be
+         * used to compute it. The exact output is undefined so that Ans is
+         * the input, as with any other hidden exact output. */
+        exactOutputExpression = Undefined::Builder();
+        approximateOutputExpression =
+            PoincareHelpers::Approximate<double>(inputExpression, context);
+      } else {
+        PoincareHelpers::CloneAndSimplifyAndApproximate(
+            inputExpression, &exactOutputExpression,
+            &approximateOutputExpression, context,
+            {.symbolicComputation = SymbolicComputation::
+                 ReplaceAllSymbolsWithDefinitionsOrUndefined});
+      }
       assert(!exactOutputExpression.isUninitialized() &&
              !approximateOutputExpression.isUninitialized());
 
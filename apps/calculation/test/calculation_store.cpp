@@ -3,6 +3,7 @@
 #include <apps/calculation/additional_results/additional_results_type.h>
 #include <apps/shared/expression_display_permissions.h>
 #include <apps/shared/global_context.h>
+#include <apps/shared/poincare_helpers.h>
 #include <assert.h>
 #include <poincare/preferences.h>
 #include <poincare/test/helper.h>
@@ -880,3 +881,69 @@ QUIZ_CASE(calculation_additional_results) {
                                            &globalContext, &store);
   assertCalculationAdditionalResultTypeHas("-10", {}, &globalContext, &store);
 }
+
+static Expression approximateOutput(const char *input, bool skipReduction,
+                                    Context *context) {
+  // Follow the steps of CalculationStore::push
+  Expression e = Expression::Parse(input, context);
+  if (skipReduction &&
+      Shared::ExpressionDisplayPermissions::ReductionOfInputCanBeSkipped(
+          e, context)) {
+    return Shared::PoincareHelpers::Approximate<double>(e, context);
+  }
+  Expression exact, approximate;
+  Shared::PoincareHelpers::CloneAndSimplifyAndApproximate(
+      e, &exact, &approximate, context,
+      {.symbolicComputation =
+           SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined});
+  return approximate;
+}
+
+QUIZ_CASE(calculation_skipped_reduction) {
+  Shared::GlobalContext globalContext;
+  CalculationStore store(calculationBuffer, calculationBufferSize);
+
+  // The exact output of these inputs could be displayed, or needs a reduction
+  const char *reducedInputs[] = {
+      "1.5+2",         "√(2)/2",       "1/3+1/6",
+      "diff(x^3,x,2)", "int(x,x,0,a)", "sum(k,k,1,3)→a",
+      "random()×_m",   "{1,2}+random()"};
+  for (const char *input : reducedInputs) {
+    quiz_assert_print_if_failure(
+        !Shared::ExpressionDisplayPermissions::ReductionOfInputCanBeSkipped(
+            Expression::Parse(input, &globalContext), &globalContext),
+        input);
+  }
+
+  // Only the approximation of these inputs is displayed
+  const char *approximatedInputs[] = {
+      "int(x^2,x,0,1)",        "int(e^(-x^2),x,-3,3)",
+      "int(1/(1+x^2),x,0,1)",  "sum(1/k^2,k,1,100)",
+      "product(1+1/k,k,1,50)", "normcdf(1.96,0,1)",
+      "binompdf(3,10,0.5)",    "invnorm(0.975,0,1)",
+      "round(π,3)",            "frac(7/3)"};
+  constexpr int k_bufferSize = ::Constant::MaxSerializedExpressionSize;
+  char buffer[k_bufferSize];
+  for (const char *input : approximatedInputs) {
+    quiz_assert_print_if_failure(
+        Shared::ExpressionDisplayPermissions::ReductionOfInputCanBeSkipped(
+            Expression::Parse(input, &globalContext), &globalContext),
+        input);
+    store.push(input, &globalContext);
+    Shared::ExpiringPointer<::Calculation::Calculation> lastCalculation =
+        store.calculationAtIndex(0);
+    quiz_assert_print_if_failure(
+        lastCalculation->displayOutput(&globalContext) ==
+            DisplayOutput::ApproximateOnly,
+        input);
+    // The approximation is the one of the reduced input
+    Shared::PoincareHelpers::Serialize(
+        approximateOutput(input, false, &globalContext), buffer, k_bufferSize);
+    quiz_assert_print_if_failure(
+        strcmp(lastCalculation->approximateOutputText(
+                   NumberOfSignificantDigits::Maximal),
+               buffer) == 0,
+        input);
+    store.deleteAll();
+  }
+}
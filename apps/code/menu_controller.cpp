@@ -153,11 +153,13 @@ void MenuController::reloadConsole() {
   m_reloadConsoleWhenBecomingFirstResponder = false;
 }
 
-void MenuController::openConsoleWithScript(Script script) {
+void MenuController::openConsoleWithScript(Script script, bool profile) {
   reloadConsole();
   consoleController()->setAutoImport(false);
   stackViewController()->push(consoleController());
+  consoleController()->setProfiling(profile);
   consoleController()->autoImportScript(script, true);
+  consoleController()->setProfiling(false);
   m_reloadConsoleWhenBecomingFirstResponder = true;
 }
 
@@ -31,7 +31,7 @@ class MenuController : public Escher::ViewController,
   void renameSelectedScript();
   void deleteScript(Script script);
   void reloadConsole();
-  void openConsoleWithScript(Script script);
+  void openConsoleWithScript(Script script, bool profile = false);
   void scriptContentEditionDidFinish();
   void willExitApp();
   int editedScriptIndex() const { return m_editorController.scriptIndex(); }
@@ -17,6 +17,7 @@ ScriptParameterController::ScriptParameterController(
   m_executeScript.label()->setMessage(I18n::Message::ExecuteScript);
   m_renameScript.label()->setMessage(I18n::Message::Rename);
   m_deleteScript.label()->setMessage(I18n::Message::DeleteScript);
+  m_profileScript.label()->setMessage(I18n::Message::ProfileScript);
   m_autoImportScript.label()->setMessage(I18n::Message::AutoImportScript);
   m_autoImportScript.subLabel()->setMessage(
       I18n::Message::AutoImportScriptSubLabel);
@@ -45,6 +46,9 @@ bool ScriptParameterController::handleEvent(Ion::Events::Event event) {
   } else if (cell == &m_renameScript) {
     dismissScriptParameterController();
     m_menuController->renameSelectedScript();
+  } else if (cell == &m_profileScript) {
+    dismissScriptParameterController();
+    m_menuController->openConsoleWithScript(s, true);
   } else if (cell == &m_autoImportScript) {
     m_script.toggleAutoImportation();
     updateAutoImportSwitch();
@@ -76,7 +80,8 @@ AbstractMenuCell *ScriptParameterController::cell(int row) {
   assert(row >= 0);
   assert(row < k_totalNumberOfCell);
   AbstractMenuCell *cells[k_totalNumberOfCell] = {
-      &m_executeScript, &m_renameScript, &m_autoImportScript, &m_deleteScript};
+      &m_executeScript, &m_renameScript, &m_autoImportScript, &m_deleteScript,
+      &m_profileScript};
   return cells[row];
 }
 
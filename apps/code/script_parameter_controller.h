@@ -36,7 +36,7 @@ class ScriptParameterController
   int numberOfRows() const override { return k_totalNumberOfCell; }
 
  private:
-  constexpr static int k_totalNumberOfCell = 4;
+  constexpr static int k_totalNumberOfCell = 5;
   Escher::StackViewController* stackViewController();
   void updateAutoImportSwitch();
 
@@ -47,6 +47,7 @@ class ScriptParameterController
                    Escher::SwitchView>
       m_autoImportScript;
   Escher::MenuCell<Escher::MessageTextView> m_deleteScript;
+  Escher::MenuCell<Escher::MessageTextView> m_profileScript;
   Script m_script;
   MenuController* m_menuController;
 };
@@ -0,0 +1,143 @@
+#include "amortization.h"
+
+#include <poincare/preferences.h>
+#include <poincare/print.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Poincare;
+
+namespace Finance {
+
+Amortization::Amortization(double N, double i, double PV, double Pmt,
+                           bool paymentAtBeginning)
+    : m_i(i), m_Pmt(Pmt), m_numberOfPeriods(0) {
+  if (i == 0.0) {
+    m_base = PV;
+    m_offset = Pmt;
+  } else {
+    m_offset = Pmt * (1.0 + (paymentAtBeginning ? i : 0.0)) / i;
+    m_base = PV + m_offset;
+  }
+  if (std::isfinite(N) && N >= 1.0 && i > -1.0 && std::isfinite(m_base) &&
+      std::isfinite(m_offset)) {
+    m_numberOfPeriods = static_cast<int>(
+        std::min<double>(std::floor(N), k_maxNumberOfPeriods));
+  }
+}
+
+double Amortization::growthAtPeriod(int k) const {
+  return std::pow(1.0 + m_i, k);
+}
+
+double Amortization::balanceAtPeriod(int k) const {
+  assert(0 <= k && k <= m_numberOfPeriods);
+  if (m_i == 0.0) {
+    return m_base + k * m_offset;
+  }
+  return m_base * growthAtPeriod(k) - m_offset;
+}
+
+double Amortization::principalAtPeriod(int k) const {
+  assert(1 <= k && k <= m_numberOfPeriods);
+  if (m_i == 0.0) {
+    return -m_offset;
+  }
+  return -m_base * m_i * growthAtPeriod(k - 1);
+}
+
+double Amortization::interestAtPeriod(int k) const {
+  return -(m_Pmt + principalAtPeriod(k));
+}
+
+double Amortization::valueAtPeriod(Column column, int k) const {
+  switch (column) {
+    case Column::Period:
+      return k;
+    case Column::Interest:
+      return interestAtPeriod(k);
+    case Column::Principal:
+      return principalAtPeriod(k);
+    default:
+      assert(column == Column::Balance);
+      return balanceAtPeriod(k);
+  }
+}
+
+void Amortization::computeRows(int firstPeriod, int numberOfRows,
+                               double* interests, double* principals,
+                               double* balances) const {
+  assert(firstPeriod >= 1 && numberOfRows >= 0 &&
+         firstPeriod + numberOfRows - 1 <= m_numberOfPeriods);
+  if (m_i == 0.0) {
+    for (int j = 0; j < numberOfRows; j++) {
+      principals[j] = -m_offset;
+      interests[j] = 0.0;
+      balances[j] = m_base + (firstPeriod + j) * m_offset;
+    }
+    return;
+  }
+  /* Growth factors are the only sequential dependency. They are seeded with
+   * an exact power so that rounding errors do not accumulate from period 0.
+   * The remaining loops are element-wise and can be vectorized. */
+  const double factor = 1.0 + m_i;
+  double growth = growthAtPeriod(firstPeriod - 1);
+  for (int j = 0; j < numberOfRows; j++) {
+    principals[j] = growth;
+    growth *= factor;
+  }
+  const double principalScale = -m_base * m_i;
+  for (int j = 0; j < numberOfRows; j++) {
+    balances[j] = m_base * (principals[j] * factor) - m_offset;
+    principals[j] *= principalScale;
+    interests[j] = -(m_Pmt + principals[j]);
+  }
+}
+
+int Amortization::serializeColumnAsList(Column column, char* buffer,
+                                        int bufferSize,
+                                        int numberOfSignificantDigits) const {
+  assert(isDefined());
+  constexpr Preferences::PrintFloatMode mode =
+      Preferences::PrintFloatMode::Decimal;
+  const int p = numberOfSignificantDigits;
+  // Coefficient of (1+i)^(k-1) in Principal(k)
+  const double scale = -m_base * m_i;
+  int length = Print::CustomPrintf(buffer, bufferSize, "sequence(");
+  char* term = buffer + length;
+  size_t termSize = bufferSize - length;
+  if (column == Column::Period) {
+    length += Print::CustomPrintf(term, termSize, "k");
+  } else if (m_i == 0.0) {
+    if (column == Column::Interest) {
+      length += Print::CustomPrintf(term, termSize, "0");
+    } else if (column == Column::Principal) {
+      length += Print::CustomPrintf(term, termSize, "-(%*.*ed)", m_offset,
+                                    mode, p);
+    } else {
+      assert(column == Column::Balance);
+      length += Print::CustomPrintf(term, termSize, "(%*.*ed)+(%*.*ed)×k",
+                                    m_base, mode, p, m_offset, mode, p);
+    }
+  } else if (column == Column::Interest) {
+    length += Print::CustomPrintf(
+        term, termSize, "-(%*.*ed)×(1+(%*.*ed))^(k-1)-(%*.*ed)", scale, mode,
+        p, m_i, mode, p, m_Pmt, mode, p);
+  } else if (column == Column::Principal) {
+    length += Print::CustomPrintf(term, termSize,
+                                  "(%*.*ed)×(1+(%*.*ed))^(k-1)", scale, mode,
+                                  p, m_i, mode, p);
+  } else {
+    assert(column == Column::Balance);
+    length += Print::CustomPrintf(term, termSize,
+                                  "(%*.*ed)×(1+(%*.*ed))^k-(%*.*ed)", m_base,
+                                  mode, p, m_i, mode, p, m_offset, mode, p);
+  }
+  length += Print::CustomPrintf(buffer + length, bufferSize - length, ",k,%i)",
+                                m_numberOfPeriods);
+  assert(length < bufferSize);
+  return length;
+}
+
+}  // namespace Finance
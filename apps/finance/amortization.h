@@ -0,0 +1,71 @@
+#ifndef FINANCE_AMORTIZATION_H
+#define FINANCE_AMORTIZATION_H
+
+#include <assert.h>
+#include <stdint.h>
+
+namespace Finance {
+
+/* Amortization schedule of a compound interest cash flow.
+ * With i the interest rate per payment period and S = 1 if payments are made
+ * at the beginning of each period (0 otherwise), the balance after k periods
+ * has the closed form :
+ *   B(k) = PV*(1+i)^k + Pmt*(1+i*S)*((1+i)^k-1)/i
+ *        = (PV + c)*(1+i)^k - c  with c = Pmt*(1+i*S)/i
+ * so that B(0) = PV and B(N) = -FV. Each payment then splits into :
+ *   Principal(k) = B(k-1) - B(k) = -(PV + c)*i*(1+i)^(k-1)
+ *   Interest(k) = -(Pmt + Principal(k))
+ * If i is 0, B(k) = PV + k*Pmt, Principal(k) = -Pmt and Interest(k) = 0.
+ * Since every row only depends on (1+i)^k, a range of rows is computed in a
+ * single pass, without iterating on previous balances. */
+
+class Amortization {
+ public:
+  enum class Column : uint8_t {
+    Period = 0,
+    Interest,
+    Principal,
+    Balance,
+    NumberOfColumns
+  };
+  constexpr static int k_numberOfColumns =
+      static_cast<int>(Column::NumberOfColumns);
+  // Beyond that, the schedule is neither readable nor exportable as a list
+  constexpr static int k_maxNumberOfPeriods = 9999;
+
+  Amortization() : Amortization(0.0, 0.0, 0.0, 0.0, false) {}
+  Amortization(double N, double i, double PV, double Pmt,
+               bool paymentAtBeginning);
+
+  bool isDefined() const { return m_numberOfPeriods > 0; }
+  int numberOfPeriods() const { return m_numberOfPeriods; }
+
+  double balanceAtPeriod(int k) const;
+  double principalAtPeriod(int k) const;
+  double interestAtPeriod(int k) const;
+  double valueAtPeriod(Column column, int k) const;
+
+  /* Fill the interest, principal and balance of periods
+   * [firstPeriod, firstPeriod + numberOfRows[ in the given buffers. */
+  void computeRows(int firstPeriod, int numberOfRows, double* interests,
+                   double* principals, double* balances) const;
+
+  /* Serialize an expression of the column as a list of all periods, using
+   * sequence(f(k),k,N). Return the number of written chars. */
+  int serializeColumnAsList(Column column, char* buffer, int bufferSize,
+                            int numberOfSignificantDigits) const;
+
+ private:
+  double growthAtPeriod(int k) const;
+  /* (PV + c) and c from the closed form above. When m_i is 0, they instead
+   * are PV and Pmt. */
+  double m_base;
+  double m_offset;
+  double m_i;
+  double m_Pmt;
+  int m_numberOfPeriods;
+};
+
+}  // namespace Finance
+
+#endif
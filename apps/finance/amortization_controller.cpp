@@ -0,0 +1,147 @@
+#include "amortization_controller.h"
+
+#include <apps/i18n.h>
+#include <apps/shared/poincare_helpers.h>
+#include <poincare/print.h>
+
+#include <algorithm>
+
+#include "app.h"
+
+using namespace Escher;
+
+namespace Finance {
+
+AmortizationController::AmortizationController(
+    StackViewController* parentResponder)
+    : ViewController(parentResponder),
+      m_selectableTableView(this, this, this),
+      m_memoizedFirstPeriod(1),
+      m_numberOfMemoizedRows(0) {
+  m_selectableTableView.setVerticalCellOverlap(0);
+  m_selectableTableView.setBackgroundColor(Palette::WallScreenDark);
+}
+
+const char* AmortizationController::title() {
+  return I18n::translate(I18n::Message::AmortizationTable);
+}
+
+void AmortizationController::viewWillAppear() {
+  m_amortization = App::app()->snapshot()->data()->amortization();
+  m_numberOfMemoizedRows = 0;
+  constexpr I18n::Message k_titles[Amortization::k_numberOfColumns] = {
+      I18n::Message::FinancePeriod, I18n::Message::FinanceInt,
+      I18n::Message::FinancePrn, I18n::Message::FinanceBal};
+  for (int column = 0; column < Amortization::k_numberOfColumns; column++) {
+    m_titleCells[column].setMessage(k_titles[column]);
+    m_amortization.serializeColumnAsList(
+        static_cast<Amortization::Column>(column),
+        m_titleCells[column].listText(), ColumnTitleCell::k_listTextSize,
+        Poincare::Preferences::LargeNumberOfSignificantDigits);
+  }
+  selectCellAtLocation(0, 1);
+  m_selectableTableView.reloadData(false);
+  ViewController::viewWillAppear();
+}
+
+void AmortizationController::didBecomeFirstResponder() {
+  App::app()->setFirstResponder(&m_selectableTableView);
+}
+
+bool AmortizationController::handleEvent(Ion::Events::Event event) {
+  return popFromStackViewControllerOnLeftEvent(event);
+}
+
+void AmortizationController::fillCellForLocation(HighlightCell* cell,
+                                                 int column, int row) {
+  static_cast<EvenOddCell*>(cell)->setEven(row % 2 == 0);
+  int type = typeAtLocation(column, row);
+  if (type == k_titleCellType) {
+    // Title cells are filled in viewWillAppear
+    return;
+  }
+  // Periods are 1-indexed and start right after the title row
+  int period = row;
+  constexpr int bufferSize =
+      Poincare::PrintFloat::charSizeForFloatsWithPrecision(
+          AbstractEvenOddBufferTextCell::k_defaultPrecision);
+  char buffer[bufferSize];
+  if (type == k_periodCellType) {
+    Poincare::Print::CustomPrintf(buffer, bufferSize, "%i", period);
+    static_cast<SmallFontEvenOddBufferTextCell*>(cell)->setText(buffer);
+    return;
+  }
+  assert(type == k_valueCellType);
+  Shared::PoincareHelpers::ConvertFloatToText<double>(
+      valueAtLocation(column, period), buffer, bufferSize,
+      AbstractEvenOddBufferTextCell::k_defaultPrecision);
+  static_cast<FloatEvenOddBufferTextCell<>*>(cell)->setText(buffer);
+}
+
+HighlightCell* AmortizationController::reusableCell(int index, int type) {
+  assert(index >= 0 && index < reusableCellCount(type));
+  switch (type) {
+    case k_titleCellType:
+      return m_titleCells + index;
+    case k_periodCellType:
+      return m_periodCells + index;
+    default:
+      assert(type == k_valueCellType);
+      return m_valueCells + index;
+  }
+}
+
+int AmortizationController::reusableCellCount(int type) {
+  switch (type) {
+    case k_titleCellType:
+      return Amortization::k_numberOfColumns;
+    case k_periodCellType:
+      return k_maxNumberOfDisplayableRows;
+    default:
+      assert(type == k_valueCellType);
+      return k_numberOfValueCells;
+  }
+}
+
+int AmortizationController::typeAtLocation(int column, int row) {
+  if (row == 0) {
+    return k_titleCellType;
+  }
+  return column == static_cast<int>(Amortization::Column::Period)
+             ? k_periodCellType
+             : k_valueCellType;
+}
+
+double AmortizationController::valueAtLocation(int column, int period) {
+  assert(period >= 1 && period <= m_amortization.numberOfPeriods());
+  if (period < m_memoizedFirstPeriod ||
+      period >= m_memoizedFirstPeriod + m_numberOfMemoizedRows) {
+    computeMemoizedRowsAround(period);
+  }
+  int index = period - m_memoizedFirstPeriod;
+  switch (static_cast<Amortization::Column>(column)) {
+    case Amortization::Column::Interest:
+      return m_memoizedInterests[index];
+    case Amortization::Column::Principal:
+      return m_memoizedPrincipals[index];
+    default:
+      assert(column == static_cast<int>(Amortization::Column::Balance));
+      return m_memoizedBalances[index];
+  }
+}
+
+void AmortizationController::computeMemoizedRowsAround(int period) {
+  int numberOfPeriods = m_amortization.numberOfPeriods();
+  m_numberOfMemoizedRows =
+      std::min(k_maxNumberOfDisplayableRows, numberOfPeriods);
+  /* Center the memoized rows on the requested period so that scrolling in
+   * both directions keeps hitting them. */
+  m_memoizedFirstPeriod =
+      std::clamp(period - m_numberOfMemoizedRows / 2, 1,
+                 numberOfPeriods - m_numberOfMemoizedRows + 1);
+  m_amortization.computeRows(m_memoizedFirstPeriod, m_numberOfMemoizedRows,
+                             m_memoizedInterests, m_memoizedPrincipals,
+                             m_memoizedBalances);
+}
+
+}  // namespace Finance
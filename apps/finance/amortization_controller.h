@@ -0,0 +1,113 @@
+#ifndef FINANCE_AMORTIZATION_CONTROLLER_H
+#define FINANCE_AMORTIZATION_CONTROLLER_H
+
+#include <escher/even_odd_buffer_text_cell.h>
+#include <escher/even_odd_message_text_cell.h>
+#include <escher/regular_table_view_data_source.h>
+#include <escher/selectable_table_view.h>
+#include <escher/selectable_table_view_data_source.h>
+#include <escher/stack_view_controller.h>
+#include <escher/text_field.h>
+#include <poincare/print_float.h>
+
+#include "amortization.h"
+
+namespace Finance {
+
+/* Table of the amortization schedule, with a row per payment period.
+ * Storing or copying a column title exports the whole column as a list. */
+
+class AmortizationController : public Escher::ViewController,
+                               public Escher::SelectableTableViewDataSource,
+                               public Escher::RegularHeightTableViewDataSource {
+ public:
+  AmortizationController(Escher::StackViewController* parentResponder);
+
+  // ViewController
+  const char* title() override;
+  Escher::View* view() override { return &m_selectableTableView; }
+  void viewWillAppear() override;
+  ViewController::TitlesDisplay titlesDisplay() override {
+    return ViewController::TitlesDisplay::DisplayLastTwoTitles;
+  }
+  TELEMETRY_ID("Amortization");
+
+  // Responder
+  void didBecomeFirstResponder() override;
+  bool handleEvent(Ion::Events::Event event) override;
+
+  // TableViewDataSource
+  int numberOfRows() const override {
+    return 1 + m_amortization.numberOfPeriods();
+  }
+  int numberOfColumns() const override {
+    return Amortization::k_numberOfColumns;
+  }
+  void fillCellForLocation(Escher::HighlightCell* cell, int column,
+                           int row) override;
+  Escher::HighlightCell* reusableCell(int index, int type) override;
+  int reusableCellCount(int type) override;
+  int typeAtLocation(int column, int row) override;
+
+ private:
+  class ColumnTitleCell : public Escher::EvenOddMessageTextCell {
+   public:
+    const char* text() const override { return m_listText; }
+    char* listText() { return m_listText; }
+    constexpr static int k_listTextSize = Escher::TextField::MaxBufferSize();
+
+   private:
+    char m_listText[k_listTextSize];
+  };
+
+  constexpr static int k_titleCellType = 0;
+  constexpr static int k_periodCellType = 1;
+  constexpr static int k_valueCellType = 2;
+
+  constexpr static KDCoordinate k_cellHeight =
+      Escher::Metric::SmallEditableCellHeight;
+  constexpr static KDCoordinate k_periodColumnWidth =
+      Escher::Metric::SmallFontCellWidth(
+          4, Escher::EvenOddCell::k_horizontalMargin);
+  constexpr static KDCoordinate k_valueColumnWidth =
+      Escher::Metric::SmallFontCellWidth(
+          Poincare::PrintFloat::glyphLengthForFloatWithPrecision(
+              Escher::AbstractEvenOddBufferTextCell::k_defaultPrecision),
+          Escher::EvenOddCell::k_horizontalMargin);
+  constexpr static int k_maxNumberOfDisplayableRows =
+      Escher::Metric::MinimalNumberOfScrollableRowsToFillDisplayHeight(
+          k_cellHeight, Escher::Metric::StackTitleHeight);
+  constexpr static int k_numberOfValueColumns =
+      Amortization::k_numberOfColumns - 1;
+  constexpr static int k_numberOfValueCells =
+      k_maxNumberOfDisplayableRows * k_numberOfValueColumns;
+
+  // TableViewDataSource
+  KDCoordinate defaultRowHeight() override { return k_cellHeight; }
+  KDCoordinate nonMemoizedColumnWidth(int column) override {
+    return column == static_cast<int>(Amortization::Column::Period)
+               ? k_periodColumnWidth
+               : k_valueColumnWidth;
+  }
+
+  double valueAtLocation(int column, int period);
+  void computeMemoizedRowsAround(int period);
+
+  Escher::SelectableTableView m_selectableTableView;
+  ColumnTitleCell m_titleCells[Amortization::k_numberOfColumns];
+  Escher::SmallFontEvenOddBufferTextCell
+      m_periodCells[k_maxNumberOfDisplayableRows];
+  Escher::FloatEvenOddBufferTextCell<> m_valueCells[k_numberOfValueCells];
+  Amortization m_amortization;
+  /* Rows of the displayed periods are computed together, and only recomputed
+   * when scrolling out of them. */
+  double m_memoizedInterests[k_maxNumberOfDisplayableRows];
+  double m_memoizedPrincipals[k_maxNumberOfDisplayableRows];
+  double m_memoizedBalances[k_maxNumberOfDisplayableRows];
+  int m_memoizedFirstPeriod;
+  int m_numberOfMemoizedRows;
+};
+
+}  // namespace Finance
+
+#endif
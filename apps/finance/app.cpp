@@ -59,7 +59,8 @@ void App::didExitPage(Escher::ViewController *controller) {
 // App
 App::App(Snapshot *snapshot)
     : Shared::MathApp(snapshot, &m_stackViewController),
-      m_resultController(&m_stackViewController),
+      m_amortizationController(&m_stackViewController),
+      m_resultController(&m_stackViewController, &m_amortizationController),
       m_parametersController(&m_stackViewController, &m_resultController),
       m_interestMenuController(&m_stackViewController, &m_parametersController),
       m_menuController(&m_stackViewController, &m_interestMenuController),
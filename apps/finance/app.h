@@ -5,6 +5,7 @@
 #include <apps/shared/math_app.h>
 #include <escher/stack_view_controller.h>
 
+#include "amortization_controller.h"
 #include "data.h"
 #include "interest_menu_controller.h"
 #include "menu_controller.h"
@@ -28,9 +29,10 @@ class App : public Shared::MathApp {
   // Snapshot
   class Snapshot : public Shared::SharedApp::Snapshot {
    public:
-    /* At most 3 nested menus from MenuController :
-     * InterestMenuController, ParametersController and ResultController */
-    constexpr static uint8_t k_maxNumberOfStacks = 3;
+    /* At most 4 nested menus from MenuController :
+     * InterestMenuController, ParametersController, ResultController and
+     * AmortizationController */
+    constexpr static uint8_t k_maxNumberOfStacks = 4;
 
     App *unpack(Escher::Container *container) override;
     const Descriptor *descriptor() const override;
@@ -69,6 +71,7 @@ class App : public Shared::MathApp {
   App(Snapshot *snapshot);
 
   // Controllers
+  AmortizationController m_amortizationController;
   ResultController m_resultController;
   ParametersController m_parametersController;
   InterestMenuController m_interestMenuController;
@@ -3,6 +3,7 @@
 #include <poincare/solver.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace Finance {
@@ -151,14 +152,68 @@ double computeN(double rPct, double PV, double Pmt, double FV, double S,
          std::log(1.0 + i);
 }
 
+/* Solve PV*(1+i)^N + Pmt*(1+i*S)*((1+i)^N-1)/i + FV = 0 for the rate i per
+ * payment period, with a Newton iteration. Return NAN if it did not converge.
+ * The iteration is seeded with the root of the first order expansion of
+ * this equation around i = 0 :
+ *   PV + FV + N*Pmt + i*(N*PV + N*(N-1+2*S)/2*Pmt) = 0 */
+double computePeriodicRateWithNewton(double N, double PV, double Pmt,
+                                     double FV, double S) {
+  constexpr int k_maxNumberOfIterations = 64;
+  constexpr double k_relativePrecision = 1e-13;
+  double i = -(PV + FV + N * Pmt) /
+             (N * PV + N * (N - 1.0 + 2.0 * S) / 2.0 * Pmt);
+  if (!std::isfinite(i) || i <= -1.0) {
+    i = 0.01;
+  }
+  for (int iteration = 0; iteration < k_maxNumberOfIterations; iteration++) {
+    double u = std::pow(1.0 + i, N);
+    double du = N * u / (1.0 + i);
+    // h = ((1+i)^N-1)/i, which is N if i is 0
+    double h, dh;
+    if (std::fabs(i) < 1e-9) {
+      h = N + N * (N - 1.0) / 2.0 * i;
+      dh = N * (N - 1.0) / 2.0;
+    } else {
+      h = (u - 1.0) / i;
+      dh = (du - h) / i;
+    }
+    double value = PV * u + Pmt * (1.0 + i * S) * h + FV;
+    double derivative = PV * du + Pmt * (S * h + (1.0 + i * S) * dh);
+    double step = value / derivative;
+    if (!std::isfinite(step)) {
+      return NAN;
+    }
+    double next = i - step;
+    if (next <= -1.0) {
+      // Stay in the domain of (1+i)^N
+      next = (i - 1.0) / 2.0;
+    }
+    if (std::fabs(next - i) <=
+        k_relativePrecision * std::max(1.0, std::fabs(i))) {
+      return next;
+    }
+    i = next;
+  }
+  return NAN;
+}
+
 double computeRPct(double N, double PV, double Pmt, double FV, double PY,
                    double CY, double S) {
   if (Pmt == 0.0) {
     // PV + FV*(1 + r/(100*CY))^(-N*CY/PY) = 0
     return 100.0 * CY * (std::pow(-FV / PV, PY / (N * CY)) - 1.0);
   }
+  // i = (1 + rPct/(100*CY))^(CY/PY) - 1
+  constexpr double k_maxRPct = 100.0;
+  double i = computePeriodicRateWithNewton(N, PV, Pmt, FV, S);
+  double rPct = 100.0 * CY * (std::pow(1.0 + i, PY / CY) - 1.0);
+  if (std::isfinite(rPct) && std::fabs(rPct) <= k_maxRPct) {
+    return rPct;
+  }
+  /* Newton did not converge, or converged to a rate out of the bounds of the
+   * generic solver, which is used instead. */
   const double parameters[7] = {N, PV, Pmt, FV, PY, CY, S};
-  // We must solve this expression. An exact solution cannot be found.
   Poincare::Solver<double>::FunctionEvaluation evaluation =
       [](double x, const void *aux) {
         const double *pack = static_cast<const double *>(aux);
@@ -174,7 +229,7 @@ double computeRPct(double N, double PV, double Pmt, double FV, double PY,
         double a = computeA(i, S, b, N);
         return PV + a * Pmt + b * FV;
       };
-  Poincare::Solver<double> solver(-100., 100.);
+  Poincare::Solver<double> solver(-k_maxRPct, k_maxRPct);
   return solver.nextRoot(evaluation, parameters).x();
 }
 
@@ -258,6 +313,17 @@ double CompoundInterestData::getValue(uint8_t param) const {
   return m_values[param - k_numberOfSharedDoubleValues];
 }
 
+Amortization CompoundInterestData::amortization() const {
+  double rPct = getValue(static_cast<uint8_t>(Parameter::rPct));
+  double CY = getValue(static_cast<uint8_t>(Parameter::CY));
+  double PY = getValue(static_cast<uint8_t>(Parameter::PY));
+  return Amortization(getValue(static_cast<uint8_t>(Parameter::N)),
+                      computeI(rPct, CY, PY),
+                      getValue(static_cast<uint8_t>(Parameter::PV)),
+                      getValue(static_cast<uint8_t>(Parameter::Pmt)),
+                      m_booleanParam);
+}
+
 void Data::reset() {
   m_selectedModel = true;
   m_compoundInterestData.resetValues();
@@ -6,6 +6,8 @@
 
 #include <new>
 
+#include "amortization.h"
+
 namespace Finance {
 
 class InterestData {
@@ -168,6 +170,8 @@ class CompoundInterestData : public InterestData {
   double computeUnknownValue() override;
   void setValue(uint8_t param, double value) override;
   double getValue(uint8_t param) const override;
+  // Schedule of the cash flow described by the current values
+  Amortization amortization() const;
 
  private:
   double m_values[k_numberOfDoubleValues - k_numberOfSharedDoubleValues];
@@ -184,6 +188,12 @@ class Data {
         m_selectedModel(true) {}
   void reset();
   void setModel(bool selectedModel) { m_selectedModel = selectedModel; }
+  // Only compound interests have an amortization schedule
+  bool hasAmortization() const { return !m_selectedModel; }
+  Amortization amortization() const {
+    assert(hasAmortization());
+    return m_compoundInterestData.amortization();
+  }
   InterestData *interestData() {
     return m_selectedModel
                ? static_cast<InterestData *>(&m_simpleInterestData)
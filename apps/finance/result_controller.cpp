@@ -11,9 +11,15 @@
 
 namespace Finance {
 
-ResultController::ResultController(Escher::StackViewController* parentResponder)
+ResultController::ResultController(
+    Escher::StackViewController* parentResponder,
+    AmortizationController* amortizationController)
     : Escher::ListWithTopAndBottomController(parentResponder, &m_messageView),
-      m_messageView(I18n::Message::CalculatedValues, k_messageFormat) {}
+      m_messageView(I18n::Message::CalculatedValues, k_messageFormat),
+      m_amortizationController(amortizationController),
+      m_hasAmortization(false) {
+  m_amortizationCell.label()->setMessage(I18n::Message::AmortizationTable);
+}
 
 void ResultController::viewWillAppear() {
   /* Build the result cell here because it only needs to be updated once this
@@ -31,12 +37,24 @@ void ResultController::viewWillAppear() {
       value, buffer, bufferSize, precision,
       Poincare::Preferences::PrintFloatMode::Decimal);
   m_cell.accessory()->setText(buffer);
-  selectRow(-1);
+  Data* data = App::app()->snapshot()->data();
+  m_hasAmortization =
+      data->hasAmortization() && data->amortization().isDefined();
+  if (m_hasAmortization) {
+    // Only the amortization cell can be selected
+    selectLastCell();
+  } else {
+    selectRow(-1);
+  }
   m_selectableListView.reloadData(false);
   ViewController::viewWillAppear();
 }
 
 bool ResultController::handleEvent(Ion::Events::Event event) {
+  if (m_hasAmortization && m_amortizationCell.canBeActivatedByEvent(event)) {
+    stackOpenPage(m_amortizationController);
+    return true;
+  }
   if (event == Ion::Events::Copy || event == Ion::Events::Cut) {
     Escher::Clipboard::SharedClipboard()->store(m_cell.text());
     return true;
@@ -2,20 +2,27 @@
 #define FINANCE_RESULT_CONTROLLER_H
 
 #include <escher/buffer_text_view.h>
+#include <escher/chevron_view.h>
 #include <escher/list_with_top_and_bottom_controller.h>
 #include <escher/menu_cell.h>
 #include <escher/message_text_view.h>
 #include <escher/stack_view_controller.h>
 
+#include "amortization_controller.h"
+
 namespace Finance {
 
 using ResultCell =
     Escher::MenuCell<Escher::MessageTextView, Escher::MessageTextView,
                      Escher::FloatBufferTextView<>>;
+using AmortizationCell =
+    Escher::MenuCell<Escher::MessageTextView, Escher::EmptyCellWidget,
+                     Escher::ChevronView>;
 
 class ResultController : public Escher::ListWithTopAndBottomController {
  public:
-  ResultController(Escher::StackViewController* parentResponder);
+  ResultController(Escher::StackViewController* parentResponder,
+                   AmortizationController* amortizationController);
 
   void viewWillAppear() override;
   void didBecomeFirstResponder() override {}
@@ -24,23 +31,38 @@ class ResultController : public Escher::ListWithTopAndBottomController {
   ViewController::TitlesDisplay titlesDisplay() override {
     return ViewController::TitlesDisplay::DisplayLastAndThirdToLast;
   }
-  int numberOfRows() const override { return 1; }
+  int numberOfRows() const override { return 1 + m_hasAmortization; }
+  int typeAtRow(int row) const override {
+    assert(row == 0 || (row == 1 && m_hasAmortization));
+    return row == 0 ? k_resultCellType : k_amortizationCellType;
+  }
   int reusableCellCount(int type) override { return 1; }
   Escher::HighlightCell* reusableCell(int i, int type) override {
-    assert(type == 0 && i == 0);
-    return &m_cell;
+    assert(i == 0);
+    if (type == k_resultCellType) {
+      return &m_cell;
+    }
+    assert(type == k_amortizationCellType);
+    return &m_amortizationCell;
   }
   KDCoordinate nonMemoizedRowHeight(int row) override {
-    return m_cell.minimalSizeForOptimalDisplay().height();
+    Escher::HighlightCell* cell = reusableCell(0, typeAtRow(row));
+    return cell->minimalSizeForOptimalDisplay().height();
   }
 
  private:
+  constexpr static int k_resultCellType = 0;
+  constexpr static int k_amortizationCellType = 1;
+
   constexpr static int k_titleBufferSize =
       1 + Ion::Display::Width / KDFont::GlyphWidth(KDFont::Size::Small);
   char m_titleBuffer[k_titleBufferSize];
 
   Escher::MessageTextView m_messageView;
   ResultCell m_cell;
+  AmortizationCell m_amortizationCell;
+  AmortizationController* m_amortizationController;
+  bool m_hasAmortization;
 };
 
 }  // namespace Finance
@@ -2,6 +2,9 @@
 #include <poincare/test/helper.h>
 #include <quiz.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include "../data.h"
 
 using namespace Finance;
@@ -138,3 +141,170 @@ QUIZ_CASE(finance_compound_interest) {
     assert_interest_solves(values, paymentIsAtBegining, &data);
   }
 }
+
+QUIZ_CASE(finance_compound_interest_rate) {
+  double m_sharedValues[InterestData::k_numberOfSharedDoubleValues];
+  CompoundInterestData data(m_sharedValues);
+  // 30 years mortgage with monthly payments
+  const double values[CompoundInterestData::k_numberOfDoubleValues] = {
+      360.0,        // N
+      4.5,          // rPct
+      200000.0,     // PV
+      0.0,          // FV
+      -1013.37062,  // Pmt
+      12.0,         // PY
+      12.0          // CY
+  };
+  bool paymentIsAtBegining = false;
+  assert_interest_solves(values, paymentIsAtBegining, &data);
+  // The rate is searched in [-100,100], a rate of 201% is not a solution
+  const double unboundedValues[CompoundInterestData::k_numberOfDoubleValues] = {
+      1.0,     // N
+      201.0,   // rPct
+      100.0,   // PV
+      -300.0,  // FV
+      -1.0,    // Pmt
+      1.0,     // PY
+      1.0      // CY
+  };
+  for (uint8_t paramIndex = 0; paramIndex < data.numberOfDoubleValues();
+       paramIndex++) {
+    data.setValue(paramIndex, unboundedValues[paramIndex]);
+  }
+  // rPct
+  data.setUnknown(1);
+  quiz_assert(std::isnan(data.computeUnknownValue()));
+  /* Newton converges to the rate of 109.44%, out of [-100,100], and the
+   * generic solver finds the other one. The rates are 100*((1±√(0.2))^2-1). */
+  const double twoRatesValues[CompoundInterestData::k_numberOfDoubleValues] = {
+      2.0,      // N
+      0.0,      // rPct
+      500.0,    // PV
+      1400.0,   // FV
+      -1000.0,  // Pmt
+      2.0,      // PY
+      1.0       // CY
+  };
+  for (uint8_t paramIndex = 0; paramIndex < data.numberOfDoubleValues();
+       paramIndex++) {
+    data.setValue(paramIndex, twoRatesValues[paramIndex]);
+  }
+  data.setUnknown(1);
+  double rPct = data.computeUnknownValue();
+  quiz_assert(std::isfinite(rPct) && -100.0 <= rPct && rPct <= 100.0);
+  assert_roughly_equal(
+      rPct, 100.0 * (std::pow(1.0 - std::sqrt(0.2), 2.0) - 1.0), k_precision,
+      false);
+}
+
+static void assert_amortization_is(const double* values,
+                                   bool paymentIsAtBegining,
+                                   int expectedNumberOfPeriods) {
+  double m_sharedValues[InterestData::k_numberOfSharedDoubleValues];
+  CompoundInterestData data(m_sharedValues);
+  data.m_booleanParam = paymentIsAtBegining;
+  for (uint8_t paramIndex = 0; paramIndex < data.numberOfDoubleValues();
+       paramIndex++) {
+    data.setValue(paramIndex, values[paramIndex]);
+  }
+  Amortization amortization = data.amortization();
+  quiz_assert(amortization.numberOfPeriods() == expectedNumberOfPeriods);
+  const double rPct = values[1];
+  const double PV = values[2];
+  const double FV = values[3];
+  const double Pmt = values[4];
+  const double PY = values[5];
+  const double CY = values[6];
+  const double S = paymentIsAtBegining ? 1.0 : 0.0;
+  const double i = std::pow(1.0 + rPct / (100.0 * CY), CY / PY) - 1.0;
+  assert_roughly_equal(amortization.balanceAtPeriod(0), PV, k_precision,
+                       false);
+  assert_roughly_equal(amortization.balanceAtPeriod(expectedNumberOfPeriods),
+                       -FV, k_precision, false);
+  /* Rows computed in one pass must match the closed form and the balance
+   * updated period by period. */
+  constexpr int k_numberOfRows = 12;
+  double interests[k_numberOfRows];
+  double principals[k_numberOfRows];
+  double balances[k_numberOfRows];
+  double principalSum = 0.0;
+  double previousBalance = PV;
+  for (int firstPeriod = 1; firstPeriod <= expectedNumberOfPeriods;
+       firstPeriod += k_numberOfRows) {
+    int numberOfRows =
+        std::min(k_numberOfRows, expectedNumberOfPeriods - firstPeriod + 1);
+    amortization.computeRows(firstPeriod, numberOfRows, interests, principals,
+                             balances);
+    for (int j = 0; j < numberOfRows; j++) {
+      int period = firstPeriod + j;
+      assert_roughly_equal(interests[j], amortization.interestAtPeriod(period),
+                           k_precision, false);
+      assert_roughly_equal(balances[j], amortization.balanceAtPeriod(period),
+                           k_precision, false);
+      double interest = i * (previousBalance + S * Pmt);
+      double balance = previousBalance + interest + Pmt;
+      assert_roughly_equal(interests[j], interest, k_precision, false);
+      assert_roughly_equal(balances[j], balance, k_precision, false);
+      assert_roughly_equal(principals[j], previousBalance - balance,
+                           k_precision, false);
+      principalSum += principals[j];
+      previousBalance = balance;
+    }
+  }
+  assert_roughly_equal(principalSum, PV + FV, k_precision, false);
+}
+
+QUIZ_CASE(finance_amortization) {
+  {
+    const double values[CompoundInterestData::k_numberOfDoubleValues] = {
+        360.0,        // N
+        4.5,          // rPct
+        200000.0,     // PV
+        0.0,          // FV
+        -1013.37062,  // Pmt
+        12.0,         // PY
+        12.0          // CY
+    };
+    bool paymentIsAtBegining = false;
+    assert_amortization_is(values, paymentIsAtBegining, 360);
+    // The first payment is 750 of interest on 200000 at 4.5%/12
+    double m_sharedValues[InterestData::k_numberOfSharedDoubleValues];
+    CompoundInterestData data(m_sharedValues);
+    data.m_booleanParam = paymentIsAtBegining;
+    for (uint8_t paramIndex = 0; paramIndex < data.numberOfDoubleValues();
+         paramIndex++) {
+      data.setValue(paramIndex, values[paramIndex]);
+    }
+    Amortization amortization = data.amortization();
+    assert_roughly_equal(amortization.interestAtPeriod(1), 750.0, k_precision,
+                         false);
+    assert_roughly_equal(amortization.principalAtPeriod(1), 263.37062,
+                         k_precision, false);
+  }
+  {
+    const double values[CompoundInterestData::k_numberOfDoubleValues] = {
+        120.0,        // N
+        5.0,          // rPct
+        0.0,          // PV
+        -15511.0514,  // FV
+        100.0,        // Pmt
+        12.0,         // PY
+        4.0           // CY
+    };
+    bool paymentIsAtBegining = false;
+    assert_amortization_is(values, paymentIsAtBegining, 120);
+  }
+  {
+    const double values[CompoundInterestData::k_numberOfDoubleValues] = {
+        6.0,   // N
+        0.0,   // rPct
+        0.0,   // PV
+        6.0,   // FV
+        -1.0,  // Pmt
+        12.0,  // PY
+        1.0    // CY
+    };
+    bool paymentIsAtBegining = true;
+    assert_amortization_is(values, paymentIsAtBegining, 6);
+  }
+}
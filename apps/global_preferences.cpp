@@ -2,7 +2,8 @@
 
 #include "apps_container_helper.h"
 
-OMG::GlobalBox<GlobalPreferences> GlobalPreferences::sharedGlobalPreferences;
+OMG_THREAD_LOCAL OMG::GlobalBox<GlobalPreferences>
+    GlobalPreferences::sharedGlobalPreferences;
 
 void GlobalPreferences::setCountry(I18n::Country country,
                                    bool updateSnapshots) {
@@ -86,9 +86,20 @@ static Coordinate2D<T> parametricExpressionEvaluator(T t, const void *model,
 
 Range2D GraphController::optimalRange(bool computeX, bool computeY,
                                       Range2D originalRange) const {
-  Context *context = App::app()->localContext();
-  Zoom zoom(NAN, NAN, InteractiveCurveViewRange::NormalYXRatio(), context,
+  Zoom zoom(NAN, NAN, InteractiveCurveViewRange::NormalYXRatio(), nullptr,
             k_maxFloat);
+  Range2D range;
+  int step = 0;
+  while (!optimalRangeStep(step, &zoom, computeX, computeY, originalRange,
+                           &range)) {
+    step++;
+  }
+  return range;
+}
+
+bool GraphController::optimalRangeStep(int step, Zoom *zoom, bool computeX,
+                                       bool computeY, Range2D originalRange,
+                                       Range2D *range) const {
   ContinuousFunctionStore *store = functionStore();
   if (store->memoizationOverflows()) {
     /* Do not compute autozoom if store is full because the computation is too
@@ -97,182 +108,235 @@ Range2D GraphController::optimalRange(bool computeX, bool computeY,
     Range2D defaultRange(xRange, xRange);
     defaultRange.setRatio(InteractiveCurveViewRange::NormalYXRatio(), true,
                           k_maxFloat);
-    return Range2D(*(computeX ? defaultRange : originalRange).x(),
-                   *(computeY ? defaultRange : originalRange).y());
+    *range = Range2D(*(computeX ? defaultRange : originalRange).x(),
+                     *(computeY ? defaultRange : originalRange).y());
+    return true;
   }
-  bool canComputeIntersections
-      [ContinuousFunctionStore::k_maxNumberOfMemoizedModels];
+  /* The points of interest of each function are fitted in one step, and its
+   * magnitude in another step once all the points of interest are fitted. */
+  Context *context = App::app()->localContext();
   int nbFunctions = store->numberOfActiveFunctions();
   assert(nbFunctions <= ContinuousFunctionStore::k_maxNumberOfMemoizedModels);
   Range1D xBounds =
       computeX ? Range1D(-k_maxFloat, k_maxFloat) : *originalRange.x();
   Range1D yBounds =
       computeY ? Range1D(-k_maxFloat, k_maxFloat) : *originalRange.y();
-  Range2D forcedRange = Range2D(computeX ? Range1D() : *originalRange.x(),
-                                computeY ? Range1D() : *originalRange.y());
-  zoom.setForcedRange(forcedRange);
-
-  for (int i = 0; i < nbFunctions; i++) {
-    canComputeIntersections[i] = false;
-    ExpiringPointer<ContinuousFunction> f =
-        store->modelForRecord(store->activeRecordAtIndex(i));
-    if (f->approximationBasedOnCostlyAlgorithms(context)) {
-      continue;
+  if (step == 0) {
+    *zoom = Zoom(NAN, NAN, InteractiveCurveViewRange::NormalYXRatio(), context,
+                 k_maxFloat);
+    zoom->setForcedRange(Range2D(computeX ? Range1D() : *originalRange.x(),
+                                 computeY ? Range1D() : *originalRange.y()));
+  }
+  if (step < nbFunctions) {
+    fitPointsOfInterest(step, zoom, xBounds, yBounds, context);
+  } else if (computeY) {
+    zoom->setBounds(xBounds.min(), xBounds.max());
+    if (step < 2 * nbFunctions) {
+      /* If X range is forced (computeX is false), we don't want to crop the Y
+       * axis: we want to see the value of f at each point of X range. */
+      bool cropOutliers = computeX;
+      fitMagnitude(step - nbFunctions, zoom, cropOutliers, context);
     }
-    if (f->properties().isPolar() || f->properties().isInversePolar() ||
-        f->properties().isParametric()) {
-      assert(std::isfinite(f->tMin()) && std::isfinite(f->tMax()));
-      Expression e = f->expressionApproximated(context);
-      if (f->properties().isPolar() || f->properties().isInversePolar()) {
-        Expression firstRow, secondRow;
-        Expression unknown =
-            Symbol::Builder(ContinuousFunction::k_unknownName,
-                            strlen(ContinuousFunction::k_unknownName));
-        if (f->properties().isPolar()) {
-          /* Turn r(theta) into f(theta) = [x(theta), y(theta)]
-           *   x(theta) = cos(theta)*r(theta) */
-          firstRow = Multiplication::Builder(Cosine::Builder(unknown.clone()),
-                                             e.clone());
-          //   y(theta) = sin(theta)*r(theta)
-          secondRow = Multiplication::Builder(Sine::Builder(unknown.clone()),
-                                              e.clone());
-        } else {
-          /* Turn theta(r) into f(r) = [x(r), y(r)]
-           *   x(r) = r*cos(theta(r)) */
-          firstRow = Multiplication::Builder(unknown.clone(),
-                                             Cosine::Builder(e.clone()));
-          //  y(theta) = r*sin(theta(r))
-          secondRow = Multiplication::Builder(unknown.clone(),
-                                              Sine::Builder(e.clone()));
-        }
-        Matrix parametricExpression = Matrix::Builder();
-        parametricExpression.addChildAtIndexInPlace(firstRow, 0, 0);
-        parametricExpression.addChildAtIndexInPlace(secondRow, 1, 1);
-        parametricExpression.setDimensions(2, 1);
-        e = parametricExpression;
-      }
-      assert((e.type() == ExpressionNode::Type::Matrix &&
-              e.numberOfChildren() == 2) ||
-             (e.type() == ExpressionNode::Type::Dependency &&
-              e.childAtIndex(0).type() == ExpressionNode::Type::Matrix &&
-              e.childAtIndex(0).numberOfChildren() == 2));
-
-      // Compute the ordinate range of x(t) and y(t)
-      Range1D ranges[2];
-      Zoom::Function2DWithContext<float> floatEvaluators[2] = {
-          parametricExpressionEvaluator<float, 0>,
-          parametricExpressionEvaluator<float, 1>};
-      Zoom::Function2DWithContext<double> doubleEvaluators[2] = {
-          parametricExpressionEvaluator<double, 0>,
-          parametricExpressionEvaluator<double, 1>};
-      for (int coordinate = 0; coordinate < 2; coordinate++) {
-        Zoom zoomAlongCoordinate(NAN, NAN,
-                                 InteractiveCurveViewRange::NormalYXRatio(),
-                                 context, k_maxFloat);
-        zoomAlongCoordinate.setBounds(f->tMin(), f->tMax());
-        zoomAlongCoordinate.fitPointsOfInterest(floatEvaluators[coordinate], &e,
-                                                false,
-                                                doubleEvaluators[coordinate]);
-        zoomAlongCoordinate.fitBounds(floatEvaluators[coordinate], &e, false);
-        ranges[coordinate] = *zoomAlongCoordinate.range(false, false).y();
-      }
+  }
+  if (step < (computeY ? 2 : 1) * nbFunctions - 1) {
+    return false;
+  }
+  Range2D newRange = zoom->range(true, defaultRangeIsNormalized());
+  *range = Range2D(*(computeX ? newRange : originalRange).x(),
+                   *(computeY ? newRange : originalRange).y());
+  return true;
+}
 
-      // Fit the zoom to the range of x(t) and y(t)
-      zoom.fitPoint(Coordinate2D<float>(ranges[0].max(), ranges[1].max()));
-      zoom.fitPoint(Coordinate2D<float>(ranges[0].min(), ranges[1].min()));
-    } else if (f->properties().isScatterPlot()) {
-      ApproximationContext approximationContext(context);
-      for (Point p : f->iterateScatterPlot(context)) {
-        zoom.fitPoint(p.approximate2D<float>(approximationContext));
-      }
-    } else {
-      assert(f->properties().isCartesian());
-      canComputeIntersections[i] = true;
-      bool alongY = f->isAlongY();
-      Range1D *bounds = alongY ? &yBounds : &xBounds;
-      // Use the intersection between the definition domain of f and the bounds
-      zoom.setBounds(std::clamp(f->tMin(), bounds->min(), bounds->max()),
-                     std::clamp(f->tMax(), bounds->min(), bounds->max()));
-      zoom.fitPointsOfInterest(evaluator<float>, f.operator->(), alongY,
-                               evaluator<double>, canComputeIntersections + i);
-      zoom.fitBounds(evaluator<float>, f.operator->(), alongY);
-      if (f->numberOfSubCurves() > 1) {
-        assert(f->numberOfSubCurves() == 2);
-        zoom.fitPointsOfInterest(evaluatorSecondCurve<float>, f.operator->(),
-                                 alongY, evaluatorSecondCurve<double>,
-                                 canComputeIntersections + i);
-        zoom.fitBounds(evaluatorSecondCurve<float>, f.operator->(), alongY);
+void GraphController::fitPointsOfInterest(int i, Zoom *zoom, Range1D xBounds,
+                                          Range1D yBounds,
+                                          Context *context) const {
+  ContinuousFunctionStore *store = functionStore();
+  m_canComputeIntersections[i] = false;
+  ExpiringPointer<ContinuousFunction> f =
+      store->modelForRecord(store->activeRecordAtIndex(i));
+  if (f->approximationBasedOnCostlyAlgorithms(context)) {
+    return;
+  }
+  if (f->properties().isPolar() || f->properties().isInversePolar() ||
+      f->properties().isParametric()) {
+    assert(std::isfinite(f->tMin()) && std::isfinite(f->tMax()));
+    Expression e = f->expressionApproximated(context);
+    if (f->properties().isPolar() || f->properties().isInversePolar()) {
+      Expression firstRow, secondRow;
+      Expression unknown =
+          Symbol::Builder(ContinuousFunction::k_unknownName,
+                          strlen(ContinuousFunction::k_unknownName));
+      if (f->properties().isPolar()) {
+        /* Turn r(theta) into f(theta) = [x(theta), y(theta)]
+         *   x(theta) = cos(theta)*r(theta) */
+        firstRow = Multiplication::Builder(Cosine::Builder(unknown.clone()),
+                                           e.clone());
+        //   y(theta) = sin(theta)*r(theta)
+        secondRow = Multiplication::Builder(Sine::Builder(unknown.clone()),
+                                            e.clone());
+      } else {
+        /* Turn theta(r) into f(r) = [x(r), y(r)]
+         *   x(r) = r*cos(theta(r)) */
+        firstRow = Multiplication::Builder(unknown.clone(),
+                                           Cosine::Builder(e.clone()));
+        //  y(theta) = r*sin(theta(r))
+        secondRow = Multiplication::Builder(unknown.clone(),
+                                            Sine::Builder(e.clone()));
       }
+      Matrix parametricExpression = Matrix::Builder();
+      parametricExpression.addChildAtIndexInPlace(firstRow, 0, 0);
+      parametricExpression.addChildAtIndexInPlace(secondRow, 1, 1);
+      parametricExpression.setDimensions(2, 1);
+      e = parametricExpression;
+    }
+    assert((e.type() == ExpressionNode::Type::Matrix &&
+            e.numberOfChildren() == 2) ||
+           (e.type() == ExpressionNode::Type::Dependency &&
+            e.childAtIndex(0).type() == ExpressionNode::Type::Matrix &&
+            e.childAtIndex(0).numberOfChildren() == 2));
+
+    // Compute the ordinate range of x(t) and y(t)
+    Range1D ranges[2];
+    Zoom::Function2DWithContext<float> floatEvaluators[2] = {
+        parametricExpressionEvaluator<float, 0>,
+        parametricExpressionEvaluator<float, 1>};
+    Zoom::Function2DWithContext<double> doubleEvaluators[2] = {
+        parametricExpressionEvaluator<double, 0>,
+        parametricExpressionEvaluator<double, 1>};
+    for (int coordinate = 0; coordinate < 2; coordinate++) {
+      Zoom zoomAlongCoordinate(NAN, NAN,
+                               InteractiveCurveViewRange::NormalYXRatio(),
+                               context, k_maxFloat);
+      zoomAlongCoordinate.setBounds(f->tMin(), f->tMax());
+      zoomAlongCoordinate.fitPointsOfInterest(floatEvaluators[coordinate], &e,
+                                              false,
+                                              doubleEvaluators[coordinate]);
+      zoomAlongCoordinate.fitBounds(floatEvaluators[coordinate], &e, false);
+      ranges[coordinate] = *zoomAlongCoordinate.range(false, false).y();
+    }
 
-      /* Special case for piecewise functions: we want to display the branch
-       * edges even if the behaviour is not "interesting".
-       * FIXME For simplicity's sake, only the first piecewise operator will
-       * have its conditions fitted. It is assumed that expressions containing
-       * more than one piecewise will be rare. */
-      Expression p;
-      Expression::ExpressionTestAuxiliary yieldPiecewise =
-          [](const Expression e, Context *, void *auxiliary) {
-            if (e.type() == ExpressionNode::Type::PiecewiseOperator) {
-              *static_cast<Expression *>(auxiliary) = e;
-              return true;
-            } else {
-              return false;
-            }
-          };
-      if (f->expressionApproximated(context).recursivelyMatches(
-              yieldPiecewise, context,
-              SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition,
-              &p)) {
-        assert(!p.isUninitialized() &&
-               p.type() == ExpressionNode::Type::PiecewiseOperator);
-        zoom.fitConditions(static_cast<PiecewiseOperator &>(p),
-                           evaluator<float>, f.operator->(),
-                           ContinuousFunction::k_unknownName,
-                           Preferences::sharedPreferences->complexFormat(),
-                           Preferences::sharedPreferences->angleUnit(), alongY);
-      }
+    // Fit the zoom to the range of x(t) and y(t)
+    zoom->fitPoint(Coordinate2D<float>(ranges[0].max(), ranges[1].max()));
+    zoom->fitPoint(Coordinate2D<float>(ranges[0].min(), ranges[1].min()));
+  } else if (f->properties().isScatterPlot()) {
+    ApproximationContext approximationContext(context);
+    for (Point p : f->iterateScatterPlot(context)) {
+      zoom->fitPoint(p.approximate2D<float>(approximationContext));
+    }
+  } else {
+    assert(f->properties().isCartesian());
+    m_canComputeIntersections[i] = true;
+    bool alongY = f->isAlongY();
+    Range1D *bounds = alongY ? &yBounds : &xBounds;
+    // Use the intersection between the definition domain of f and the bounds
+    zoom->setBounds(std::clamp(f->tMin(), bounds->min(), bounds->max()),
+                    std::clamp(f->tMax(), bounds->min(), bounds->max()));
+    zoom->fitPointsOfInterest(evaluator<float>, f.operator->(), alongY,
+                              evaluator<double>, m_canComputeIntersections + i);
+    zoom->fitBounds(evaluator<float>, f.operator->(), alongY);
+    if (f->numberOfSubCurves() > 1) {
+      assert(f->numberOfSubCurves() == 2);
+      zoom->fitPointsOfInterest(evaluatorSecondCurve<float>, f.operator->(),
+                                alongY, evaluatorSecondCurve<double>,
+                                m_canComputeIntersections + i);
+      zoom->fitBounds(evaluatorSecondCurve<float>, f.operator->(), alongY);
+    }
 
-      if (canComputeIntersections[i] &&
-          f->properties()
-              .canComputeIntersectionsWithFunctionsAlongSameVariable()) {
-        ContinuousFunction *mainF = f.operator->();
-        for (int j = 0; j < i; j++) {
-          ExpiringPointer<ContinuousFunction> g =
-              store->modelForRecord(store->activeRecordAtIndex(j));
-          if (canComputeIntersections[j] &&
-              g->properties()
-                  .canComputeIntersectionsWithFunctionsAlongSameVariable() &&
-              g->isAlongY() == alongY &&
-              !g->approximationBasedOnCostlyAlgorithms(context)) {
-            zoom.fitIntersections(evaluator<float>, mainF, evaluator<float>,
-                                  g.operator->());
+    /* Special case for piecewise functions: we want to display the branch
+     * edges even if the behaviour is not "interesting".
+     * FIXME For simplicity's sake, only the first piecewise operator will
+     * have its conditions fitted. It is assumed that expressions containing
+     * more than one piecewise will be rare. */
+    Expression p;
+    Expression::ExpressionTestAuxiliary yieldPiecewise =
+        [](const Expression e, Context *, void *auxiliary) {
+          if (e.type() == ExpressionNode::Type::PiecewiseOperator) {
+            *static_cast<Expression *>(auxiliary) = e;
+            return true;
+          } else {
+            return false;
           }
+        };
+    if (f->expressionApproximated(context).recursivelyMatches(
+            yieldPiecewise, context,
+            SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition,
+            &p)) {
+      assert(!p.isUninitialized() &&
+             p.type() == ExpressionNode::Type::PiecewiseOperator);
+      zoom->fitConditions(static_cast<PiecewiseOperator &>(p),
+                          evaluator<float>, f.operator->(),
+                          ContinuousFunction::k_unknownName,
+                          Preferences::sharedPreferences->complexFormat(),
+                          Preferences::sharedPreferences->angleUnit(), alongY);
+    }
+
+    if (m_canComputeIntersections[i] &&
+        f->properties()
+            .canComputeIntersectionsWithFunctionsAlongSameVariable()) {
+      ContinuousFunction *mainF = f.operator->();
+      for (int j = 0; j < i; j++) {
+        ExpiringPointer<ContinuousFunction> g =
+            store->modelForRecord(store->activeRecordAtIndex(j));
+        if (m_canComputeIntersections[j] &&
+            g->properties()
+                .canComputeIntersectionsWithFunctionsAlongSameVariable() &&
+            g->isAlongY() == alongY &&
+            !g->approximationBasedOnCostlyAlgorithms(context)) {
+          zoom->fitIntersections(evaluator<float>, mainF, evaluator<float>,
+                                 g.operator->());
         }
       }
     }
   }
+}
 
-  if (computeY) {
-    zoom.setBounds(xBounds.min(), xBounds.max());
-    for (int i = 0; i < nbFunctions; i++) {
-      ExpiringPointer<ContinuousFunction> f =
-          store->modelForRecord(store->activeRecordAtIndex(i));
-      if (f->approximationBasedOnCostlyAlgorithms(context) ||
-          !f->properties().isCartesian()) {
-        continue;
-      }
-      bool alongY = f->isAlongY();
-      /* If X range is forced (computeX is false), we don't want to crop the Y
-       * axis: we want to see the value of f at each point of X range. */
-      bool cropOutliers = computeX;
-      zoom.fitMagnitude(evaluator, f.operator->(), cropOutliers, alongY);
-      if (f->numberOfSubCurves() > 1) {
-        zoom.fitMagnitude(evaluatorSecondCurve, f.operator->(), cropOutliers,
-                          alongY);
-      }
-    }
+void GraphController::fitMagnitude(int i, Zoom *zoom, bool cropOutliers,
+                                   Context *context) const {
+  ContinuousFunctionStore *store = functionStore();
+  ExpiringPointer<ContinuousFunction> f =
+      store->modelForRecord(store->activeRecordAtIndex(i));
+  if (f->approximationBasedOnCostlyAlgorithms(context) ||
+      !f->properties().isCartesian()) {
+    return;
   }
+  bool alongY = f->isAlongY();
+  zoom->fitMagnitude(evaluator, f.operator->(), cropOutliers, alongY);
+  if (f->numberOfSubCurves() > 1) {
+    zoom->fitMagnitude(evaluatorSecondCurve, f.operator->(), cropOutliers,
+                       alongY);
+  }
+}
 
+Range2D GraphController::estimatedRange(bool computeX, bool computeY,
+                                        Range2D originalRange) const {
+  ContinuousFunctionStore *store = functionStore();
+  if (store->memoizationOverflows()) {
+    // optimalRange does not sample the functions either
+    return Range2D();
+  }
+  /* Only the magnitude of the cartesian functions is sampled, on the default
+   * range of the unknown. The points of interest and the intersections, which
+   * need the solver, are left to optimalRange. */
+  Context *context = App::app()->localContext();
+  Zoom zoom(NAN, NAN, InteractiveCurveViewRange::NormalYXRatio(), context,
+            k_maxFloat);
+  zoom.setForcedRange(Range2D(computeX ? Range1D() : *originalRange.x(),
+                              computeY ? Range1D() : *originalRange.y()));
+  int nbFunctions = store->numberOfActiveFunctions();
+  for (int i = 0; i < nbFunctions; i++) {
+    ExpiringPointer<ContinuousFunction> f =
+        store->modelForRecord(store->activeRecordAtIndex(i));
+    if (f->approximationBasedOnCostlyAlgorithms(context) ||
+        !f->properties().isCartesian()) {
+      continue;
+    }
+    bool alongY = f->isAlongY();
+    zoom.fitMagnitude(evaluator<float>, f.operator->(), computeX, alongY);
+    if (f->numberOfSubCurves() > 1) {
+      zoom.fitMagnitude(evaluatorSecondCurve<float>, f.operator->(), computeX,
+                        alongY);
+    }
+  }
   Range2D newRange = zoom.range(true, defaultRangeIsNormalized());
   return Range2D(*(computeX ? newRange : originalRange).x(),
                  *(computeY ? newRange : originalRange).y());
@@ -38,6 +38,12 @@ class GraphController : public Shared::FunctionGraphController,
   Poincare::Range2D optimalRange(
       bool computeX, bool computeY,
       Poincare::Range2D originalRange) const override;
+  bool optimalRangeStep(int step, Poincare::Zoom *zoom, bool computeX,
+                        bool computeY, Poincare::Range2D originalRange,
+                        Poincare::Range2D *range) const override;
+  Poincare::Range2D estimatedRange(
+      bool computeX, bool computeY,
+      Poincare::Range2D originalRange) const override;
 
   // TextFieldDelegate
   bool textFieldIsEditable(Escher::AbstractTextField *) override {
@@ -135,6 +141,12 @@ class GraphController : public Shared::FunctionGraphController,
   void interestingFunctionRange(
       Shared::ExpiringPointer<Shared::ContinuousFunction> f, float tMin,
       float tMax, float step, float *xm, float *xM, float *ym, float *yM) const;
+  // The steps of optimalRange for the i-th active function
+  void fitPointsOfInterest(int i, Poincare::Zoom *zoom,
+                           Poincare::Range1D xBounds, Poincare::Range1D yBounds,
+                           Poincare::Context *context) const;
+  void fitMagnitude(int i, Poincare::Zoom *zoom, bool cropOutliers,
+                    Poincare::Context *context) const;
 
   Shared::ToggleableRingRoundCursorView m_cursorView;
   BannerView m_bannerView;
@@ -144,6 +156,10 @@ class GraphController : public Shared::FunctionGraphController,
   FunctionSelectionController m_functionSelectionController;
   constexpr static int k_numberOfCaches = 5;
   Ion::RingBuffer<PointsOfInterestCache, k_numberOfCaches> m_pointsOfInterest;
+  /* Whether the intersections of the functions fitted by the previous steps
+   * of optimalRange can be computed */
+  mutable bool m_canComputeIntersections
+      [Shared::ContinuousFunctionStore::k_maxNumberOfMemoizedModels];
 };
 
 }  // namespace Graph
@@ -1,6 +1,7 @@
 #include "graph_view.h"
 
 #include <poincare/trigonometry.h>
+#include <poincare/worker_pool.h>
 
 #include "../app.h"
 
@@ -112,6 +113,11 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index,
   }
   ContinuousFunctionCache::PrepareForCaching(f.operator->(), cch, tCacheMin,
                                              tCacheStep);
+  if (f->properties().isCartesian() && f->cache() &&
+      WorkerPool::NumberOfWorkers() > 0) {
+    // Approximate the dots of the curve in parallel before drawing it
+    f->cache()->fill(f.operator->(), context(), tmax);
+  }
 
   /* Check now if e can be discontinuous: In case e does not involves
    * discontinuous functions, this avoids recomputing potential
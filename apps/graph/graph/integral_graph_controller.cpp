@@ -1,5 +1,6 @@
 #include "integral_graph_controller.h"
 
+#include <apps/shared/poincare_helpers.h>
 #include <assert.h>
 #include <poincare/layout_helper.h>
 #include <stdlib.h>
@@ -41,6 +42,15 @@ double IntegralGraphController::cursorNextStep(
                  static_cast<double>(k_numberOfCursorStepsInGradUnit);
 }
 
+double IntegralGraphController::approximateSum(const Expression sum,
+                                               Context* context) {
+  assert(sum.type() == ExpressionNode::Type::Integral);
+  Integral integral = static_cast<const Integral&>(sum);
+  return integral.approximateWithPanelCache(
+      &m_panelCache, static_cast<double>(m_graphRange->xGridUnit()),
+      PoincareHelpers::ApproximationContextForParameters(sum, context, {}));
+}
+
 Layout IntegralGraphController::createFunctionLayout() {
   ExpiringPointer<ContinuousFunction> function =
       App::app()->functionStore()->modelForRecord(selectedRecord());
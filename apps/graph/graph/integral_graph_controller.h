@@ -2,6 +2,7 @@
 #define GRAPH_INTEGRAL_GRAPH_CONTROLLER_H
 
 #include <apps/shared/sum_graph_controller.h>
+#include <poincare/integral.h>
 
 #include "graph_view.h"
 
@@ -18,11 +19,16 @@ class IntegralGraphController : public Shared::SumGraphController {
  protected:
   double cursorNextStep(double position,
                         OMG::HorizontalDirection direction) override;
+  double approximateSum(const Poincare::Expression sum,
+                        Poincare::Context* context) override;
 
  private:
   CodePoint sumSymbol() const override { return UCodePointIntegral; }
   I18n::Message legendMessageAtStep(Step step) override;
   Poincare::Layout createFunctionLayout() override;
+
+  // Panels of the grid of the graph, kept while the cursor moves a bound
+  Poincare::IntegralPanelCache m_panelCache;
 };
 
 }  // namespace Graph
@@ -210,6 +210,7 @@ void PointsOfInterestCache::computeBetween(float start, float end) {
   Context *context = App::app()->localContext();
   ExpiringPointer<ContinuousFunction> f = store->modelForRecord(m_record);
   Expression e = f->expressionApproximated(context);
+  const DerivativeTape *derivativeTape = f->derivativeTape(context);
 
   if (start < 0.f && 0.f < end) {
     for (int curveIndex = 0; curveIndex < f->numberOfSubCurves();
@@ -242,6 +243,7 @@ void PointsOfInterestCache::computeBetween(float start, float end) {
     solver.setSearchStep(searchStep);
     solver.stretch();
     solver.setGrowthSpeed(Solver<double>::GrowthSpeed::Fast);
+    solver.setDerivativeTape(derivativeTape, e);
     Coordinate2D<double> solution;
     while (std::isfinite(
         (solution = (solver.*next)(e)).x())) {  // assignment in condition
@@ -0,0 +1,98 @@
+#include <apps/shared/global_context.h>
+#include <quiz.h>
+
+#include "../values/exact_values_cache.h"
+#include "../values/exact_values_job.h"
+#include "helper.h"
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+static Layout layoutOf(const char* text, Context* context) {
+  Preferences* preferences = Preferences::sharedPreferences;
+  return Expression::Parse(text, context)
+      .createLayout(preferences->displayMode(),
+                    preferences->numberOfSignificantDigits(), context);
+}
+
+QUIZ_CASE(graph_exact_values_cache) {
+  // The cache is too large for the stack
+  static ExactValuesCache cache;
+  cache.reset();
+  GlobalContext context;
+  Ion::Storage::Record f("f.func");
+  Ion::Storage::Record g("g.func");
+  quiz_assert(cache.addColumn(f) == 0);
+  quiz_assert(cache.addColumn(g) == 1);
+  static_assert(ExactValuesCache::k_maxNumberOfColumns == 2);
+  quiz_assert(cache.addColumn(Ion::Storage::Record("h.func")) == -1);
+  quiz_assert(cache.columnOfRecord(g) == 1);
+  quiz_assert(cache.millisecondsSpentOnColumn(1) == 0);
+  cache.addMillisecondsSpentOnColumn(1, 3);
+  cache.addMillisecondsSpentOnColumn(1, 4);
+  quiz_assert(cache.millisecondsSpentOnColumn(0) == 0);
+  quiz_assert(cache.millisecondsSpentOnColumn(1) == 7);
+
+  Layout half = layoutOf("1/2", &context);
+  quiz_assert(cache.setLayout(1, 3, 0.5, half));
+  quiz_assert(cache.layout(1, 3, 0.5).isIdenticalTo(half));
+  // The row has been computed for another abscissa
+  quiz_assert(cache.layout(1, 3, 0.25).isUninitialized());
+  quiz_assert(cache.layout(0, 3, 0.5).isUninitialized());
+
+  // The layouts which do not fit are not cached
+  constexpr int k_numberOfRows = ExactValuesCache::k_maxNumberOfRows;
+  int i = 0;
+  while (cache.setLayout(i / k_numberOfRows, i % k_numberOfRows, i, half)) {
+    i++;
+    quiz_assert(i < ExactValuesCache::k_maxNumberOfColumns * k_numberOfRows);
+  }
+  quiz_assert(cache.layout(i / k_numberOfRows, i % k_numberOfRows, i)
+                  .isUninitialized());
+  i--;
+  quiz_assert(cache.layout(i / k_numberOfRows, i % k_numberOfRows, i)
+                  .isIdenticalTo(half));
+  int numberOfCachedRows = i + 1;
+
+  // The space of the recomputed rows is reclaimed
+  for (int j = 0; j < 3 * numberOfCachedRows; j++) {
+    quiz_assert(cache.setLayout(0, 0, -j, half));
+  }
+  quiz_assert(cache.layout(0, 0, -1).isUninitialized());
+  for (int j = 1; j < numberOfCachedRows; j++) {
+    quiz_assert(cache.layout(j / k_numberOfRows, j % k_numberOfRows, j)
+                    .isIdenticalTo(half));
+  }
+
+  // The space of the discarded rows is reclaimed
+  int firstDiscardedRow = numberOfCachedRows / 2;
+  cache.discardRows(0, firstDiscardedRow);
+  quiz_assert(cache.layout(0, firstDiscardedRow, firstDiscardedRow)
+                  .isUninitialized());
+  for (int j = firstDiscardedRow; j < numberOfCachedRows; j++) {
+    quiz_assert(cache.setLayout(1, j, -j, half));
+  }
+  quiz_assert(cache.layout(0, 1, 1).isIdenticalTo(half));
+
+  cache.reset();
+  quiz_assert(cache.numberOfColumns() == 0);
+}
+
+QUIZ_CASE(graph_exact_values_substitution) {
+  GlobalContext context;
+  ContinuousFunctionStore store;
+  ContinuousFunction* function = addFunction("f(x)=√(x)/x", &store, &context);
+  quiz_assert(
+      ExactValuesJob::ValueLayout(function, 2., &context, true)
+          .isIdenticalTo(layoutOf("√(2)/2", &context)));
+  quiz_assert(
+      ExactValuesJob::ValueLayout(function, 2., &context, false)
+          .isIdenticalTo(layoutOf("0.7071067812", &context)));
+  quiz_assert(ExactValuesJob::ValueLayout(function, 0., &context, true)
+                  .isIdenticalTo(layoutOf("undef", &context)));
+  store.removeAll();
+}
+
+}  // namespace Graph
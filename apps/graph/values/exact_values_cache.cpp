@@ -0,0 +1,131 @@
+#include "exact_values_cache.h"
+
+#include <assert.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Graph {
+
+void ExactValuesCache::reset() {
+  for (int i = 0; i < k_maxNumberOfColumns; i++) {
+    m_records[i] = Ion::Storage::Record();
+    m_milliseconds[i] = 0;
+    for (int j = 0; j < k_maxNumberOfRows; j++) {
+      m_sizes[i][j] = 0;
+    }
+  }
+  m_bufferUsage = 0;
+  m_numberOfColumns = 0;
+}
+
+Ion::Storage::Record ExactValuesCache::recordAtColumn(int column) const {
+  assert(0 <= column && column < m_numberOfColumns);
+  return m_records[column];
+}
+
+int ExactValuesCache::columnOfRecord(Ion::Storage::Record record) const {
+  for (int i = 0; i < m_numberOfColumns; i++) {
+    if (m_records[i] == record) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int ExactValuesCache::addColumn(Ion::Storage::Record record) {
+  assert(columnOfRecord(record) < 0);
+  if (m_numberOfColumns == k_maxNumberOfColumns) {
+    return -1;
+  }
+  m_records[m_numberOfColumns] = record;
+  return m_numberOfColumns++;
+}
+
+bool ExactValuesCache::hasLayout(int column, int row, double abscissa) const {
+  assert(0 <= column && column < m_numberOfColumns);
+  assert(0 <= row && row < k_maxNumberOfRows);
+  return m_sizes[column][row] > 0 && m_abscissas[column][row] == abscissa;
+}
+
+Layout ExactValuesCache::layout(int column, int row, double abscissa) const {
+  if (!hasLayout(column, row, abscissa)) {
+    return Layout();
+  }
+  return Layout::LayoutFromAddress(m_buffer + m_offsets[column][row],
+                                   m_sizes[column][row]);
+}
+
+bool ExactValuesCache::setLayout(int column, int row, double abscissa,
+                                 Layout layout) {
+  assert(0 <= column && column < m_numberOfColumns);
+  assert(0 <= row && row < k_maxNumberOfRows);
+  assert(!layout.isUninitialized());
+  size_t size = layout.size();
+  // The previous layout of the row is dropped even if the new one does not fit
+  m_sizes[column][row] = 0;
+  if (size > static_cast<size_t>(k_bufferSize - m_bufferUsage)) {
+    reclaimSpace();
+    if (size > static_cast<size_t>(k_bufferSize - m_bufferUsage)) {
+      return false;
+    }
+  }
+  memcpy(m_buffer + m_bufferUsage, layout.addressInPool(), size);
+  m_abscissas[column][row] = abscissa;
+  m_offsets[column][row] = m_bufferUsage;
+  m_sizes[column][row] = size;
+  m_bufferUsage += size;
+  return true;
+}
+
+void ExactValuesCache::discardRows(int column, int firstRow) {
+  assert(0 <= column && column < m_numberOfColumns);
+  for (int row = firstRow; row < k_maxNumberOfRows; row++) {
+    m_sizes[column][row] = 0;
+  }
+}
+
+uint32_t ExactValuesCache::millisecondsSpentOnColumn(int column) const {
+  assert(0 <= column && column < m_numberOfColumns);
+  return m_milliseconds[column];
+}
+
+void ExactValuesCache::addMillisecondsSpentOnColumn(int column,
+                                                    uint32_t duration) {
+  assert(0 <= column && column < m_numberOfColumns);
+  m_milliseconds[column] += duration;
+}
+
+void ExactValuesCache::reclaimSpace() {
+  /* Since the layouts only move towards the start of the buffer, moving them
+   * in the order of their offsets never overwrites a layout yet to move. */
+  uint16_t usage = 0;
+  uint16_t searchStart = 0;
+  while (true) {
+    int nextColumn = -1;
+    int nextRow = -1;
+    for (int i = 0; i < m_numberOfColumns; i++) {
+      for (int j = 0; j < k_maxNumberOfRows; j++) {
+        if (m_sizes[i][j] > 0 && m_offsets[i][j] >= searchStart &&
+            (nextColumn < 0 ||
+             m_offsets[i][j] < m_offsets[nextColumn][nextRow])) {
+          nextColumn = i;
+          nextRow = j;
+        }
+      }
+    }
+    if (nextColumn < 0) {
+      break;
+    }
+    uint16_t offset = m_offsets[nextColumn][nextRow];
+    uint16_t size = m_sizes[nextColumn][nextRow];
+    assert(usage <= offset);
+    memmove(m_buffer + usage, m_buffer + offset, size);
+    m_offsets[nextColumn][nextRow] = usage;
+    usage += size;
+    searchStart = offset + size;
+  }
+  m_bufferUsage = usage;
+}
+
+}  // namespace Graph
@@ -0,0 +1,71 @@
+#ifndef GRAPH_EXACT_VALUES_CACHE_H
+#define GRAPH_EXACT_VALUES_CACHE_H
+
+#include <apps/shared/interval.h>
+#include <ion/storage/record.h>
+#include <poincare/layout.h>
+#include <stdint.h>
+
+namespace Graph {
+
+/* The exact results of the values table are computed for a whole column at
+ * once by an ExactValuesJob and kept here, so that scrolling the table does
+ * not simplify the same expressions again.
+ * A column of layouts would not fit in the pool, so the layouts are copied out
+ * of it and rebuilt with Layout::LayoutFromAddress when they are displayed.
+ * Each row also records the abscissa it was computed for, since the interval
+ * can be edited while the results are cached. When the buffer is full, the
+ * space of the rows which were recomputed or discarded is reclaimed, and if
+ * it is not enough, the remaining rows are computed by the table when
+ * displayed. */
+
+class ExactValuesCache {
+ public:
+  constexpr static int k_maxNumberOfColumns = 2;
+  constexpr static int k_maxNumberOfRows =
+      Shared::Interval::k_maxNumberOfElements;
+  /* Exact results mostly take around a hundred bytes, so the buffer holds
+   * about forty rows of each column, several screens of the table. */
+  constexpr static uint16_t k_bufferSize = 8192;
+
+  ExactValuesCache() { reset(); }
+
+  void reset();
+  int numberOfColumns() const { return m_numberOfColumns; }
+  Ion::Storage::Record recordAtColumn(int column) const;
+  // Return -1 if record has no column
+  int columnOfRecord(Ion::Storage::Record record) const;
+  // Return -1 if all the columns are used
+  int addColumn(Ion::Storage::Record record);
+
+  bool hasLayout(int column, int row, double abscissa) const;
+  // Return an uninitialized layout if the row has not been computed
+  Poincare::Layout layout(int column, int row, double abscissa) const;
+  // Return false if the layout does not fit in the buffer
+  bool setLayout(int column, int row, double abscissa,
+                 Poincare::Layout layout);
+  // Forget the rows of column from firstRow on
+  void discardRows(int column, int firstRow);
+
+  // Time spent computing the rows of the column
+  uint32_t millisecondsSpentOnColumn(int column) const;
+  void addMillisecondsSpentOnColumn(int column, uint32_t duration);
+
+ private:
+  // Move the layouts of the cached rows together at the start of the buffer
+  void reclaimSpace();
+
+  Ion::Storage::Record m_records[k_maxNumberOfColumns];
+  double m_abscissas[k_maxNumberOfColumns][k_maxNumberOfRows];
+  uint16_t m_offsets[k_maxNumberOfColumns][k_maxNumberOfRows];
+  // A row which has not been computed has a null size
+  uint16_t m_sizes[k_maxNumberOfColumns][k_maxNumberOfRows];
+  uint32_t m_milliseconds[k_maxNumberOfColumns];
+  uint16_t m_bufferUsage;
+  uint8_t m_numberOfColumns;
+  alignas(uint32_t) char m_buffer[k_bufferSize];
+};
+
+}  // namespace Graph
+
+#endif
@@ -0,0 +1,92 @@
+#include "exact_values_job.h"
+
+#include <apps/shared/expression_display_permissions.h>
+#include <apps/shared/poincare_helpers.h>
+#include <assert.h>
+#include <ion/timing.h>
+#include <poincare/decimal.h>
+#include <poincare/symbol.h>
+#include <string.h>
+
+#include "../app.h"
+
+using namespace Shared;
+using namespace Poincare;
+
+namespace Graph {
+
+float ExactValuesJob::progress() const {
+  assert(m_cache);
+  if (!isRunning() || m_cache->numberOfColumns() == 0) {
+    return 1.f;
+  }
+  // The rows are counted as if the intervals were full
+  return static_cast<float>(m_column * ExactValuesCache::k_maxNumberOfRows +
+                            m_row) /
+         (m_cache->numberOfColumns() * ExactValuesCache::k_maxNumberOfRows);
+}
+
+Layout ExactValuesJob::ValueLayout(ContinuousFunction* function,
+                                   double abscissa, Context* context,
+                                   bool exactValuesAreActivated) {
+  Preferences* preferences = Preferences::sharedPreferences;
+  Expression result = function->expressionReduced(context).clone();
+  result = result.replaceSymbolWithExpression(
+      Symbol::Builder(Shared::Function::k_unknownName,
+                      strlen(Shared::Function::k_unknownName)),
+      Decimal::Builder<double>(abscissa));
+  bool simplificationFailure = false;
+  PoincareHelpers::CloneAndSimplify(
+      &result, context,
+      {.symbolicComputation =
+           SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined,
+       .unitConversion = UnitConversion::Default},
+      &simplificationFailure);
+  /* Approximate in case of simplification failure, as we cannot display a
+   * non-beautified expression. */
+  Expression approximation =
+      PoincareHelpers::Approximate<double>(result, context);
+  if (simplificationFailure || !exactValuesAreActivated ||
+      ExpressionDisplayPermissions::ShouldOnlyDisplayApproximation(
+          function->originalEquation(), result, approximation, context)) {
+    // Do not show exact expressions in certain cases, use approximate result
+    result = approximation;
+  }
+  return result.createLayout(preferences->displayMode(),
+                             preferences->numberOfSignificantDigits(), context);
+}
+
+bool ExactValuesJob::step() {
+  assert(m_cache);
+  if (m_column == m_cache->numberOfColumns()) {
+    return true;
+  }
+  App* app = App::app();
+  ExpiringPointer<ContinuousFunction> function =
+      app->functionStore()->modelForRecord(m_cache->recordAtColumn(m_column));
+  Interval* interval =
+      app->intervalForSymbolType(function->properties().symbolType());
+  if (m_row >= interval->numberOfElements()) {
+    // Rows beyond the interval will not be displayed again
+    m_cache->discardRows(m_column, m_row);
+    m_column++;
+    m_row = 0;
+    return m_column == m_cache->numberOfColumns();
+  }
+  double abscissa = interval->element(m_row);
+  if (!m_cache->hasLayout(m_column, m_row, abscissa)) {
+    uint64_t start = Ion::Timing::millis();
+    Layout layout =
+        ValueLayout(function.operator->(), abscissa, app->localContext(), true);
+    if (!m_cache->setLayout(m_column, m_row, abscissa, layout)) {
+      // The other rows will be computed when displayed
+      return true;
+    }
+    m_cache->addMillisecondsSpentOnColumn(m_column,
+                                          Ion::Timing::millis() - start);
+  }
+  m_row++;
+  return false;
+}
+
+}  // namespace Graph
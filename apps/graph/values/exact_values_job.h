@@ -0,0 +1,42 @@
+#ifndef GRAPH_EXACT_VALUES_JOB_H
+#define GRAPH_EXACT_VALUES_JOB_H
+
+#include <apps/shared/continuous_function.h>
+#include <poincare/job.h>
+
+#include "exact_values_cache.h"
+
+namespace Graph {
+
+/* Fill an ExactValuesCache with the exact results of its columns, one row per
+ * step, while the values table is idle. Rows already computed by the table
+ * are skipped, and the job ends early if the cache runs out of space. */
+
+class ExactValuesJob : public Poincare::Job {
+ public:
+  ExactValuesJob(ExactValuesCache* cache = nullptr)
+      : m_cache(cache), m_column(0), m_row(0) {}
+
+  float progress() const override;
+
+  /* Layout of the value of function at abscissa, as displayed in the values
+   * table. The abscissa is substituted in the reduced expression of the
+   * function, which is memoized, so that only the substituted expression is
+   * simplified. The approximation is displayed if exact values are not
+   * activated or should not be displayed. */
+  static Poincare::Layout ValueLayout(Shared::ContinuousFunction* function,
+                                      double abscissa,
+                                      Poincare::Context* context,
+                                      bool exactValuesAreActivated);
+
+ private:
+  bool step() override;
+
+  ExactValuesCache* m_cache;
+  int m_column;
+  int m_row;
+};
+
+}  // namespace Graph
+
+#endif
@@ -5,8 +5,8 @@
 #include <apps/shared/poincare_helpers.h>
 #include <assert.h>
 #include <escher/clipboard.h>
+#include <ion/timing.h>
 #include <poincare/circuit_breaker_checkpoint.h>
-#include <poincare/decimal.h>
 #include <poincare/layout_helper.h>
 #include <poincare/matrix_layout.h>
 #include <poincare/serialization_helper.h>
@@ -341,42 +341,36 @@ void ValuesController::createMemoizedLayout(int column, int row, int index) {
   Shared::ExpiringPointer<ContinuousFunction> function =
       functionAtIndex(column, row, &abscissa, &isDerivative);
   Context *context = App::app()->localContext();
-  Expression result;
   if (isDerivative) {
     // Compute derivative approximate result
-    result = Float<double>::Builder(
+    Expression result = Float<double>::Builder(
         function->approximateDerivative(abscissa, context, 0, false));
-  } else {
-    // Compute exact result
-    result = function->expressionReduced(context);
-    VariableContext abscissaContext =
-        VariableContext(Shared::Function::k_unknownName, context);
-    Expression abscissaExpression = Decimal::Builder<double>(abscissa);
-    abscissaContext.setExpressionForSymbolAbstract(
-        abscissaExpression,
-        Symbol::Builder(Shared::Function::k_unknownName,
-                        strlen(Shared::Function::k_unknownName)));
-    bool simplificationFailure = false;
-    PoincareHelpers::CloneAndSimplify(
-        &result, &abscissaContext,
-        {.symbolicComputation =
-             SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined,
-         .unitConversion = UnitConversion::Default},
-        &simplificationFailure);
-    /* Approximate in case of simplification failure, as we cannot display a
-     * non-beautified expression. */
-    Expression approximation =
-        PoincareHelpers::Approximate<double>(result, context);
-    if (simplificationFailure || !m_exactValuesAreActivated ||
-        ExpressionDisplayPermissions::ShouldOnlyDisplayApproximation(
-            function->originalEquation(), result, approximation, context)) {
-      // Do not show exact expressions in certain cases, use approximate result
-      result = approximation;
-    }
+    *memoizedLayoutAtIndex(index) =
+        result.createLayout(preferences->displayMode(),
+                            preferences->numberOfSignificantDigits(), context);
+    return;
+  }
+  int cacheColumn =
+      m_exactValuesAreActivated
+          ? m_exactValuesCache.columnOfRecord(recordAtColumn(column))
+          : -1;
+  // Subtract the title row from row to get the element index
+  int cacheRow = row - 1;
+  if (cacheColumn >= 0 &&
+      m_exactValuesCache.hasLayout(cacheColumn, cacheRow, abscissa)) {
+    *memoizedLayoutAtIndex(index) =
+        m_exactValuesCache.layout(cacheColumn, cacheRow, abscissa);
+    return;
+  }
+  uint64_t start = Ion::Timing::millis();
+  Layout layout = ExactValuesJob::ValueLayout(
+      function.operator->(), abscissa, context, m_exactValuesAreActivated);
+  if (cacheColumn >= 0 && m_exactValuesCache.setLayout(cacheColumn, cacheRow,
+                                                       abscissa, layout)) {
+    m_exactValuesCache.addMillisecondsSpentOnColumn(
+        cacheColumn, Ion::Timing::millis() - start);
   }
-  *memoizedLayoutAtIndex(index) =
-      result.createLayout(preferences->displayMode(),
-                          preferences->numberOfSignificantDigits(), context);
+  *memoizedLayoutAtIndex(index) = layout;
 }
 
 int ValuesController::numberOfColumnsForAbscissaColumn(int column) {
@@ -472,10 +466,40 @@ bool ValuesController::exactValuesButtonAction() {
 }
 
 void ValuesController::activateExactValues(bool activate) {
+  if (activate) {
+    startExactValuesJob();
+  } else {
+    stopExactValuesJob();
+  }
   m_exactValuesAreActivated = activate;
   m_exactValuesButton.setState(m_exactValuesAreActivated);
 }
 
+void ValuesController::startExactValuesJob() {
+  m_exactValuesCache.reset();
+  int n = numberOfColumns();
+  for (int column = 0; column < n; column++) {
+    if (typeAtLocation(column, 0) != k_functionTitleCellType) {
+      continue;
+    }
+    bool isDerivative = false;
+    Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
+    if (!isDerivative && m_exactValuesCache.addColumn(record) < 0) {
+      break;
+    }
+  }
+  m_exactValuesJob = ExactValuesJob(&m_exactValuesCache);
+  App::app()->setBackgroundJob(&m_exactValuesJob);
+}
+
+void ValuesController::stopExactValuesJob() {
+  Escher::App *app = Escher::App::app();
+  if (app && app->backgroundJob() == &m_exactValuesJob) {
+    app->setBackgroundJob(nullptr);
+  }
+  m_exactValuesCache.reset();
+}
+
 Ion::Storage::Record ValuesController::recordAtColumn(int i,
                                                       bool *isDerivative) {
   assert(typeAtLocation(i, 0) == k_functionTitleCellType);
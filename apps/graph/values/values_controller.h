@@ -15,6 +15,8 @@
 #include <omg/round.h>
 
 #include "derivative_parameter_controller.h"
+#include "exact_values_cache.h"
+#include "exact_values_job.h"
 #include "interval_parameter_selector_controller.h"
 
 namespace Graph {
@@ -156,6 +158,9 @@ class ValuesController : public Shared::ValuesController,
   T *parameterController();
   bool exactValuesButtonAction();
   void activateExactValues(bool activate);
+  // Cache the first function columns and start computing them
+  void startExactValuesJob();
+  void stopExactValuesJob();
   Ion::Storage::Record recordAtColumn(int i, bool *isDerivative);
   Shared::ExpiringPointer<Shared::ContinuousFunction> functionAtIndex(
       int column, int row, double *abscissa, bool *isDerivative);
@@ -194,6 +199,8 @@ class ValuesController : public Shared::ValuesController,
   Escher::ToggleableDotView m_exactValuesDotView;
   bool m_exactValuesAreActivated;
   mutable Poincare::Layout m_memoizedLayouts[k_maxNumberOfDisplayableCells];
+  ExactValuesCache m_exactValuesCache;
+  ExactValuesJob m_exactValuesJob;
 };
 
 }  // namespace Graph
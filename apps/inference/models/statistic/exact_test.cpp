@@ -0,0 +1,298 @@
+#include "exact_test.h"
+
+#include <assert.h>
+#include <poincare/helpers.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Inference {
+
+/* Probabilities are only compared through their logarithm. Tables whose
+ * probability is within this relative tolerance of the observed one are
+ * considered equally likely, to be robust to rounding errors. */
+constexpr static double k_logTolerance = 1e-7;
+
+int ExactTest::Random::next(int bound) {
+  assert(bound > 0);
+  // Xorshift32
+  m_state ^= m_state << 13;
+  m_state ^= m_state >> 17;
+  m_state ^= m_state << 5;
+  return static_cast<int>((static_cast<uint64_t>(m_state) * bound) >> 32);
+}
+
+bool ExactTest::setTable(const Table* table, int numberOfRows,
+                         int numberOfColumns) {
+  if (numberOfRows < 2 || numberOfRows > k_maxNumberOfRows ||
+      numberOfColumns < 2 || numberOfColumns > k_maxNumberOfColumns) {
+    return false;
+  }
+  m_numberOfRows = numberOfRows;
+  m_numberOfColumns = numberOfColumns;
+  m_total = 0;
+  for (int col = 0; col < numberOfColumns; col++) {
+    m_columnTotals[col] = 0;
+  }
+  for (int row = 0; row < numberOfRows; row++) {
+    m_rowTotals[row] = 0;
+    for (int col = 0; col < numberOfColumns; col++) {
+      double p = table->parameterAtPosition(row, col);
+      if (!(p >= 0.0 && p <= k_maxTotal && p == std::floor(p))) {
+        // Also excludes NAN
+        return false;
+      }
+      int count = static_cast<int>(p);
+      m_counts[row][col] = count;
+      m_rowTotals[row] += count;
+      m_columnTotals[col] += count;
+      m_total += count;
+      if (m_total > k_maxTotal) {
+        return false;
+      }
+    }
+  }
+  if (m_total == 0) {
+    return false;
+  }
+  computeLogFactorials(m_total);
+  m_logConstant = -logFactorial(m_total);
+  for (int row = 0; row < numberOfRows; row++) {
+    m_logConstant += logFactorial(m_rowTotals[row]);
+  }
+  for (int col = 0; col < numberOfColumns; col++) {
+    m_logConstant += logFactorial(m_columnTotals[col]);
+  }
+  m_logThreshold = logTermOfCounts() + k_logTolerance;
+  return true;
+}
+
+void ExactTest::computeLogFactorials(int total) {
+  assert(total <= k_maxTotal);
+  m_logFactorials[0] = 0.0;
+  for (int n = 1; n <= total; n++) {
+    m_logFactorials[n] = m_logFactorials[n - 1] + std::log(n);
+  }
+}
+
+double ExactTest::logTermOfCounts() const {
+  double logTerm = 0.0;
+  for (int row = 0; row < m_numberOfRows; row++) {
+    for (int col = 0; col < m_numberOfColumns; col++) {
+      logTerm -= logFactorial(m_counts[row][col]);
+    }
+  }
+  return logTerm;
+}
+
+double ExactTest::fisherPValueForTwoByTwo() const {
+  assert(m_numberOfRows == 2 && m_numberOfColumns == 2);
+  // The table only depends on its top left count a
+  int r0 = m_rowTotals[0];
+  int c0 = m_columnTotals[0];
+  int aMin = std::max(0, r0 + c0 - m_total);
+  int aMax = std::min(r0, c0);
+  double sum = 0.0;
+  for (int a = aMin; a <= aMax; a++) {
+    double logTerm = -logFactorial(a) - logFactorial(r0 - a) -
+                     logFactorial(c0 - a) -
+                     logFactorial(m_total - r0 - c0 + a);
+    if (logTerm <= m_logThreshold) {
+      sum += std::exp(m_logConstant + logTerm);
+    }
+  }
+  return std::min(sum, 1.0);
+}
+
+double ExactTest::fisherPValue() {
+  if (m_numberOfRows == 2 && m_numberOfColumns == 2) {
+    return fisherPValueForTwoByTwo();
+  }
+  int rowRemainders[k_maxNumberOfRows];
+  for (int row = 0; row < m_numberOfRows; row++) {
+    rowRemainders[row] = m_rowTotals[row];
+  }
+  m_numberOfVisitedNodes = 0;
+  double sum = 0.0;
+  if (!enumerateFromColumn(0, rowRemainders, 0.0, &sum)) {
+    return NAN;
+  }
+  return std::min(sum, 1.0);
+}
+
+void ExactTest::boundsAfterColumn(int column, const int* rowRemainders,
+                                  double* maxLogTerm,
+                                  double* minLogTerm) const {
+  /* Each remaining column is bounded independently of the others, with the
+   * remaining row totals as the only constraint. Since the actual completions
+   * satisfy more constraints, this bounds their log terms.
+   * - -Σlog(n_i!) is maximal when the column total is evenly spread. This
+   *   ignores the row capacities, which only loosens the bound.
+   * - It is minimal when the column total is concentrated in the rows with
+   *   the largest capacities. */
+  int sortedRemainders[k_maxNumberOfRows];
+  int numberOfNonEmptyRows = 0;
+  for (int row = 0; row < m_numberOfRows; row++) {
+    if (rowRemainders[row] > 0) {
+      sortedRemainders[numberOfNonEmptyRows++] = rowRemainders[row];
+    }
+  }
+  // Sort the remainders in decreasing order
+  Poincare::Helpers::Sort(
+      [](int i, int j, void* context, int numberOfElements) {
+        int* remainders = static_cast<int*>(context);
+        std::swap(remainders[i], remainders[j]);
+      },
+      [](int i, int j, void* context, int numberOfElements) {
+        int* remainders = static_cast<int*>(context);
+        return remainders[i] <= remainders[j];
+      },
+      sortedRemainders, numberOfNonEmptyRows);
+  *maxLogTerm = 0.0;
+  *minLogTerm = 0.0;
+  if (numberOfNonEmptyRows == 0) {
+    return;
+  }
+  for (int col = column; col < m_numberOfColumns; col++) {
+    int columnTotal = m_columnTotals[col];
+    int quotient = columnTotal / numberOfNonEmptyRows;
+    int remainder = columnTotal % numberOfNonEmptyRows;
+    *maxLogTerm -= remainder * logFactorial(quotient + 1) +
+                   (numberOfNonEmptyRows - remainder) * logFactorial(quotient);
+    int left = columnTotal;
+    for (int i = 0; i < numberOfNonEmptyRows && left > 0; i++) {
+      int n = std::min(left, sortedRemainders[i]);
+      *minLogTerm -= logFactorial(n);
+      left -= n;
+    }
+  }
+}
+
+bool ExactTest::enumerateFromColumn(int column, int* rowRemainders,
+                                    double logPrefix, double* sum) {
+  if (++m_numberOfVisitedNodes > k_maxNumberOfVisitedNodes) {
+    return false;
+  }
+  if (column == m_numberOfColumns - 1) {
+    // The last column is entirely determined by the row remainders
+    double logTerm = logPrefix;
+    for (int row = 0; row < m_numberOfRows; row++) {
+      logTerm -= logFactorial(rowRemainders[row]);
+    }
+    if (logTerm <= m_logThreshold) {
+      *sum += std::exp(m_logConstant + logTerm);
+    }
+    return true;
+  }
+  double maxLogTerm, minLogTerm;
+  boundsAfterColumn(column, rowRemainders, &maxLogTerm, &minLogTerm);
+  if (logPrefix + minLogTerm > m_logThreshold) {
+    // All completions are more likely than the observed table
+    return true;
+  }
+  if (logPrefix + maxLogTerm <= m_logThreshold) {
+    /* All completions are at most as likely as the observed table. The sum of
+     * their terms is M!/(Π r_i! Π C_k!), with M the sum of the remainders. */
+    int remainingTotal = 0;
+    double logMass = 0.0;
+    for (int row = 0; row < m_numberOfRows; row++) {
+      remainingTotal += rowRemainders[row];
+      logMass -= logFactorial(rowRemainders[row]);
+    }
+    logMass += logFactorial(remainingTotal);
+    for (int col = column; col < m_numberOfColumns; col++) {
+      logMass -= logFactorial(m_columnTotals[col]);
+    }
+    *sum += std::exp(m_logConstant + logPrefix + logMass);
+    return true;
+  }
+  return enumerateColumnFromRow(column, 0, m_columnTotals[column],
+                                rowRemainders, logPrefix, sum);
+}
+
+bool ExactTest::enumerateColumnFromRow(int column, int row,
+                                       int columnRemainder, int* rowRemainders,
+                                       double logPrefix, double* sum) {
+  if (row == m_numberOfRows - 1) {
+    int n = columnRemainder;
+    if (n > rowRemainders[row]) {
+      return true;
+    }
+    rowRemainders[row] -= n;
+    bool completed = enumerateFromColumn(column + 1, rowRemainders,
+                                         logPrefix - logFactorial(n), sum);
+    rowRemainders[row] += n;
+    return completed;
+  }
+  // The next rows must be able to hold what is left of the column
+  int capacityOfNextRows = 0;
+  for (int i = row + 1; i < m_numberOfRows; i++) {
+    capacityOfNextRows += rowRemainders[i];
+  }
+  int nMin = std::max(0, columnRemainder - capacityOfNextRows);
+  int nMax = std::min(rowRemainders[row], columnRemainder);
+  for (int n = nMin; n <= nMax; n++) {
+    rowRemainders[row] -= n;
+    bool completed = enumerateColumnFromRow(
+        column, row + 1, columnRemainder - n, rowRemainders,
+        logPrefix - logFactorial(n), sum);
+    rowRemainders[row] += n;
+    if (!completed) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double ExactTest::monteCarloPValue(int numberOfResamples, uint32_t seed) {
+  assert(numberOfResamples > 0);
+  Random random(seed);
+  int numberOfUnlikelyTables = 0;
+  for (int sample = 0; sample < numberOfResamples; sample++) {
+    /* Draw a random table with the same totals, which follows the
+     * hypergeometric distribution : individuals are dealt one by one to the
+     * columns, and their row is drawn among the individuals left. */
+    int rowRemainders[k_maxNumberOfRows];
+    for (int row = 0; row < m_numberOfRows; row++) {
+      rowRemainders[row] = m_rowTotals[row];
+    }
+    int remainingTotal = m_total;
+    double logTerm = 0.0;
+    for (int col = 0; col < m_numberOfColumns - 1; col++) {
+      int column[k_maxNumberOfRows] = {};
+      for (int k = 0; k < m_columnTotals[col]; k++) {
+        int individual = random.next(remainingTotal);
+        int row = 0;
+        while (individual >= rowRemainders[row]) {
+          individual -= rowRemainders[row];
+          row++;
+        }
+        assert(row < m_numberOfRows);
+        rowRemainders[row]--;
+        column[row]++;
+        remainingTotal--;
+      }
+      for (int row = 0; row < m_numberOfRows; row++) {
+        logTerm -= logFactorial(column[row]);
+      }
+    }
+    for (int row = 0; row < m_numberOfRows; row++) {
+      logTerm -= logFactorial(rowRemainders[row]);
+    }
+    numberOfUnlikelyTables += logTerm <= m_logThreshold;
+  }
+  // The observed table counts as one of the samples
+  return (1.0 + numberOfUnlikelyTables) / (1.0 + numberOfResamples);
+}
+
+double ExactTest::pValue(Method* method, int numberOfResamples) {
+  double p = fisherPValue();
+  if (!std::isnan(p)) {
+    *method = Method::Fisher;
+    return p;
+  }
+  *method = Method::MonteCarlo;
+  return monteCarloPValue(numberOfResamples);
+}
+
+}  // namespace Inference
@@ -0,0 +1,94 @@
+#ifndef INFERENCE_MODELS_STATISTIC_EXACT_TEST_H
+#define INFERENCE_MODELS_STATISTIC_EXACT_TEST_H
+
+#include <stdint.h>
+
+#include "table.h"
+
+namespace Inference {
+
+/* Exact tests of independence on a contingency table of counts, which remain
+ * valid when expected counts are too small for the chi2 approximation.
+ * Both tests compare the hypergeometric probability of the observed table
+ * against the probabilities of all tables with the same row and column totals:
+ * the p-value is the total probability of the tables that are at most as
+ * likely as the observed one.
+ * - Fisher's exact test enumerates these tables. The enumeration fills one
+ *   column at a time and bounds the probability of all completions of the
+ *   current columns, so that whole subtrees are either summed in closed form
+ *   or discarded without being enumerated.
+ * - The Monte Carlo permutation test draws random tables with the same totals
+ *   and counts how many of them are at most as likely as the observed one. */
+
+class ExactTest {
+ public:
+  constexpr static int k_maxNumberOfRows = 9;
+  constexpr static int k_maxNumberOfColumns = 9;
+  // Beyond this total, the chi2 approximation is accurate enough.
+  constexpr static int k_maxTotal = 500;
+  constexpr static int k_defaultNumberOfResamples = 2000;
+  /* Limit the enumeration so that it completes within an interactive delay.
+   * Above that, the Monte Carlo estimate is used instead. */
+  constexpr static int k_maxNumberOfVisitedNodes = 100000;
+
+  enum class Method : uint8_t { Fisher, MonteCarlo };
+
+  /* Returns false if the table contains values that are not counts, or if the
+   * total is too large for the exact tests. */
+  bool setTable(const Table* table, int numberOfRows, int numberOfColumns);
+
+  // Return NAN if the enumeration exceeded k_maxNumberOfVisitedNodes
+  double fisherPValue();
+  double monteCarloPValue(int numberOfResamples, uint32_t seed = 0x2545F491);
+  /* Fisher's exact test if it completes, Monte Carlo permutation test
+   * otherwise. */
+  double pValue(Method* method,
+                int numberOfResamples = k_defaultNumberOfResamples);
+
+ private:
+  class Random {
+   public:
+    Random(uint32_t seed) : m_state(seed == 0 ? 1 : seed) {}
+    // Uniform in [0, bound[
+    int next(int bound);
+
+   private:
+    uint32_t m_state;
+  };
+
+  double logFactorial(int n) const {
+    assert(0 <= n && n <= k_maxTotal);
+    return m_logFactorials[n];
+  }
+  void computeLogFactorials(int total);
+  // Log of the hypergeometric probability of m_counts without the constant
+  double logTermOfCounts() const;
+  double fisherPValueForTwoByTwo() const;
+  // Bounds on the log term of any completion of the columns from column on
+  void boundsAfterColumn(int column, const int* rowRemainders,
+                         double* maxLogTerm, double* minLogTerm) const;
+  /* Sum the probabilities of the completions of the table, whose first
+   * columns are already filled. */
+  bool enumerateFromColumn(int column, int* rowRemainders, double logPrefix,
+                           double* sum);
+  bool enumerateColumnFromRow(int column, int row, int columnRemainder,
+                              int* rowRemainders, double logPrefix,
+                              double* sum);
+
+  int m_counts[k_maxNumberOfRows][k_maxNumberOfColumns];
+  int m_rowTotals[k_maxNumberOfRows];
+  int m_columnTotals[k_maxNumberOfColumns];
+  int m_numberOfRows;
+  int m_numberOfColumns;
+  int m_total;
+  // Log of the constant factor of the probabilities : Π R_i! Π C_j! / N!
+  double m_logConstant;
+  // Tables with a log term below this threshold are at most as likely
+  double m_logThreshold;
+  int m_numberOfVisitedNodes;
+  double m_logFactorials[k_maxTotal + 1];
+};
+
+}  // namespace Inference
+
+#endif
@@ -6,7 +6,10 @@
 
 namespace Inference {
 
-HomogeneityTest::HomogeneityTest() {
+HomogeneityTest::HomogeneityTest()
+    : m_exactPValue(NAN),
+      m_exactTestMethod(ExactTest::Method::Fisher),
+      m_numberOfResamples(ExactTest::k_defaultNumberOfResamples) {
   for (int i = 0; i < numberOfStatisticParameters(); i++) {
     m_input[i] = k_undefinedValue;
     m_expectedValues[i] = k_undefinedValue;
@@ -56,6 +59,28 @@ void HomogeneityTest::compute() {
   m_testCriticalValue = computeChi2();
   m_degreesOfFreedom = computeDegreesOfFreedom(max);
   m_pValue = SignificanceTest::ComputePValue(this);
+  ExactTest exactTest;
+  m_exactPValue =
+      exactTest.setTable(this, max.row, max.col)
+          ? exactTest.pValue(&m_exactTestMethod, m_numberOfResamples)
+          : NAN;
+}
+
+void HomogeneityTest::resultAtIndex(int index, double* value,
+                                    Poincare::Layout* message,
+                                    I18n::Message* subMessage,
+                                    int* precision) {
+  if (index < Chi2Test::numberOfResults()) {
+    Chi2Test::resultAtIndex(index, value, message, subMessage, precision);
+    return;
+  }
+  assert(hasExactPValue() && index == Chi2Test::numberOfResults());
+  *value = m_exactPValue;
+  *message = Poincare::LayoutHelper::String(
+      I18n::translate(I18n::Message::ExactPValue));
+  *subMessage = m_exactTestMethod == ExactTest::Method::Fisher
+                    ? I18n::Message::FisherExactTest
+                    : I18n::Message::PermutationTest;
 }
 
 double HomogeneityTest::expectedValueAtLocation(int row, int column) {
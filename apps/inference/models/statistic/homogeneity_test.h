@@ -2,6 +2,7 @@
 #define INFERENCE_MODELS_STATISTIC_HOMOGENEITY_TEST_H
 
 #include "chi2_test.h"
+#include "exact_test.h"
 
 namespace Inference {
 
@@ -24,6 +25,11 @@ class HomogeneityTest final : public Chi2Test {
   bool validateInputs() override;
   // Test
   void compute() override;
+  int numberOfResults() const override {
+    return Chi2Test::numberOfResults() + hasExactPValue();
+  }
+  void resultAtIndex(int index, double* value, Poincare::Layout* message,
+                     I18n::Message* subMessage, int* precision) override;
 
   // Chi2Test
   bool deleteParameterAtPosition(int row, int column) override;
@@ -44,6 +50,16 @@ class HomogeneityTest final : public Chi2Test {
   double rowTotal(int row) { return m_rowTotals[row]; }
   double columnTotal(int column) { return m_columnTotals[column]; }
 
+  /* The chi2 approximation is wrong for small expected counts, so an exact
+   * p-value is computed along with it when the table is small enough. */
+  bool hasExactPValue() const { return !std::isnan(m_exactPValue); }
+  double exactPValue() const { return m_exactPValue; }
+  ExactTest::Method exactTestMethod() const { return m_exactTestMethod; }
+  void setNumberOfResamples(int numberOfResamples) {
+    assert(numberOfResamples > 0);
+    m_numberOfResamples = numberOfResamples;
+  }
+
  private:
   bool authorizedParameterAtIndex(double p, int i) const override;
   Index2D resultsIndexToIndex2D(int resultsIndex) const;
@@ -66,6 +82,9 @@ class HomogeneityTest final : public Chi2Test {
   double m_rowTotals[k_maxNumberOfRows];
   double m_columnTotals[k_maxNumberOfColumns];
   double m_total;
+  double m_exactPValue;
+  ExactTest::Method m_exactTestMethod;
+  int m_numberOfResamples;
   int m_numberOfResultRows;
   int m_numberOfResultColumns;
 };
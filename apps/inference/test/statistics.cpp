@@ -586,9 +586,53 @@ QUIZ_CASE(probability_homogeneity_test) {
       double real = expectedValues[i][j];
       assert_roughly_equal(real, expected, 1E-4, true);
     }
+    quiz_assert(test.hasExactPValue());
+    quiz_assert(test.exactTestMethod() == ExactTest::Method::Fisher);
+    assert_roughly_equal(test.exactPValue(), 0.5632251587, 1E-9);
   }
 }
 
+void assert_exact_test_is(const double* counts, int numberOfRows,
+                          int numberOfColumns, double fisherPValue) {
+  HomogeneityTest table;
+  table.initParameters();
+  for (int row = 0; row < numberOfRows; row++) {
+    for (int col = 0; col < numberOfColumns; col++) {
+      table.setParameterAtPosition(counts[row * numberOfColumns + col], row,
+                                   col);
+    }
+  }
+  ExactTest exactTest;
+  quiz_assert(exactTest.setTable(&table, numberOfRows, numberOfColumns));
+  assert_roughly_equal(exactTest.fisherPValue(), fisherPValue, 1E-9);
+  ExactTest::Method method;
+  assert_roughly_equal(exactTest.pValue(&method), fisherPValue, 1E-9);
+  quiz_assert(method == ExactTest::Method::Fisher);
+  // The seed is fixed so the estimate is deterministic
+  double estimate = exactTest.monteCarloPValue(4000);
+  quiz_assert(std::fabs(estimate - fisherPValue) < 0.03);
+}
+
+QUIZ_CASE(probability_exact_test) {
+  // Lady tasting tea
+  constexpr double teaTasting[] = {3, 1, 1, 3};
+  assert_exact_test_is(teaTasting, 2, 2, 0.4857142857);
+  constexpr double twoByThree[] = {2, 0, 3, 1, 4, 0};
+  assert_exact_test_is(twoByThree, 2, 3, 0.0476190476);
+  constexpr double threeByThree[] = {1, 2, 4, 2, 5, 5, 4, 3, 2};
+  assert_exact_test_is(threeByThree, 3, 3, 0.5632251587);
+
+  // Values that are not counts
+  HomogeneityTest table;
+  table.initParameters();
+  constexpr double notCounts[] = {1.5, 2, 3, 4};
+  for (int i = 0; i < 4; i++) {
+    table.setParameterAtPosition(notCounts[i], i / 2, i % 2);
+  }
+  ExactTest exactTest;
+  quiz_assert(!exactTest.setTable(&table, 2, 2));
+}
+
 QUIZ_CASE(probability_slope_t_statistic) {
   Shared::GlobalContext context;
   StatisticTestCase testCase;
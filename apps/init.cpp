@@ -13,4 +13,11 @@ void Init() {
   ::AppsContainerStorage::sharedAppsContainerStorage.init();
 }
 
+void Shutdown() {
+  ::AppsContainerStorage::sharedAppsContainerStorage.deinit();
+  ::Shared::GlobalContext::continuousFunctionStore.deinit();
+  ::Shared::GlobalContext::sequenceStore.deinit();
+  ::GlobalPreferences::sharedGlobalPreferences.deinit();
+}
+
 }  // namespace Apps
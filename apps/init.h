@@ -4,6 +4,8 @@
 namespace Apps {
 
 void Init();
+// Destroy what Init created, so that Init can be called again
+void Shutdown();
 
 }
 
@@ -43,22 +43,32 @@ Layout Model::equationLayout(
 }
 
 Poincare::Expression Model::expression(double* modelCoefficients) const {
-  for (int i = 0; i < numberOfCoefficients(); i++) {
-    if (std::isnan(modelCoefficients[i])) {
-      return Expression();
-    }
+  if (!coefficientsAreDefined(modelCoefficients)) {
+    return Expression();
   }
   return privateExpression(modelCoefficients);
 }
 
 double Model::levelSet(double* modelCoefficients, double xMin, double xMax,
                        double y, Poincare::Context* context) {
-  Expression e = expression(modelCoefficients);
-  if (e.isUninitialized()) {
+  if (!coefficientsAreDefined(modelCoefficients)) {
     return NAN;
   }
-  return PoincareHelpers::Solver(xMin, xMax, "x", context)
-      .nextIntersection(Number::DecimalNumber(y), e)
+  /* The solver runs on evaluate rather than on the expression of the model,
+   * which it would approximate at each step. */
+  struct LevelSetParameters {
+    const Model* model;
+    double* modelCoefficients;
+    double y;
+  };
+  const LevelSetParameters parameters = {this, modelCoefficients, y};
+  Solver<double>::FunctionEvaluation evaluation = [](double x,
+                                                     const void* aux) {
+    const LevelSetParameters* p = static_cast<const LevelSetParameters*>(aux);
+    return p->model->evaluate(p->modelCoefficients, x) - p->y;
+  };
+  return PoincareHelpers::Solver(xMin, xMax)
+      .nextRoot(evaluation, &parameters)
       .x();
 }
 
@@ -79,6 +89,15 @@ void Model::privateFit(Store* store, int series, double* modelCoefficients,
   uniformizeCoefficientsFromFit(modelCoefficients);
 }
 
+bool Model::coefficientsAreDefined(double* modelCoefficients) const {
+  for (int i = 0; i < numberOfCoefficients(); i++) {
+    if (std::isnan(modelCoefficients[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool Model::dataSuitableForFit(Store* store, int series) const {
   if (!store->seriesNumberOfAbscissaeGreaterOrEqualTo(series,
                                                       numberOfCoefficients())) {
@@ -72,6 +72,8 @@ class Model {
       Poincare::Expression e1, Poincare::Expression e2, bool addition);
 
  private:
+  bool coefficientsAreDefined(double* modelCoefficients) const;
+
   // Model attributes
   virtual double partialDerivate(double* modelCoefficients,
                                  int derivateCoefficientIndex, double x) const {
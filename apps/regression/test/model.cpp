@@ -1,9 +1,11 @@
 #include "../model/model.h"
 
 #include <apps/shared/global_context.h>
+#include <apps/shared/poincare_helpers.h>
 #include <apps/shared/store_context.h>
 #include <assert.h>
 #include <poincare/helpers.h>
+#include <poincare/number.h>
 #include <poincare/test/helper.h>
 #include <poincare/trigonometry.h>
 #include <quiz.h>
@@ -679,3 +681,36 @@ QUIZ_CASE(regression_calculation) {
   assert_regression_calculations_is(x, y, std::size(x), covariance, productSum,
                                     r);
 }
+
+QUIZ_CASE(regression_evaluate_and_expression) {
+  /* evaluate is the kernel of the model, on which the curve is drawn and the
+   * level sets are solved, while the expression is built for display. Both
+   * must give the same values. */
+  Shared::GlobalContext globalContext;
+  Shared::DoublePairStorePreferences storePreferences;
+  Model::Type regressionTypes[] = {Model::Type::None, Model::Type::None,
+                                   Model::Type::None};
+  Regression::Store store(&globalContext, &storePreferences, regressionTypes);
+  double coefficients[Model::k_maxNumberOfCoefficients] = {1.5, 0.75, 2.0,
+                                                           0.5, 1.25};
+  ApproximationContext approximationContext(&globalContext);
+  for (int type = 1; type < Model::k_numberOfModels; type++) {
+    Model* model = store.regressionModel(static_cast<Model::Type>(type));
+    Expression e = model->expression(coefficients);
+    for (double x = 0.25; x < 5.0; x += 0.25) {
+      quiz_assert(roughly_equal(model->evaluate(coefficients, x),
+                                e.approximateWithValueForSymbol<double>(
+                                    "x", x, approximationContext),
+                                1e-12));
+    }
+    double y = model->evaluate(coefficients, 2.0);
+    double x = model->levelSet(coefficients, 1.5, 2.5, y, &globalContext);
+    quiz_assert(roughly_equal(x, 2.0, 1e-9));
+    quiz_assert(roughly_equal(
+        x,
+        Shared::PoincareHelpers::Solver(1.5, 2.5, "x", &globalContext)
+            .nextIntersection(Number::DecimalNumber(y), e)
+            .x(),
+        1e-9));
+  }
+}
@@ -24,6 +24,7 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index,
   int x = xMin;
   while ((x = nextDotIndex(s, x)) <= xMax) {
     float y = s->evaluateXYAtParameter(static_cast<float>(x), context()).y();
+    countEvaluation();
     if (std::isnan(y)) {
       continue;
     }
@@ -0,0 +1,115 @@
+#include "auto_zoom_job.h"
+
+#include <assert.h>
+
+#include <cmath>
+
+using namespace Poincare;
+
+namespace Shared {
+
+AutoZoomJob::AutoZoomJob(InteractiveCurveViewRange* range,
+                         InteractiveCurveViewRangeDelegate* delegate)
+    : m_range(range),
+      m_delegate(delegate),
+      m_estimatedRange(range ? DisplayedRange(range) : Range2D()),
+      m_optimalRange(),
+      m_displayedRange(m_estimatedRange),
+      m_zoom(NAN, NAN, InteractiveCurveViewRange::NormalYXRatio(), nullptr,
+             InteractiveCurveViewRange::k_maxFloat),
+      m_samplingStep(0),
+      m_frame(0),
+      m_xAuto(range && range->xAuto()),
+      m_yAuto(range && range->yAuto()) {}
+
+float AutoZoomJob::progress() const {
+  if (!isRunning()) {
+    return 1.f;
+  }
+  return static_cast<float>(m_frame) / (k_numberOfAnimationFrames + 1);
+}
+
+void AutoZoomJob::finish() {
+  assert(m_range && m_delegate);
+  if (isRunning() && !rangeHasBeenChanged()) {
+    if (m_frame == 0) {
+      m_range->computeRanges();
+      m_delegate->didRefineRange();
+    } else {
+      setRange(m_optimalRange);
+    }
+  }
+  cancel();
+}
+
+Range2D AutoZoomJob::DisplayedRange(const InteractiveCurveViewRange* range) {
+  return Range2D(range->xMin(), range->xMax(), range->yMin(), range->yMax());
+}
+
+bool AutoZoomJob::ChangesMaterially(Range1D from, Range1D to) {
+  float threshold = k_materialChange * from.length();
+  return std::fabs(to.min() - from.min()) > threshold ||
+         std::fabs(to.max() - from.max()) > threshold;
+}
+
+Range1D AutoZoomJob::Interpolate(Range1D from, Range1D to, float ratio) {
+  return Range1D(from.min() + ratio * (to.min() - from.min()),
+                 from.max() + ratio * (to.max() - from.max()),
+                 InteractiveCurveViewRange::k_maxFloat);
+}
+
+bool AutoZoomJob::step() {
+  assert(m_range && m_delegate);
+  if (rangeHasBeenChanged()) {
+    return true;
+  }
+  if (m_frame == 0) {
+    Zoom zoom = m_zoom;
+    if (!m_range->computeOptimalRanges(m_samplingStep, &zoom, m_xAuto,
+                                       m_yAuto)) {
+      // Commit the step
+      m_zoom = zoom;
+      m_samplingStep++;
+      return false;
+    }
+    m_optimalRange = DisplayedRange(m_range);
+    m_frame = 1;
+    if (!ChangesMaterially(*m_estimatedRange.x(), *m_optimalRange.x()) &&
+        !ChangesMaterially(*m_estimatedRange.y(), *m_optimalRange.y())) {
+      setRange(m_optimalRange);
+      return true;
+    }
+    // The animation starts from the estimate, which is still displayed
+    setRange(m_estimatedRange);
+    return false;
+  }
+  Range2D frame = m_optimalRange;
+  if (m_frame < k_numberOfAnimationFrames) {
+    // Ease out, so that the curves settle slowly on the final range
+    float t = static_cast<float>(m_frame) / k_numberOfAnimationFrames;
+    float ratio = t * (2.f - t);
+    frame =
+        Range2D(Interpolate(*m_estimatedRange.x(), *m_optimalRange.x(), ratio),
+                Interpolate(*m_estimatedRange.y(), *m_optimalRange.y(), ratio));
+  }
+  setRange(frame);
+  endSlice();
+  return m_frame++ == k_numberOfAnimationFrames;
+}
+
+void AutoZoomJob::didRollBackStep(TreeNode* endOfPoolBeforeStep) {
+  m_delegate->tidyModels(endOfPoolBeforeStep);
+}
+
+bool AutoZoomJob::rangeHasBeenChanged() const {
+  return m_range->xAuto() != m_xAuto || m_range->yAuto() != m_yAuto ||
+         DisplayedRange(m_range) != m_displayedRange;
+}
+
+void AutoZoomJob::setRange(Range2D range) {
+  m_range->setAnimatedRange(range);
+  m_displayedRange = DisplayedRange(m_range);
+  m_delegate->didRefineRange();
+}
+
+}  // namespace Shared
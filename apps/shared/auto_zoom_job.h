@@ -0,0 +1,67 @@
+#ifndef SHARED_AUTO_ZOOM_JOB_H
+#define SHARED_AUTO_ZOOM_JOB_H
+
+#include <poincare/job.h>
+#include <poincare/range.h>
+#include <poincare/zoom.h>
+
+#include "interactive_curve_view_range.h"
+
+namespace Shared {
+
+/* Refine the auto range of an InteractiveCurveViewRange while the graph is
+ * idle, once computeEstimatedRanges has displayed the estimate of its
+ * delegate. The first steps sample the curves with the steps of the optimal
+ * range of the delegate, e.g. one curve per step, so that the curves sampled
+ * before a key press are not sampled again. If the range they find differs
+ * materially from the estimate, the next steps animate the range towards it,
+ * one frame per slice. The frames are
+ * counted in steps rather than in milliseconds, so that the frames drawn do
+ * not depend on the speed of the device.
+ * The job ends early if the range is changed in the meantime, e.g. by a zoom
+ * from the Navigate menu. */
+
+class AutoZoomJob : public Poincare::Job {
+ public:
+  AutoZoomJob(InteractiveCurveViewRange* range = nullptr,
+              InteractiveCurveViewRangeDelegate* delegate = nullptr);
+
+  float progress() const override;
+  /* Set the final range at once, computing it if it has not been sampled yet,
+   * and cancel the job. */
+  void finish();
+
+ private:
+  constexpr static int k_numberOfAnimationFrames = 8;
+  // Fraction of the length of an axis that a bound must move to be animated
+  constexpr static float k_materialChange = 0.05f;
+
+  static Poincare::Range2D DisplayedRange(
+      const InteractiveCurveViewRange* range);
+  static bool ChangesMaterially(Poincare::Range1D from, Poincare::Range1D to);
+  static Poincare::Range1D Interpolate(Poincare::Range1D from,
+                                       Poincare::Range1D to, float ratio);
+
+  bool step() override;
+  void didRollBackStep(Poincare::TreeNode* endOfPoolBeforeStep) override;
+  bool rangeHasBeenChanged() const;
+  void setRange(Poincare::Range2D range);
+
+  InteractiveCurveViewRange* m_range;
+  InteractiveCurveViewRangeDelegate* m_delegate;
+  Poincare::Range2D m_estimatedRange;
+  Poincare::Range2D m_optimalRange;
+  // Range set by the last step, to detect the changes made in the meantime
+  Poincare::Range2D m_displayedRange;
+  // Sampling carried from one step of the optimal range to the next
+  Poincare::Zoom m_zoom;
+  int m_samplingStep;
+  // 0 until the curves have been sampled, then the next frame to draw
+  int m_frame;
+  bool m_xAuto;
+  bool m_yAuto;
+};
+
+}  // namespace Shared
+
+#endif
@@ -283,9 +283,16 @@ double ContinuousFunction::approximateDerivative(double x, Context *context,
       numberOfSubCurves() > 1) {
     return NAN;
   }
+  assert(subCurveIndex == 0);
+  /* The tape gives the derivative without building it, but may fail where the
+   * expression is not real. */
+  const DerivativeTape *tape = derivativeTape(context);
+  DerivativeTape::Jet<double> jet;
+  if (tape && tape->evaluate<double>(x, &jet)) {
+    return jet.firstDerivative;
+  }
   // Derivative is simplified once and for all
   Expression derivate = expressionDerivateReduced(context);
-  assert(subCurveIndex == 0);
   ApproximationContext approximationContext(context, complexFormat(context));
   return derivate.approximateWithValueForSymbol(k_unknownName, x,
                                                 approximationContext);
@@ -623,10 +630,27 @@ Poincare::Expression ContinuousFunction::Model::expressionApproximated(
          .target = ReductionTarget::SystemForApproximation,
          .symbolicComputation = SymbolicComputation::DoNotReplaceAnySymbol});
     m_expressionApproximated = e;
+    m_derivativeTape.reset();
   }
   return m_expressionApproximated;
 }
 
+const DerivativeTape *ContinuousFunction::Model::derivativeTape(
+    const Ion::Storage::Record *record, Context *context) const {
+  Expression e = expressionApproximated(record, context);
+  Preferences::ComplexFormat format = complexFormat(record, context);
+  Preferences::AngleUnit angleUnit =
+      Preferences::sharedPreferences->angleUnit();
+  if (!m_derivativeTape.isCompiledFor(format, angleUnit)) {
+    if (numberOfSubCurves(record) > 1) {
+      return nullptr;
+    }
+    m_derivativeTape.compile(e, k_unknownName,
+                             ApproximationContext(context, format, angleUnit));
+  }
+  return m_derivativeTape.isCompiled() ? &m_derivativeTape : nullptr;
+}
+
 Poincare::Expression ContinuousFunction::Model::expressionReducedForAnalysis(
     const Ion::Storage::Record *record, Poincare::Context *context) const {
   ContinuousFunctionProperties::SymbolType computedFunctionSymbol =
@@ -948,6 +972,7 @@ void ContinuousFunction::Model::tidyDownstreamPoolFrom(
   if (treePoolCursor == nullptr ||
       m_expressionApproximated.isDownstreamOf(treePoolCursor)) {
     m_expressionApproximated = Expression();
+    m_derivativeTape.reset();
   }
   ExpressionModel::tidyDownstreamPoolFrom(treePoolCursor);
 }
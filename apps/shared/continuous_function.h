@@ -12,6 +12,7 @@
 #include <apps/i18n.h>
 #include <poincare/comparison.h>
 #include <poincare/conic.h>
+#include <poincare/derivative_tape.h>
 #include <poincare/preferences.h>
 #include <poincare/symbol_abstract.h>
 
@@ -116,6 +117,12 @@ class ContinuousFunction : public Function {
       Poincare::Context *context) const {
     return m_model.expressionApproximated(this, context);
   }
+  /* Return the tape of the derivatives of expressionApproximated, or nullptr
+   * if it does not handle one of its nodes */
+  const Poincare::DerivativeTape *derivativeTape(
+      Poincare::Context *context) const {
+    return m_model.derivativeTape(this, context);
+  }
 
   /* Evaluation */
 
@@ -326,6 +333,9 @@ class ContinuousFunction : public Function {
     // Return the derivative of the expression to plot.
     Poincare::Expression expressionDerivateReduced(
         const Ion::Storage::Record *record, Poincare::Context *context) const;
+    // Return the tape of the derivatives of the expression to plot.
+    const Poincare::DerivativeTape *derivativeTape(
+        const Ion::Storage::Record *record, Poincare::Context *context) const;
     // Rename the record if needed. Record pointer might get corrupted.
     Ion::Storage::Record::ErrorStatus renameRecordIfNeeded(
         Ion::Storage::Record *record, Poincare::Context *context) const;
@@ -357,6 +367,8 @@ class ContinuousFunction : public Function {
      */
     mutable Poincare::Expression m_expressionApproximated;
     mutable Poincare::Expression m_expressionDerivate;
+    // Compiled from m_expressionApproximated
+    mutable Poincare::DerivativeTape m_derivativeTape;
   };
 
   // Return model pointer
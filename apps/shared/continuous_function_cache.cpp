@@ -2,6 +2,7 @@
 
 #include <limits.h>
 #include <omg/signaling_nan.h>
+#include <poincare/worker_pool.h>
 
 #include "continuous_function.h"
 
@@ -65,6 +66,48 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valueForParameter(
   return valuesAtIndex(function, context, t, resIndex, curveIndex);
 }
 
+void ContinuousFunctionCache::fill(const ContinuousFunction *function,
+                                   Poincare::Context *context, float tMax) {
+  assert(function->cache() == this &&
+         Poincare::WorkerPool::NumberOfWorkers() > 0);
+  if (!function->properties().isCartesian() || m_tStep == 0.f) {
+    return;
+  }
+  /* The curve is drawn with half the step of the cache, so its dots are on the
+   * even indexes, at the same parameters as in CurveDrawing::draw. The first
+   * dot, which is shifted by FLT_EPSILON, and the odd indexes, which are only
+   * evaluated between distant dots, are left to the curve. */
+  float drawingStep = 2.f * m_tStep;
+  float parameters[k_sizeOfCache / 2];
+  float values[k_sizeOfCache / 2];
+  int numberOfParameters = 0;
+  for (int i = 1; 2 * i < k_sizeOfCache; i++) {
+    float t = m_tMin + i * drawingStep;
+    if (t >= tMax) {
+      break;
+    }
+    int index = indexForParameter(function, t, 0);
+    if (index >= 0 && OMG::IsSignalingNan(m_cache[index]) &&
+        t >= function->tMin() && t <= function->tMax()) {
+      parameters[numberOfParameters++] = t;
+    }
+  }
+  if (numberOfParameters == 0) {
+    return;
+  }
+  Poincare::Expression e = function->expressionApproximated(context);
+  if (function->numberOfSubCurves() >= 2) {
+    e = e.childAtIndex(0);
+  }
+  e.approximateWithValuesForSymbol<float>(
+      Function::k_unknownName, parameters, values, numberOfParameters,
+      Poincare::ApproximationContext(context,
+                                     function->complexFormat(context)));
+  for (int i = 0; i < numberOfParameters; i++) {
+    m_cache[indexForParameter(function, parameters[i], 0)] = values[i];
+  }
+}
+
 void ContinuousFunctionCache::ComputeNonCartesianSteps(float *tStep,
                                                        float *tCacheStep,
                                                        float tMax, float tMin) {
@@ -22,6 +22,11 @@ class ContinuousFunctionCache {
   Poincare::Coordinate2D<float> valueForParameter(
       const ContinuousFunction* function, Poincare::Context* context, float t,
       int curveIndex);
+  /* Approximate a cartesian function at once on the dots of its curve up to
+   * tMax, with the workers of the WorkerPool. It should only be called when
+   * there are workers, since the curve only evaluates the dots it needs. */
+  void fill(const ContinuousFunction* function, Poincare::Context* context,
+            float tMax);
   // Sets step parameters for non-cartesian curves
   static void ComputeNonCartesianSteps(float* tStep, float* tCacheStep,
                                        float tMax, float tMin);
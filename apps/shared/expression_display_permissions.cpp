@@ -43,6 +43,28 @@ bool NeverDisplayReductionOfInput(Expression input, Context* context) {
       context);
 }
 
+bool ReductionOfInputCanBeSkipped(Expression input, Context* context) {
+  /* The reduction is still needed:
+   * - to perform stores and unit conversions, and to handle units,
+   * - to replace the symbols with their definitions,
+   * - to compute derivatives formally, which makes their approximation more
+   *   precise,
+   * - to approximate lists and matrices element by element. */
+  return NeverDisplayReductionOfInput(input, context) && !input.hasUnit() &&
+         !input.deepIsOfType({
+             ExpressionNode::Type::Store,
+             ExpressionNode::Type::UnitConvert,
+             ExpressionNode::Type::ConstantPhysics,
+             ExpressionNode::Type::Derivative,
+             ExpressionNode::Type::List,
+             ExpressionNode::Type::ListSequence,
+             ExpressionNode::Type::RandintNoRepeat,
+             ExpressionNode::Type::Matrix,
+         }) &&
+         !input.deepIsSymbolic(nullptr,
+                               SymbolicComputation::DoNotReplaceAnySymbol);
+}
+
 static bool isPrimeFactorization(Expression expression) {
   /* A prime factorization can only be built with integers, powers of integers,
    * and a multiplication. */
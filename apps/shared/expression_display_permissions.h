@@ -11,6 +11,12 @@ namespace ExpressionDisplayPermissions {
 bool NeverDisplayReductionOfInput(Poincare::Expression input,
                                   Poincare::Context* context);
 
+/* The input is only displayed through its approximation, which can be computed
+ * without reducing it first. This is stricter than NeverDisplayReductionOfInput
+ * and is used by the calculation app to skip the reduction. */
+bool ReductionOfInputCanBeSkipped(Poincare::Expression input,
+                                  Poincare::Context* context);
+
 bool ShouldOnlyDisplayApproximation(Poincare::Expression input,
                                     Poincare::Expression exactOutput,
                                     Poincare::Expression approximateOutput,
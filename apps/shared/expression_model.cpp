@@ -167,7 +167,8 @@ Ion::Storage::Record::ErrorStatus ExpressionModel::setExpressionContent(
   size_t previousDataSize = newData.size;
   size_t newDataSize =
       previousDataSize - previousExpressionSize + newExpressionSize;
-  void* expAddress = expressionAddress(record);
+  size_t expressionOffset = static_cast<char*>(expressionAddress(record)) -
+                            static_cast<const char*>(newData.buffer);
   // Update size of record to maximal size between previous and new data
   newData.size = std::max(previousDataSize, newDataSize);
   Ion::Storage::Record::ErrorStatus error = record->setValue(newData);
@@ -177,6 +178,10 @@ Ion::Storage::Record::ErrorStatus ExpressionModel::setExpressionContent(
            error == Ion::Storage::Record::ErrorStatus::CanceledByDelegate);
     return error;
   }
+  // Resizing the record may have moved it
+  newData.buffer = record->value().buffer;
+  void* expAddress =
+      static_cast<char*>(const_cast<void*>(newData.buffer)) + expressionOffset;
   // Prepare the new data content
   /* WARNING: expressionAddress() cannot be used while the metadata is invalid
    * (as it is sometimes computed from metadata). Thus, the expression address
@@ -8,6 +8,8 @@
 #include <poincare/symbol.h>
 #include <poincare/undefined.h>
 
+#include <algorithm>
+
 #include "continuous_function.h"
 #include "continuous_function_store.h"
 #include "expression_display_permissions.h"
@@ -21,11 +23,13 @@ namespace Shared {
 
 constexpr const char *GlobalContext::k_extensions[];
 
-OMG::GlobalBox<SequenceStore> GlobalContext::sequenceStore;
-OMG::GlobalBox<ContinuousFunctionStore> GlobalContext::continuousFunctionStore;
+OMG_THREAD_LOCAL OMG::GlobalBox<SequenceStore> GlobalContext::sequenceStore;
+OMG_THREAD_LOCAL OMG::GlobalBox<ContinuousFunctionStore>
+    GlobalContext::continuousFunctionStore;
 
 void GlobalContext::storageDidChangeForRecord(Ion::Storage::Record record) {
   m_sequenceContext.resetCache();
+  resetApproximationCache();
   GlobalContext::sequenceStore->storageDidChangeForRecord(record);
   GlobalContext::continuousFunctionStore->storageDidChangeForRecord(record);
 }
@@ -104,6 +108,7 @@ bool GlobalContext::setExpressionForSymbolAbstract(
     const Expression &expression, const SymbolAbstract &symbol) {
   /* If the new expression contains the symbol, replace it because it will be
    * destroyed afterwards (to be able to do A+2->A) */
+  resetApproximationCache();
   Ion::Storage::Record record = SymbolAbstractRecordWithBaseName(symbol.name());
   Expression e = expressionForSymbolAndRecord(symbol, record, this);
   if (e.isUninitialized()) {
@@ -138,6 +143,79 @@ bool GlobalContext::setExpressionForSymbolAbstract(
          Ion::Storage::Record::ErrorStatus::None;
 }
 
+bool GlobalContext::CachedApproximation::matches(
+    const char *symbolName, const ApproximationContext &approximationContext,
+    bool isDoublePrecision) const {
+  return strcmp(name, symbolName) == 0 &&
+         complexFormat == approximationContext.complexFormat() &&
+         angleUnit == approximationContext.angleUnit() &&
+         withinReduce == approximationContext.withinReduce() &&
+         doublePrecision == isDoublePrecision;
+}
+
+bool GlobalContext::scalarApproximationForSymbol(
+    const char *name, const ApproximationContext &approximationContext,
+    bool doublePrecision, std::complex<double> *value) {
+  for (int i = 0; i < m_numberOfCachedApproximations; i++) {
+    const CachedApproximation &cached = m_cachedApproximations[i];
+    if (cached.matches(name, approximationContext, doublePrecision)) {
+      if (cached.isScalar) {
+        *value = cached.value;
+        if (cached.encounteredComplex) {
+          Expression::SetEncounteredComplex(true);
+        }
+      }
+      return cached.isScalar;
+    }
+  }
+  if (strlen(name) >= SymbolAbstractNode::k_maxNameSize) {
+    return false;
+  }
+  CachedApproximation approximation = {
+      .value = NAN,
+      .complexFormat = approximationContext.complexFormat(),
+      .angleUnit = approximationContext.angleUnit(),
+      .withinReduce = approximationContext.withinReduce(),
+      .doublePrecision = doublePrecision,
+      .isScalar = false,
+      .encounteredComplex = false};
+  strlcpy(approximation.name, name, SymbolAbstractNode::k_maxNameSize);
+  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(name);
+  if (r.hasExtension(Ion::Storage::expExtension)) {
+    Expression e = Expression::ExpressionWithoutSymbols(
+        ExpressionForActualSymbol(r), this,
+        SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
+    if (!e.isUninitialized()) {
+      /* Approximate in this context only, so that the value does not depend
+       * on the variables of the caller. Approximating resets the complex
+       * flag of the ongoing approximation, which is restored afterwards. */
+      ApproximationContext globalApproximationContext(
+          this, approximation.complexFormat, approximation.angleUnit,
+          approximation.withinReduce);
+      bool encounteredComplex = Expression::EncounteredComplex();
+      if (doublePrecision) {
+        approximation.isScalar = e.approximateToComplex<double>(
+            globalApproximationContext, &approximation.value);
+      } else {
+        std::complex<float> floatValue;
+        approximation.isScalar = e.approximateToComplex<float>(
+            globalApproximationContext, &floatValue);
+        approximation.value = floatValue;
+      }
+      approximation.encounteredComplex = Expression::EncounteredComplex();
+      Expression::SetEncounteredComplex(encounteredComplex ||
+                                        approximation.encounteredComplex);
+    }
+  }
+  m_cachedApproximations[m_nextCachedApproximationIndex] = approximation;
+  m_nextCachedApproximationIndex =
+      (m_nextCachedApproximationIndex + 1) % k_numberOfCachedApproximations;
+  m_numberOfCachedApproximations = std::min(m_numberOfCachedApproximations + 1,
+                                            k_numberOfCachedApproximations);
+  *value = approximation.value;
+  return approximation.isScalar;
+}
+
 const Expression GlobalContext::expressionForSymbolAndRecord(
     const SymbolAbstract &symbol, Ion::Storage::Record r, Context *ctx) {
   if (symbol.type() == ExpressionNode::Type::Symbol) {
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <ion/storage/file_system.h>
 #include <omg/global_box.h>
+#include <omg/thread_local.h>
 #include <poincare/context.h>
 #include <poincare/decimal.h>
 #include <poincare/float.h>
@@ -35,7 +36,10 @@ class GlobalContext final : public Poincare::Context {
   static void DestroyRecordsBaseNamedWithoutExtension(const char *baseName,
                                                       const char *extension);
 
-  GlobalContext() : m_sequenceContext(this, sequenceStore){};
+  GlobalContext()
+      : m_sequenceContext(this, sequenceStore),
+        m_numberOfCachedApproximations(0),
+        m_nextCachedApproximationIndex(0){};
   /* Expression for symbol
    * The expression recorded in global context is already an expression.
    * Otherwise, we would need the context and the angle unit to evaluate it */
@@ -44,8 +48,13 @@ class GlobalContext final : public Poincare::Context {
   bool setExpressionForSymbolAbstract(
       const Poincare::Expression &expression,
       const Poincare::SymbolAbstract &symbol) override;
-  static OMG::GlobalBox<SequenceStore> sequenceStore;
-  static OMG::GlobalBox<ContinuousFunctionStore> continuousFunctionStore;
+  bool scalarApproximationForSymbol(
+      const char *name,
+      const Poincare::ApproximationContext &approximationContext,
+      bool doublePrecision, std::complex<double> *value) override;
+  static OMG_THREAD_LOCAL OMG::GlobalBox<SequenceStore> sequenceStore;
+  static OMG_THREAD_LOCAL OMG::GlobalBox<ContinuousFunctionStore>
+      continuousFunctionStore;
   void storageDidChangeForRecord(const Ion::Storage::Record record);
   SequenceContext *sequenceContext() { return &m_sequenceContext; }
   void tidyDownstreamPoolFrom(
@@ -80,7 +89,39 @@ class GlobalContext final : public Poincare::Context {
   // Record getter
   static Ion::Storage::Record SymbolAbstractRecordWithBaseName(
       const char *name);
+  void resetApproximationCache() {
+    m_numberOfCachedApproximations = 0;
+    m_nextCachedApproximationIndex = 0;
+  }
+
+  /* Approximating an expression many times, as when plotting a function,
+   * would otherwise copy the records of its variables in the pool at each
+   * evaluation. Since variables are stored without symbols, their
+   * approximation only depends on their own record. The cache is still
+   * entirely reset on any change of the storage, as it is small and changes
+   * are rare. */
+  struct CachedApproximation {
+    bool matches(const char *symbolName,
+                 const Poincare::ApproximationContext &approximationContext,
+                 bool isDoublePrecision) const;
+
+    char name[Poincare::SymbolAbstractNode::k_maxNameSize];
+    std::complex<double> value;
+    Poincare::Preferences::ComplexFormat complexFormat;
+    Poincare::Preferences::AngleUnit angleUnit;
+    bool withinReduce;
+    bool doublePrecision;
+    // False if the symbol is not a variable with a scalar value
+    bool isScalar;
+    bool encounteredComplex;
+  };
+  constexpr static int k_numberOfCachedApproximations = 8;
+
   SequenceContext m_sequenceContext;
+  CachedApproximation m_cachedApproximations[k_numberOfCachedApproximations];
+  int m_numberOfCachedApproximations;
+  // Oldest entry, replaced once the cache is full
+  int m_nextCachedApproximationIndex;
 };
 
 }  // namespace Shared
@@ -37,7 +37,20 @@ InteractiveCurveViewController::InteractiveCurveViewController(
   m_rangeButton.setState(!m_interactiveRange->zoomNormalize());
 }
 
+/* The events that move the cursor, zoom or open a menu act on the range, so
+ * they finish its refinement first. The refinement of the range goes on during
+ * the other events, such as the modifiers or the events that leave the graph,
+ * which would otherwise have to wait for the curves to be sampled. */
+static bool EventDependsOnRange(Ion::Events::Event event) {
+  return event.isMoveEvent() || event == Ion::Events::Plus ||
+         event == Ion::Events::Minus || event == Ion::Events::OK ||
+         event == Ion::Events::EXE || event == Ion::Events::Toolbox;
+}
+
 bool InteractiveCurveViewController::handleEvent(Ion::Events::Event event) {
+  if (EventDependsOnRange(event)) {
+    finishAutoZoom();
+  }
   if (!curveView()->hasFocus()) {
     if (event == Ion::Events::Down) {
       setCurveViewAsMainView(false, false);
@@ -108,7 +121,7 @@ void InteractiveCurveViewController::viewWillAppear() {
 
   SimpleInteractiveCurveViewController::viewWillAppear();
 
-  m_interactiveRange->computeRanges();
+  computeRangesProgressively();
   if (!m_interactiveRange->zoomAuto()) {
     /* InteractiveCurveViewRange already refreshes the cursor when requiring an
      * update to the bottom margin. If auto is off, the margin is never updated
@@ -124,6 +137,15 @@ void InteractiveCurveViewController::viewWillAppear() {
   SimpleInteractiveCurveViewController::viewWillAppear();
 }
 
+void InteractiveCurveViewController::viewDidDisappear() {
+  // The estimate is not memoized, the next appearance computes it again
+  Escher::App *app = App::app();
+  if (app && app->backgroundJob() == &m_autoZoomJob) {
+    app->setBackgroundJob(nullptr);
+  }
+  SimpleInteractiveCurveViewController::viewDidDisappear();
+}
+
 void InteractiveCurveViewController::refreshCursor(bool ignoreMargins,
                                                    bool forceFiniteY) {
   /* Warning: init cursor parameter before reloading banner view. Indeed,
@@ -351,12 +373,37 @@ void InteractiveCurveViewController::setCurveViewAsMainView(
   curveView()->reload(resetInterrupted, forceReload);
 }
 
+void InteractiveCurveViewController::computeRangesProgressively() {
+  finishAutoZoom();
+#if ION_EVENTS_JOURNAL
+  /* A replayed journal leaves no idle time between its events, and the
+   * screenshots of a replay should not depend on how long a refinement takes.
+   */
+  if (Ion::Events::isReplaying()) {
+    m_interactiveRange->computeRanges();
+    return;
+  }
+#endif
+  if (m_interactiveRange->computeEstimatedRanges()) {
+    m_autoZoomJob = AutoZoomJob(m_interactiveRange, this);
+    App::app()->setBackgroundJob(&m_autoZoomJob);
+  }
+}
+
+void InteractiveCurveViewController::finishAutoZoom() {
+  Escher::App *app = App::app();
+  if (app && app->backgroundJob() == &m_autoZoomJob) {
+    m_autoZoomJob.finish();
+    app->setBackgroundJob(nullptr);
+  }
+}
+
 Invocation InteractiveCurveViewController::autoButtonInvocation() {
   return Invocation::Builder<InteractiveCurveViewController>(
       [](InteractiveCurveViewController *graphController, void *sender) {
         graphController->m_interactiveRange->setZoomAuto(
             !graphController->m_interactiveRange->zoomAuto());
-        graphController->m_interactiveRange->computeRanges();
+        graphController->computeRangesProgressively();
         if (graphController->m_interactiveRange->zoomAuto()) {
           graphController->setCurveViewAsMainView(true, true);
         }
@@ -368,6 +415,7 @@ Invocation InteractiveCurveViewController::autoButtonInvocation() {
 Invocation InteractiveCurveViewController::rangeButtonInvocation() {
   return Invocation::Builder<InteractiveCurveViewController>(
       [](InteractiveCurveViewController *graphController, void *sender) {
+        graphController->finishAutoZoom();
         graphController->rangeParameterController()->setRange(
             graphController->interactiveCurveViewRange());
         StackViewController *stack = graphController->stackController();
@@ -380,6 +428,7 @@ Invocation InteractiveCurveViewController::rangeButtonInvocation() {
 Invocation InteractiveCurveViewController::navigationButtonInvocation() {
   return Invocation::Builder<InteractiveCurveViewController>(
       [](InteractiveCurveViewController *graphController, void *sender) {
+        graphController->finishAutoZoom();
         static_cast<TabViewController *>(graphController->tabController())
             ->setDisplayTabs(false);
         graphController->stackController()->push(
@@ -392,6 +441,7 @@ Invocation InteractiveCurveViewController::navigationButtonInvocation() {
 Invocation InteractiveCurveViewController::calculusButtonInvocation() {
   return Invocation::Builder<InteractiveCurveViewController>(
       [](InteractiveCurveViewController *graphController, void *sender) {
+        graphController->finishAutoZoom();
         if (graphController->curveSelectionController()->numberOfRows() > 1) {
           graphController->stackController()->push(
               graphController->curveSelectionController());
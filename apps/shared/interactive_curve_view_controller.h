@@ -9,6 +9,7 @@
 #include <escher/unequal_view.h>
 #include <poincare/coordinate_2D.h>
 
+#include "auto_zoom_job.h"
 #include "cursor_view.h"
 #include "curve_selection_controller.h"
 #include "function_zoom_and_pan_curve_view_controller.h"
@@ -44,6 +45,7 @@ class InteractiveCurveViewController
     return ViewController::TitlesDisplay::NeverDisplayOwnTitle;
   }
   void viewWillAppear() override;
+  void viewDidDisappear() override;
   TELEMETRY_ID("Graph");
 
   // TextFieldDelegate
@@ -125,10 +127,15 @@ class InteractiveCurveViewController
   void refreshCursorAfterComputingRange() override {
     refreshCursor(true, true);
   }
+  void didRefineRange() override { curveView()->reload(true); }
 
   void setCurveViewAsMainView(bool resetInterrupted, bool forceReload);
   void openMenu() { openMenuForCurveAtIndex(selectedCurveIndex()); };
   void refreshCursor(bool ignoreMargins = false, bool forceFiniteY = false);
+  /* Draw the estimated range at once and refine it in the background. The
+   * events that depend on the range finish the refinement first. */
+  void computeRangesProgressively();
+  void finishAutoZoom();
 
   // Button invocations
   Escher::Invocation autoButtonInvocation();
@@ -139,6 +146,7 @@ class InteractiveCurveViewController
   RangeParameterController m_rangeParameterController;
   FunctionZoomAndPanCurveViewController m_zoomParameterController;
   InteractiveCurveViewRange* m_interactiveRange;
+  AutoZoomJob m_autoZoomJob;
   // Auto button
   Escher::ButtonState m_autoButton;
   Escher::ToggleableDotView m_autoDotView;
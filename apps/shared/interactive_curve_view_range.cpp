@@ -314,6 +314,56 @@ void InteractiveCurveViewRange::privateSetZoomAuto(bool xAuto, bool yAuto) {
   }
 }
 
+bool InteractiveCurveViewRange::computeEstimatedRanges() {
+  if (!m_delegate || !(m_xAuto || m_yAuto) ||
+      autoRangeIsMemoized(m_xAuto, m_yAuto)) {
+    computeRanges();
+    return false;
+  }
+  assert(offscreenYAxis() == 0.f);
+  Range2D estimate =
+      m_delegate->estimatedRange(m_xAuto, m_yAuto, memoizedRange());
+  if (estimate.x()->isNan()) {
+    computeRanges();
+    return false;
+  }
+  /* The cursor is left as it is until the optimal range is set, so that it
+   * ends up where computeRanges would have put it. */
+  setZoomNormalize(false);
+  setAutoRange(estimate, m_xAuto, m_yAuto, false);
+  setZoomNormalize(isOrthonormal());
+  return true;
+}
+
+bool InteractiveCurveViewRange::computeOptimalRanges(int step, Zoom* zoom,
+                                                     bool computeX,
+                                                     bool computeY) {
+  assert(offscreenYAxis() == 0.f);
+  assert(m_delegate && (computeX || computeY));
+  Range2D newRange;
+  if (autoRangeIsMemoized(computeX, computeY)) {
+    newRange = m_memoizedAutoRange;
+  } else {
+    if (!m_delegate->optimalRangeStep(step, zoom, computeX, computeY,
+                                      memoizedRange(), &newRange)) {
+      return false;
+    }
+    if (computeX && computeY) {
+      m_memoizedAutoRange = newRange;
+      m_checksumOfMemoizedAutoRange = m_delegate->autoZoomChecksum();
+    }
+  }
+  setZoomNormalize(false);
+  setAutoRange(newRange, computeX, computeY, true);
+  setZoomNormalize(isOrthonormal());
+  return true;
+}
+
+void InteractiveCurveViewRange::setAnimatedRange(Range2D range) {
+  protectedSetXRange(*range.x(), k_maxFloat);
+  protectedSetYRange(*range.y(), k_maxFloat);
+}
+
 void InteractiveCurveViewRange::privateComputeRanges(bool computeX,
                                                      bool computeY) {
   assert(offscreenYAxis() == 0.f);
@@ -325,63 +375,78 @@ void InteractiveCurveViewRange::privateComputeRanges(bool computeX,
   setZoomNormalize(false);
   if (m_delegate && (computeX || computeY)) {
     Range2D newRange;
-    bool useMemoizedAutoRange = computeX && computeY;
     {
       CircuitBreakerCheckpoint checkpoint(
           Ion::CircuitBreaker::CheckpointType::Back);
       if (CircuitBreakerRun(checkpoint)) {
-        uint64_t checksum;
-        if (useMemoizedAutoRange &&
-            (checksum = m_delegate->autoZoomChecksum()) ==
-                m_checksumOfMemoizedAutoRange) {
-          newRange = m_memoizedAutoRange;
-        } else {
-          newRange =
-              m_delegate->optimalRange(computeX, computeY, memoizedRange());
-          if (useMemoizedAutoRange) {
-            m_memoizedAutoRange = newRange;
-            m_checksumOfMemoizedAutoRange = checksum;
-          }
-        }
+        newRange = optimalAutoRange(computeX, computeY);
       } else {
         m_delegate->tidyModels(checkpoint.endOfPoolBeforeCheckpoint());
         newRange = Zoom::DefaultRange(NormalYXRatio(), k_maxFloat);
       }
     }
+    setAutoRange(newRange, computeX, computeY, true);
+  }
 
+  setZoomNormalize(isOrthonormal());
+}
+
+bool InteractiveCurveViewRange::autoRangeIsMemoized(bool computeX,
+                                                    bool computeY) const {
+  return computeX && computeY &&
+         m_delegate->autoZoomChecksum() == m_checksumOfMemoizedAutoRange;
+}
+
+Range2D InteractiveCurveViewRange::optimalAutoRange(bool computeX,
+                                                    bool computeY) {
+  bool useMemoizedAutoRange = computeX && computeY;
+  uint64_t checksum = useMemoizedAutoRange ? m_delegate->autoZoomChecksum() : 0;
+  if (useMemoizedAutoRange && checksum == m_checksumOfMemoizedAutoRange) {
+    return m_memoizedAutoRange;
+  }
+  Range2D newRange =
+      m_delegate->optimalRange(computeX, computeY, memoizedRange());
+  if (useMemoizedAutoRange) {
+    m_memoizedAutoRange = newRange;
+    m_checksumOfMemoizedAutoRange = checksum;
+  }
+  return newRange;
+}
+
+void InteractiveCurveViewRange::setAutoRange(Range2D newRange, bool computeX,
+                                             bool computeY,
+                                             bool refreshCursor) {
+  if (refreshCursor) {
     if (computeX) {
       protectedSetXRange(*newRange.x(), k_maxFloat);
     }
     if (computeY) {
       protectedSetYRange(*newRange.y(), k_maxFloat);
     }
-
     /* We notify the delegate to refresh the cursor's position, which will
      * update the bottom margin (which depends on the banner height). */
     m_delegate->refreshCursorAfterComputingRange();
+  }
 
-    Range2D newRangeWithMargins = m_delegate->addMargins(newRange);
-    newRangeWithMargins =
-        Range2D(computeX ? *newRangeWithMargins.x()
-                         : Range1D(xMin(), xMax(), k_maxFloat),
-                computeY ? *newRangeWithMargins.y()
-                         : Range1D(yMin(), yMax(), k_maxFloat));
-    if (newRange.ratioIs(NormalYXRatio())) {
-      bool canSetRatio =
-          newRangeWithMargins.setRatio(NormalYXRatio(), false, k_maxFloat);
-      assert(!canSetRatio || newRangeWithMargins.ratioIs(NormalYXRatio()));
-      (void)canSetRatio;
-    }
-
-    if (computeX) {
-      protectedSetXRange(*newRangeWithMargins.x(), k_maxFloat);
-    }
-    if (computeY) {
-      protectedSetYRange(*newRangeWithMargins.y(), k_maxFloat);
-    }
+  Range2D newRangeWithMargins = m_delegate->addMargins(newRange);
+  newRangeWithMargins =
+      Range2D(computeX ? *newRangeWithMargins.x()
+                       : Range1D(xMin(), xMax(), k_maxFloat),
+              computeY ? *newRangeWithMargins.y()
+                       : Range1D(yMin(), yMax(), k_maxFloat));
+  if (newRange.ratioIs(NormalYXRatio())) {
+    bool canSetRatio =
+        newRangeWithMargins.setRatio(NormalYXRatio(), false, k_maxFloat);
+    assert(!canSetRatio || newRangeWithMargins.ratioIs(NormalYXRatio()));
+    (void)canSetRatio;
   }
 
-  setZoomNormalize(isOrthonormal());
+  if (computeX) {
+    protectedSetXRange(*newRangeWithMargins.x(), k_maxFloat);
+  }
+  if (computeY) {
+    protectedSetYRange(*newRangeWithMargins.y(), k_maxFloat);
+  }
 }
 
 }  // namespace Shared
@@ -59,6 +59,17 @@ class InteractiveCurveViewRange : public MemoizedCurveViewRange {
   void zoom(float ratio, float x, float y);
   void panWithVector(float x, float y);
   void computeRanges() { privateComputeRanges(m_xAuto, m_yAuto); }
+  /* Display the estimate of the delegate at once, and return true if the
+   * ranges should then be refined by an AutoZoomJob. Without estimate, or if
+   * the auto range is memoized, the ranges are computed right away. */
+  bool computeEstimatedRanges();
+  /* Same as computeRanges, without the Back checkpoint, split into the steps
+   * of optimalRangeStep so that an AutoZoomJob can run them one at a time.
+   * Return true once the last step has set the ranges. */
+  bool computeOptimalRanges(int step, Poincare::Zoom* zoom, bool computeX,
+                            bool computeY);
+  // Set a frame of the animation of an AutoZoomJob, keeping the auto status
+  void setAnimatedRange(Poincare::Range2D range);
   void normalize();
   void centerAxisAround(Axis axis, float position);
   bool panToMakePointVisible(float x, float y, float topMarginRatio,
@@ -102,6 +113,11 @@ class InteractiveCurveViewRange : public MemoizedCurveViewRange {
  private:
   void privateSetZoomAuto(bool xAuto, bool yAuto);
   void privateComputeRanges(bool computeX, bool computeY);
+  bool autoRangeIsMemoized(bool computeX, bool computeY) const;
+  Poincare::Range2D optimalAutoRange(bool computeX, bool computeY);
+  // Set the ranges that are computed, with the margins of the delegate
+  void setAutoRange(Poincare::Range2D newRange, bool computeX, bool computeY,
+                    bool refreshCursor);
 
   Poincare::Range2D m_memoizedAutoRange;
   uint64_t m_checksumOfMemoizedAutoRange;
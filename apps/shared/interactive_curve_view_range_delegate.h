@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <poincare/context.h>
 #include <poincare/range.h>
+#include <poincare/zoom.h>
 
 #include "function_store.h"
 
@@ -30,10 +31,30 @@ class InteractiveCurveViewRangeDelegate {
   }
   virtual Poincare::Range2D optimalRange(
       bool computeX, bool computeY, Poincare::Range2D originalRange) const = 0;
+  /* Run the step-th step of optimalRange, which samples a part of the curves
+   * into zoom, so that an AutoZoomJob can spread the sampling over several
+   * slices. The zoom is carried from one step to the next, starting with
+   * step 0. Return true and set range once the last step is done. By default,
+   * optimalRange is computed in a single step. */
+  virtual bool optimalRangeStep(int step, Poincare::Zoom* zoom, bool computeX,
+                                bool computeY, Poincare::Range2D originalRange,
+                                Poincare::Range2D* range) const {
+    *range = optimalRange(computeX, computeY, originalRange);
+    return true;
+  }
+  /* Cheap range displayed at once while the optimal range is computed in the
+   * background. A nan range means that the optimal range is computed before
+   * the first frame. */
+  virtual Poincare::Range2D estimatedRange(
+      bool computeX, bool computeY, Poincare::Range2D originalRange) const {
+    return Poincare::Range2D();
+  }
   virtual float addMargin(float x, float range, bool isVertical,
                           bool isMin) const = 0;
   Poincare::Range2D addMargins(Poincare::Range2D range) const;
   virtual void refreshCursorAfterComputingRange() = 0;
+  // The range has been refined or animated by an AutoZoomJob
+  virtual void didRefineRange() = 0;
   virtual void updateZoomButtons() = 0;
   virtual void tidyModels(Poincare::TreeNode* treePoolCursor) = 0;
 };
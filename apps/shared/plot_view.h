@@ -41,6 +41,9 @@ class AbstractPlotView : public Escher::View {
   AbstractPlotView(CurveViewRange *range)
       : m_range(range),
         m_stampDashIndex(k_stampIndexNoDash),
+#if PLOT_VIEW_COUNT_EVALUATIONS
+        m_numberOfEvaluations(0),
+#endif
         m_drawnRangeVersion(0),
         m_bannerOverlapsGraph(true),
         m_focus(false) {}
@@ -153,6 +156,15 @@ class AbstractPlotView : public Escher::View {
   bool pointsInSameStamp(Poincare::Coordinate2D<float> p1,
                          Poincare::Coordinate2D<float> p2, bool thick) const;
   bool bannerOverlapsGraph() const { return m_bannerOverlapsGraph; }
+#if PLOT_VIEW_COUNT_EVALUATIONS
+  /* Number of evaluations of the plotted models since the last reset, which
+   * are counted by the drawing helpers. */
+  int numberOfEvaluations() const { return m_numberOfEvaluations; }
+  void resetNumberOfEvaluations() { m_numberOfEvaluations = 0; }
+  void countEvaluation() const { m_numberOfEvaluations++; }
+#else
+  void countEvaluation() const {}
+#endif
   virtual KDColor backgroundColor() const { return k_backgroundColor; }
 
  protected:
@@ -186,6 +198,9 @@ class AbstractPlotView : public Escher::View {
 
   CurveViewRange *m_range;
   mutable int8_t m_stampDashIndex;
+#if PLOT_VIEW_COUNT_EVALUATIONS
+  mutable int m_numberOfEvaluations;
+#endif
   uint32_t m_drawnRangeVersion;
   bool m_bannerOverlapsGraph;
   bool m_focus;
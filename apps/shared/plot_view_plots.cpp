@@ -173,7 +173,7 @@ void WithCurves::CurveDrawing::draw(const AbstractPlotView *plotView,
       continue;
     }
     previousXY = xy;
-    xy = m_curve.evaluate(t, m_context);
+    xy = evaluate(plotView, t);
     joinDots(plotView, ctx, rect, previousT, previousXY, t, xy,
              k_maxNumberOfIterations, m_discontinuity);
   } while (!isLastSegment);
@@ -217,16 +217,17 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView *plotView,
      * as wrong points will be off by a large margin. */
     constexpr float pixelTolerance = 1.f;
     if (!m_curveDouble ||
-        (std::fabs(p2.y() - (plotView->floatToPixel2D(
-                                 m_curveDouble(t2, m_curve.model(), m_context)))
-                                .y()) < pixelTolerance)) {
+        (std::fabs(
+             p2.y() -
+             (plotView->floatToPixel2D(evaluateDouble(plotView, t2))).y()) <
+         pixelTolerance)) {
       plotView->stamp(ctx, rect, p2, m_color, m_thick);
     }
     return;
   }
 
   float t12 = 0.5f * (t1 + t2);
-  Coordinate2D<float> xy12 = m_curve.evaluate(t12, m_context);
+  Coordinate2D<float> xy12 = evaluate(plotView, t12);
 
   bool discontinuous = discontinuity(t1, t2, m_curve.model(), m_context);
   if (discontinuous) {
@@ -254,12 +255,9 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView *plotView,
         std::fabs((p2.y() - p1.y()) / (p2.x() - p1.x())) > dangerousSlope) {
       /* We need to make sure we're not drawing a vertical asymptote because of
        * rounding errors. */
-      Coordinate2D<double> xy1Double =
-          m_curveDouble(t1, m_curve.model(), m_context);
-      Coordinate2D<double> xy2Double =
-          m_curveDouble(t2, m_curve.model(), m_context);
-      Coordinate2D<double> xy12Double =
-          m_curveDouble(t12, m_curve.model(), m_context);
+      Coordinate2D<double> xy1Double = evaluateDouble(plotView, t1);
+      Coordinate2D<double> xy2Double = evaluateDouble(plotView, t2);
+      Coordinate2D<double> xy12Double = evaluateDouble(plotView, t12);
       if (pointInBoundingBox(xy1Double.x(), xy1Double.y(), xy2Double.x(),
                              xy2Double.y(), xy12Double.x(), xy12Double.y())) {
         p1 = plotView->floatToPixel2D(xy1Double);
@@ -341,6 +339,19 @@ void WithCurves::CurveDrawing::drawPattern(
   }
 }
 
+Coordinate2D<float> WithCurves::CurveDrawing::evaluate(
+    const AbstractPlotView *plotView, float t) const {
+  plotView->countEvaluation();
+  return m_curve.evaluate(t, m_context);
+}
+
+Coordinate2D<double> WithCurves::CurveDrawing::evaluateDouble(
+    const AbstractPlotView *plotView, double t) const {
+  assert(m_curveDouble);
+  plotView->countEvaluation();
+  return m_curveDouble(t, m_curve.model(), m_context);
+}
+
 // WithCurves
 
 void WithCurves::drawArcOfEllipse(const AbstractPlotView *plotView,
@@ -428,6 +439,7 @@ void WithHistogram::HistogramDrawing::draw(const AbstractPlotView *plotView,
     double xCenter = m_fillBars ? x + 0.5f * m_barsWidth : x;
     // WARNING/TODO: Dangerous cast from double to float
     double y = m_curve(xCenter, m_model, m_context);
+    plotView->countEvaluation();
     if (!std::isfinite(y) || y == 0.f) {
       continue;
     }
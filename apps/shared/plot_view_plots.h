@@ -111,6 +111,10 @@ class WithCurves {
     void drawPattern(const AbstractPlotView *plotView, KDContext *ctx,
                      KDRect rect, float t,
                      Poincare::Coordinate2D<float> xy) const;
+    Poincare::Coordinate2D<float> evaluate(const AbstractPlotView *plotView,
+                                           float t) const;
+    Poincare::Coordinate2D<double> evaluateDouble(
+        const AbstractPlotView *plotView, double t) const;
 
     Curve2D m_curve;
     Curve2D m_patternLowerBound;
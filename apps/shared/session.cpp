@@ -0,0 +1,27 @@
+#include "session.h"
+
+#include <apps/global_preferences.h>
+#include <ion/storage/file_system.h>
+#include <poincare/init.h>
+
+#include "global_context.h"
+
+namespace Shared {
+
+Session::Session() {
+  Ion::Storage::FileSystem::sharedFileSystem.init();
+  Poincare::Init();
+  GlobalPreferences::sharedGlobalPreferences.init();
+  GlobalContext::sequenceStore.init();
+  GlobalContext::continuousFunctionStore.init();
+}
+
+Session::~Session() {
+  GlobalContext::continuousFunctionStore.deinit();
+  GlobalContext::sequenceStore.deinit();
+  GlobalPreferences::sharedGlobalPreferences.deinit();
+  Poincare::Shutdown();
+  Ion::Storage::FileSystem::sharedFileSystem.deinit();
+}
+
+}  // namespace Shared
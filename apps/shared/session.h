@@ -0,0 +1,30 @@
+#ifndef SHARED_SESSION_H
+#define SHARED_SESSION_H
+
+namespace Shared {
+
+/* The state of a calculator session on the current thread: its storage, its
+ * preferences, its TreePool and the stores of its functions and sequences.
+ * When the globals are thread local (see OMG_THREAD_LOCAL_GLOBALS), a process
+ * can host as many concurrent sessions as it has threads, which share the
+ * read-only data such as the fonts and the translations.
+ *
+ * The session of the main thread is the one set up by the Init functions,
+ * which the AppsContainer runs in: a Session should only be created on
+ * another thread, and only one at a time. It is destroyed with its records
+ * and its expressions.
+ * The state of MicroPython is not part of a session: Python only runs on the
+ * main thread, which is asserted by Ion::stackStart. The exam mode is part of
+ * a session on the simulator, and starts Off. */
+
+class Session {
+ public:
+  Session();
+  ~Session();
+  Session(const Session&) = delete;
+  Session& operator=(const Session&) = delete;
+};
+
+}  // namespace Shared
+
+#endif
@@ -209,7 +209,7 @@ void SumGraphController::reloadBannerView() {
     assert(!selectedRecord().isNull());
     Poincare::Context *context = FunctionApp::app()->localContext();
     Poincare::Expression sum = createSumExpression(m_startSum, endSum, context);
-    result = PoincareHelpers::ApproximateToScalar<double>(sum, context);
+    result = approximateSum(sum, context);
     functionLayout = createFunctionLayout();
   } else {
     m_legendView.setEditableZone(m_cursor->x());
@@ -227,6 +227,11 @@ Poincare::Expression SumGraphController::createSumExpression(
   return function->sumBetweenBounds(startSum, endSum, context);
 }
 
+double SumGraphController::approximateSum(const Poincare::Expression sum,
+                                          Poincare::Context *context) {
+  return PoincareHelpers::ApproximateToScalar<double>(sum, context);
+}
+
 /* Legend View */
 
 SumGraphController::LegendView::LegendView(SumGraphController *controller)
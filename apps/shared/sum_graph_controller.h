@@ -64,6 +64,8 @@ class SumGraphController : public SimpleInteractiveCurveViewController {
   virtual Poincare::Expression createSumExpression(double startSum,
                                                    double endSum,
                                                    Poincare::Context* context);
+  virtual double approximateSum(const Poincare::Expression sum,
+                                Poincare::Context* context);
 
   class LegendView : public Escher::View {
    public:
@@ -0,0 +1,91 @@
+#include "../session.h"
+
+#include <ion/storage/file_system.h>
+#include <poincare/preferences.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <quiz.h>
+
+#include <cmath>
+#if OMG_THREAD_LOCAL_GLOBALS
+#include <thread>
+#endif
+
+#include "../global_context.h"
+
+using namespace Poincare;
+
+namespace Shared {
+
+#if OMG_THREAD_LOCAL_GLOBALS
+
+constexpr int k_numberOfSessions = 4;
+constexpr int k_numberOfRuns = 50;
+constexpr int k_numberOfValues = 64;
+
+static void RunSession(int index, bool* success) {
+  Session session;
+  // The exam mode of the main thread does not leak into the session
+  *success = Preferences::sharedPreferences->examMode() ==
+             ExamMode(ExamMode::Ruleset::Off);
+  Preferences::sharedPreferences->setExamMode(
+      ExamMode(ExamMode::Ruleset::Standard));
+  /* The sessions differ by their angle unit and by the value they store in
+   * the variable a, which they read back while the others write theirs. */
+  bool degree = index % 2 == 0;
+  Preferences::sharedPreferences->setAngleUnit(
+      degree ? Preferences::AngleUnit::Degree : Preferences::AngleUnit::Radian);
+  GlobalContext context;
+  float values[k_numberOfValues];
+  float results[k_numberOfValues];
+  for (int i = 0; i < k_numberOfValues; i++) {
+    values[i] = i;
+  }
+  for (int run = 0; run < k_numberOfRuns; run++) {
+    int a = index + k_numberOfSessions * run;
+    context.setExpressionForSymbolAbstract(Rational::Builder(a),
+                                           Symbol::Builder("a", 1));
+    Expression e = Expression::Parse("a+sin(90)", &context);
+    double result = e.approximateToScalar<double>(&context);
+    *success = *success && result == a + (degree ? 1. : std::sin(90.));
+
+    // The workers run the batches of all the sessions
+    e = Expression::Parse("sin(x)", &context);
+    e.approximateWithValuesForSymbol<float>(
+        "x", values, results, k_numberOfValues,
+        ApproximationContext(&context));
+    for (int i = 0; i < k_numberOfValues; i++) {
+      *success = *success && results[i] == e.approximateWithValueForSymbol(
+                                               "x", values[i],
+                                               ApproximationContext(&context));
+    }
+  }
+}
+
+#endif
+
+QUIZ_CASE(shared_session) {
+#if OMG_THREAD_LOCAL_GLOBALS
+  Preferences::sharedPreferences->setExamMode(
+      ExamMode(ExamMode::Ruleset::PressToTest, {.forbidImplicitPlots = true}));
+  bool success[k_numberOfSessions];
+  std::thread threads[k_numberOfSessions];
+  for (int i = 0; i < k_numberOfSessions; i++) {
+    threads[i] = std::thread(RunSession, i, success + i);
+  }
+  for (int i = 0; i < k_numberOfSessions; i++) {
+    threads[i].join();
+    quiz_assert(success[i]);
+  }
+  // The session of the main thread is left untouched
+  quiz_assert(Ion::Storage::FileSystem::sharedFileSystem
+                  ->recordBaseNamedWithExtension("a", Ion::Storage::expExtension)
+                  .isNull());
+  quiz_assert(Preferences::sharedPreferences->examMode() ==
+              ExamMode(ExamMode::Ruleset::PressToTest,
+                       {.forbidImplicitPlots = true}));
+  Preferences::sharedPreferences->setExamMode(ExamMode(ExamMode::Ruleset::Off));
+#endif
+}
+
+}  // namespace Shared
@@ -7,6 +7,7 @@
 #include <poincare/matrix.h>
 #include <poincare/polynomial.h>
 #include <poincare/print_int.h>
+#include <poincare/solver_algorithms.h>
 #include <poincare/symbol.h>
 
 #include "app.h"
@@ -75,6 +76,9 @@ void SystemOfEquations::approximateSolve(Context *context) {
   m_numberOfSolutions = 0;
 
   assert(m_approximateResolutionMinimum <= m_approximateResolutionMaximum);
+  if (approximateSolvePolynomial(undevelopedExpression, context)) {
+    return;
+  }
   Poincare::Solver<double> solver = PoincareHelpers::Solver(
       m_approximateResolutionMinimum, m_approximateResolutionMaximum,
       m_variables[0], context);
@@ -100,6 +104,232 @@ void SystemOfEquations::approximateSolve(Context *context) {
   }
 }
 
+/* The reduction of the equation may have been interrupted, leaving
+ * parentheses, subtractions and divisions that Expression::polynomialDegree
+ * does not expect. */
+static int unreducedPolynomialDegree(const Expression e, Context *context,
+                                     const char *symbol) {
+  ExpressionNode::Type type = e.type();
+  switch (type) {
+    case ExpressionNode::Type::Parenthesis:
+    case ExpressionNode::Type::Opposite:
+      return unreducedPolynomialDegree(e.childAtIndex(0), context, symbol);
+    case ExpressionNode::Type::Addition:
+    case ExpressionNode::Type::Subtraction:
+    case ExpressionNode::Type::Multiplication: {
+      int degree = 0;
+      for (int i = 0; i < e.numberOfChildren(); i++) {
+        int d = unreducedPolynomialDegree(e.childAtIndex(i), context, symbol);
+        if (d < 0) {
+          return -1;
+        }
+        degree = type == ExpressionNode::Type::Multiplication
+                     ? degree + d
+                     : std::max(degree, d);
+      }
+      return degree;
+    }
+    case ExpressionNode::Type::Division:
+    case ExpressionNode::Type::Power: {
+      int degree =
+          unreducedPolynomialDegree(e.childAtIndex(0), context, symbol);
+      if (degree < 0 ||
+          unreducedPolynomialDegree(e.childAtIndex(1), context, symbol) != 0) {
+        return -1;
+      }
+      if (type == ExpressionNode::Type::Division || degree == 0) {
+        return degree;
+      }
+      double exponent = PoincareHelpers::ApproximateToScalar<double>(
+          e.childAtIndex(1), context);
+      if (!(exponent >= 0. && exponent <= Polynomial::k_maxApproximateDegree &&
+            exponent == std::round(exponent))) {
+        return -1;
+      }
+      return degree * static_cast<int>(exponent);
+    }
+    default:
+      for (int i = 0; i < e.numberOfChildren(); i++) {
+        if (unreducedPolynomialDegree(e.childAtIndex(i), context, symbol) !=
+            0) {
+          return -1;
+        }
+      }
+      return e.polynomialDegree(context, symbol);
+  }
+}
+
+static Coordinate2D<double> honeOddRoot(
+    Poincare::Solver<double>::FunctionEvaluation f, const void *aux,
+    double xMin, double xMax, Poincare::Solver<double>::Interest interest,
+    double precision, TrinaryBoolean discontinuous) {
+  return SolverAlgorithms::BrentRoot(f, aux, xMin, xMax, interest, precision);
+}
+
+bool SystemOfEquations::approximateSolvePolynomial(Expression e,
+                                                   Context *context) {
+  if (e.type() == ExpressionNode::Type::Dependency) {
+    return false;
+  }
+  int degree = unreducedPolynomialDegree(e, context, m_variables[0]);
+  if (degree < 1 || degree > Polynomial::k_maxApproximateDegree) {
+    return false;
+  }
+  std::complex<double> coefficients[Polynomial::k_maxApproximateDegree + 1];
+  std::complex<double> roots[Polynomial::k_maxApproximateDegree];
+  ApproximationContext approximationContext(context);
+  if (!Polynomial::ApproximateCoefficients(e, m_variables[0], degree,
+                                           approximationContext,
+                                           coefficients) ||
+      Polynomial::ApproximateRoots(coefficients, degree, roots) != degree) {
+    return false;
+  }
+
+  // Gather the roots which may be real, sorted by their real part
+  double centers[Polynomial::k_maxApproximateDegree];
+  double radii[Polynomial::k_maxApproximateDegree];
+  int numberOfCandidates = 0;
+  for (int i = 0; i < degree; i++) {
+    double imaginaryPart = std::fabs(roots[i].imag());
+    double modulus = std::max(1.0, std::abs(roots[i]));
+    if (imaginaryPart > k_polynomialRootMaxImaginaryRatio * modulus) {
+      continue;
+    }
+    int j = numberOfCandidates++;
+    while (j > 0 && centers[j - 1] > roots[i].real()) {
+      centers[j] = centers[j - 1];
+      radii[j] = radii[j - 1];
+      j--;
+    }
+    centers[j] = roots[i].real();
+    radii[j] = imaginaryPart + k_polynomialRootBracketRadius * modulus;
+  }
+
+  /* The roots are honed in the brackets around them, merged when they
+   * overlap. They are only trusted if the sign of e agrees: it must not
+   * change between the brackets, and every bracket must yield a root.
+   * Otherwise the approximate roots missed some, or were too coarse, and the
+   * caller scans the interval instead. */
+  auto evaluate = [&](double x) {
+    return PoincareHelpers::ApproximateWithValueForSymbol<double>(
+        e, m_variables[0], x, context);
+  };
+  auto changesSign = [](double a, double b) {
+    return (a < 0. && 0. < b) || (b < 0. && 0. < a);
+  };
+  auto fallBack = [this]() {
+    m_numberOfSolutions = 0;
+    m_hasMoreSolutions = false;
+    return false;
+  };
+  /* Register the roots found by solver, only the odd ones if oddRootsOnly.
+   * Return false if there is none or if there are too many. */
+  auto registerRoots = [this, &e](Poincare::Solver<double> *solver,
+                                  bool oddRootsOnly) {
+    bool found = false;
+    while (true) {
+      double root =
+          (oddRootsOnly
+               ? solver->next(e, Poincare::Solver<double>::OddRootInBracket,
+                              honeOddRoot)
+               : solver->nextRoot(e))
+              .x();
+      if (std::isnan(root) || root > m_approximateResolutionMaximum) {
+        return found;
+      }
+      found = true;
+      if (root < m_approximateResolutionMinimum ||
+          (m_numberOfSolutions > 0 &&
+           root <= m_solutions[m_numberOfSolutions - 1].approximate())) {
+        continue;
+      }
+      if (m_numberOfSolutions == k_maxNumberOfApproximateSolutions) {
+        m_hasMoreSolutions = true;
+        return false;
+      }
+      registerSolution(root);
+    }
+  };
+
+  double gapStart = m_approximateResolutionMinimum;
+  double gapStartValue = evaluate(gapStart);
+  int i = 0;
+  while (true) {
+    // Merge the brackets overlapping the i-th one
+    double start = m_approximateResolutionMaximum;
+    double end = m_approximateResolutionMaximum;
+    int j = i;
+    if (i < numberOfCandidates) {
+      start = centers[i] - radii[i];
+      end = centers[i] + radii[i];
+      for (j = i + 1;
+           j < numberOfCandidates && centers[j] - radii[j] <= end; j++) {
+        end = std::max(end, centers[j] + radii[j]);
+      }
+      if (end < m_approximateResolutionMinimum) {
+        i = j;
+        continue;
+      }
+      start = std::max(start, m_approximateResolutionMinimum);
+      if (start > m_approximateResolutionMaximum) {
+        j = i;
+        start = end = m_approximateResolutionMaximum;
+      }
+      end = std::min(end, m_approximateResolutionMaximum);
+    }
+
+    // e must not change sign between the brackets
+    double startValue = evaluate(start);
+    if (start > gapStart &&
+        (changesSign(gapStartValue, evaluate((gapStart + start) / 2.)) ||
+         changesSign(gapStartValue, startValue))) {
+      return fallBack();
+    }
+    if (i == j) {
+      return true;
+    }
+
+    /* Distinct roots are honed in the pieces of the bracket split halfway
+     * between them, provided e changes sign on each. Otherwise the bracket
+     * holds a multiple root and any root of e is looked for. */
+    double pieceStarts[Polynomial::k_maxApproximateDegree];
+    double pieceStartValues[Polynomial::k_maxApproximateDegree + 1];
+    int numberOfPieces = j - i;
+    pieceStarts[0] = start;
+    pieceStartValues[0] = startValue;
+    double endValue = evaluate(end);
+    pieceStartValues[numberOfPieces] = endValue;
+    bool distinctRoots = true;
+    for (int k = 1; k <= numberOfPieces && distinctRoots; k++) {
+      if (k < numberOfPieces) {
+        pieceStarts[k] = (centers[i + k - 1] + centers[i + k]) / 2.;
+        pieceStartValues[k] = evaluate(pieceStarts[k]);
+      }
+      distinctRoots = changesSign(pieceStartValues[k - 1], pieceStartValues[k]);
+    }
+    if (distinctRoots) {
+      for (int k = 0; k < numberOfPieces; k++) {
+        Poincare::Solver<double> solver = PoincareHelpers::Solver(
+            pieceStarts[k], k + 1 < numberOfPieces ? pieceStarts[k + 1] : end,
+            m_variables[0], context);
+        if (!registerRoots(&solver, true)) {
+          return m_hasMoreSolutions || fallBack();
+        }
+      }
+    } else {
+      Poincare::Solver<double> solver =
+          PoincareHelpers::Solver(start, end, m_variables[0], context);
+      solver.stretch();
+      if (!registerRoots(&solver, false)) {
+        return m_hasMoreSolutions || fallBack();
+      }
+    }
+    gapStart = end;
+    gapStartValue = endValue;
+    i = j;
+  }
+}
+
 void SystemOfEquations::tidy(TreeNode *treePoolCursor) {
   for (int i = 0; i < k_maxNumberOfSolutions; i++) {
     if (treePoolCursor == nullptr ||
@@ -15,7 +15,9 @@ namespace Solver {
  * - exactSolve, which identify and compute exact solutions of linear systems,
  *   and polynomial equations of degree 2 or 3.
  * - approximateSolve, which computes numerical solutions for one equation of
- *   one variable, using an implementation of Brent's algorithm.
+ *   one variable, using an implementation of Brent's algorithm. The roots of
+ *   polynomial equations are first all approximated at once, so that Brent's
+ *   algorithm only hones them.
  *
  * FIXME Preliminary analysis of the system (e.g. identifiying variables...) is
  * only done when calling exactSolve. This works well for now as Solver will
@@ -90,6 +92,12 @@ class SystemOfEquations {
  private:
   constexpr static char k_parameterPrefix = 't';
   constexpr static double k_defaultApproximateSearchRange = 10.;
+  /* Roots of a polynomial whose imaginary part is below this ratio of their
+   * modulus may be real roots approximated with an error, for instance those
+   * of multiple roots. Brent's algorithm looks for them in a bracket of
+   * relative radius k_polynomialRootBracketRadius around their real part. */
+  constexpr static double k_polynomialRootMaxImaginaryRatio = 0.1;
+  constexpr static double k_polynomialRootBracketRadius = 1e-3;
 
   class ContextWithoutT : public Poincare::ContextWithParent {
    public:
@@ -108,6 +116,8 @@ class SystemOfEquations {
                           Poincare::Expression* simplifiedEquations);
   Error solvePolynomial(Poincare::Context* context,
                         Poincare::Expression* simplifiedEquations);
+  bool approximateSolvePolynomial(Poincare::Expression e,
+                                  Poincare::Context* context);
   uint32_t tagParametersUsedAsVariables() const;
   void tagVariableIfParameter(const char* name, uint32_t* tags) const;
 
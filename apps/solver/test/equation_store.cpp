@@ -125,6 +125,28 @@ QUIZ_CASE(solver_approximate) {
   assert_solves_numerically_to(
       "6x^5-x^4-43x^3+42x^2+x-7=0", -10, 10,
       {-2.99103, -0.3591962, 0.6322375, 0.8400476, 2.044608});
+  assert_solves_numerically_to("x^9-x=0", -10, 10, {-1, 0, 1});
+  // Polynomial with more real roots than displayed solutions
+  assert_solves_numerically_to(
+      "(x^2-1)(x^2-4)(x^2-9)(x^2-16)(x^2-25)(x^2-36)=0", -10, 10,
+      {-6, -5, -4, -3, -2, -1, 1, 2, 3, 4});
+  // Large, clustered and multiple roots of polynomials
+  assert_solves_numerically_to(
+      "(x^2-1)(x^2-4)(x^2-9)(x^2-16)(x^2-25)(x^2-36)(x^2-49)(x^2-64)(x^2-81)"
+      "(x^2-100)=0",
+      -10, 10, {-10, -9, -8, -7, -6, -5, -4, -3, -2, -1});
+  assert_solves_numerically_to(
+      "(x-1)(x-2)(x-3)(x-4)(x-5)(x-6)(x-7)(x-8)(x-9)(x-10)(x-11)(x-12)(x-13)"
+      "(x-14)(x-15)=0",
+      -10, 10, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  assert_solves_numerically_to(
+      "(x-0.1)(x-0.2)(x-0.3)(x-0.4)(x-0.5)(x-0.6)(x-0.7)(x-0.8)(x-0.9)(x-1)=0",
+      -10, 10, {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1});
+  assert_solves_numerically_to("(x-10)^12=0", -10, 10, {10});
+  assert_solves_numerically_to("(x-5)^10=0", -10, 10, {5});
+  // Complex roots close to the real axis are not real
+  assert_solves_numerically_to("(x^2+10^(-4))(x-2)(x-3)(x-4)=0", -10, 10,
+                               {2, 3, 4});
 
   // Filter out fake root and keep real ones
   assert_solves_numerically_to("floor(x)-0.5=0", -10, 10, {});
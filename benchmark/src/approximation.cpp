@@ -0,0 +1,241 @@
+#include <apps/shared/global_context.h>
+#include <poincare/approximation_dispatch.h>
+#include <poincare/expression.h>
+#include <poincare/float.h>
+#include <poincare/integral.h>
+#include <poincare/symbol.h>
+#include <poincare/worker_pool.h>
+
+#include <stdio.h>
+
+#include <cmath>
+#include <iterator>
+
+#include "benchmark.h"
+
+using namespace Poincare;
+
+namespace Benchmark {
+
+/* Approximate scalar inputs through the virtual approximateToComplex of the
+ * nodes and through the type switch of ApproximationDispatch. The test
+ * poincare_approximation_dispatch_throughput checks that both give the same
+ * results. */
+static void BenchmarkDispatch() {
+  constexpr const char* k_corpus[] = {
+      "(2+3i)^5×e^(iπ/3)",
+      "-(1.5-2/3)×√(-4)+ln(-1)-arg(i)",
+      "sin(π)+cos(π/2)",
+      "abs(3+4i)+re(conj(i))+im(2-i)",
+      "3×cos(2π/5)+√(2)",
+      "1/(1+1/(1+1/(1+1/(1+1/2))))",
+      "1+2×3-4/5+6×7-8/9+(1.5-2.5)×(3-4)/(5+6)-7×8+9/10+11×12-13/14",
+      "2^(1/2)×3^(1/3)×5^(1/5)",
+      "arcsin(0.5)+arccos(0.2)+arctan(7)",
+      "tan(1.2)^2-1/cos(1.2)^2",
+      "ln(2)+log(2)-√(-2)",
+      "(1+undef)×2",
+      "1/0",
+  };
+  constexpr int k_numberOfExpressions = std::size(k_corpus);
+  constexpr int k_numberOfRuns = 2000;
+  Shared::GlobalContext globalContext;
+  Expression expressions[k_numberOfExpressions];
+  ExpressionNode* nodes[k_numberOfExpressions];
+  for (int i = 0; i < k_numberOfExpressions; i++) {
+    expressions[i] = Expression::Parse(k_corpus[i], &globalContext);
+    nodes[i] = static_cast<ExpressionNode*>(
+        static_cast<TreeHandle&>(expressions[i]).node());
+  }
+  ApproximationContext context(&globalContext,
+                               Preferences::ComplexFormat::Cartesian,
+                               Preferences::AngleUnit::Radian);
+  std::complex<double> result;
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  for (int run = 0; run < k_numberOfRuns; run++) {
+    for (ExpressionNode* node : nodes) {
+      node->approximateToComplex(context, &result);
+    }
+  }
+  PrintDuration("Virtual dispatch", MillisecondsSince(startTime));
+  startTime = std::chrono::steady_clock::now();
+  for (int run = 0; run < k_numberOfRuns; run++) {
+    for (ExpressionNode* node : nodes) {
+      ApproximationDispatch::ApproximateToComplex<double>(node, context,
+                                                          &result);
+    }
+  }
+  PrintDuration("Type switch", MillisecondsSince(startTime));
+}
+
+/* Approximate an expression on the values of a curve, one value after the
+ * other and as a batch, which is split among the workers of the WorkerPool
+ * when there are some. The test poincare_approximation_with_values_for_symbol
+ * checks that both give the same results. */
+static void BenchmarkValuesForSymbol() {
+  constexpr int k_numberOfValues = 1000;
+  Shared::GlobalContext globalContext;
+  float values[k_numberOfValues];
+  float results[k_numberOfValues];
+  for (int i = 0; i < k_numberOfValues; i++) {
+    values[i] = -10.f + 20.f * i / k_numberOfValues;
+  }
+  ApproximationContext context(&globalContext, Preferences::ComplexFormat::Real,
+                               Preferences::AngleUnit::Radian);
+  Expression e = Expression::Parse("x^2×sin(x)+ln(x)", &globalContext);
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  for (int i = 0; i < k_numberOfValues; i++) {
+    results[i] =
+        e.approximateWithValueForSymbol<float>("x", values[i], context);
+  }
+  PrintDuration("1000 values one at a time", MillisecondsSince(startTime));
+  startTime = std::chrono::steady_clock::now();
+  e.approximateWithValuesForSymbol<float>("x", values, results,
+                                          k_numberOfValues, context);
+  PrintDuration(WorkerPool::NumberOfWorkers() > 0
+                    ? "1000 values on the workers"
+                    : "1000 values as a batch",
+                MillisecondsSince(startTime));
+}
+
+/* Integrate from a fixed bound to a moving one, as with the cursor of the
+ * graph, with and without the cache of the panels of the grid. The test
+ * poincare_approximation_integral_panel_cache checks that both give the same
+ * results. */
+static void BenchmarkIntegralPanels() {
+  constexpr const char* k_integrands[] = {
+      "x^2", "sin(x)", "√(abs(x))", "1/(1+25x^2)", "e^(-x^2)×cos(3x)",
+  };
+  constexpr double k_start = -1.3;
+  constexpr double k_gridStep = 0.5;
+  constexpr int k_numberOfSteps = 60;
+  Shared::GlobalContext globalContext;
+  ApproximationContext context(&globalContext, Preferences::ComplexFormat::Real,
+                               Preferences::AngleUnit::Radian);
+  for (bool usePanels : {false, true}) {
+    IntegralPanelCache cache;
+    std::chrono::steady_clock::time_point startTime =
+        std::chrono::steady_clock::now();
+    for (const char* integrand : k_integrands) {
+      Expression f = Expression::Parse(integrand, &globalContext);
+      for (int i = 0; i < k_numberOfSteps; i++) {
+        Integral integral = Integral::Builder(
+            f.clone(), Symbol::Builder('x'), Float<double>::Builder(k_start),
+            Float<double>::Builder(k_start + 0.1 * (i - 10)));
+        if (usePanels) {
+          integral.approximateWithPanelCache(&cache, k_gridStep, context);
+        } else {
+          integral.approximateToScalar<double>(context);
+        }
+      }
+    }
+    PrintDuration(usePanels ? "Moving bound with panels" : "Moving bound",
+                  MillisecondsSince(startTime));
+  }
+}
+
+/* Integrate functions which are singular on a bound, and go through tanh-sinh
+ * quadrature. They are the hard integrals of the test
+ * poincare_approximation_integral_panel_cache. */
+static void BenchmarkHardIntegrals() {
+  constexpr const char* k_hardIntegrals[] = {
+      "int(1/√(x),x,0,1)",
+      "int(ln(x)^2,x,0,1)",
+      "int(1/√(x)+1/√(1-x),x,0,1)",
+      "int(ln(x)×√(x),x,0,1)",
+      "int(2/√(1-x^2),x,0,1)",
+  };
+  constexpr int k_numberOfRuns = 20;
+  Shared::GlobalContext globalContext;
+  ApproximationContext context(&globalContext, Preferences::ComplexFormat::Real,
+                               Preferences::AngleUnit::Radian);
+  Expression integrals[std::size(k_hardIntegrals)];
+  for (size_t i = 0; i < std::size(k_hardIntegrals); i++) {
+    integrals[i] = Expression::Parse(k_hardIntegrals[i], &globalContext);
+  }
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  for (int run = 0; run < k_numberOfRuns; run++) {
+    for (const Expression& integral : integrals) {
+      integral.approximateToScalar<double>(context);
+    }
+  }
+  PrintDuration("Singular bounds", MillisecondsSince(startTime));
+}
+
+/* Approximate reductions and sorts of a list of 100 reals, and products,
+ * inverses and determinants of an 8x8 real matrix, which run through the dense
+ * real kernels of the lists and matrices. The lists and matrices are written
+ * out as literals, as when they are entered in the calculation app. */
+static void BenchmarkDenseKernels() {
+  constexpr int k_numberOfListElements = 100;
+  constexpr int k_matrixDimension = 8;
+  constexpr int k_numberOfRuns = 200;
+  char list[k_numberOfListElements * 16];
+  int length = snprintf(list, sizeof(list), "{");
+  for (int i = 0; i < k_numberOfListElements; i++) {
+    length += snprintf(list + length, sizeof(list) - length, "%s%.6f",
+                       i == 0 ? "" : ",", std::sin(i + 1.0));
+  }
+  snprintf(list + length, sizeof(list) - length, "}");
+  char matrix[k_matrixDimension * k_matrixDimension * 16];
+  length = snprintf(matrix, sizeof(matrix), "[");
+  for (int i = 0; i < k_matrixDimension; i++) {
+    length += snprintf(matrix + length, sizeof(matrix) - length, "[");
+    for (int j = 0; j < k_matrixDimension; j++) {
+      // The diagonal dominates, so that the matrix is invertible
+      length += snprintf(matrix + length, sizeof(matrix) - length, "%s%.6f",
+                         j == 0 ? "" : ",",
+                         (i == j ? 10.0 : 0.0) + std::cos(i * 7.0 + j));
+    }
+    length += snprintf(matrix + length, sizeof(matrix) - length, "]");
+  }
+  snprintf(matrix + length, sizeof(matrix) - length, "]");
+
+  struct Kernel {
+    const char* name;
+    const char* function;
+    const char* argument;
+  };
+  const Kernel k_kernels[] = {
+      {"List sum", "sum", list},
+      {"List product", "prod", list},
+      {"List variance", "var", list},
+      {"List median", "med", list},
+      {"List sort", "sort", list},
+      {"Matrix product", nullptr, matrix},
+      {"Matrix inverse", "inverse", matrix},
+      {"Matrix determinant", "det", matrix},
+  };
+  Shared::GlobalContext globalContext;
+  ApproximationContext context(&globalContext, Preferences::ComplexFormat::Real,
+                               Preferences::AngleUnit::Radian);
+  char text[sizeof(matrix) * 2 + 16];
+  for (const Kernel& kernel : k_kernels) {
+    if (kernel.function) {
+      snprintf(text, sizeof(text), "%s(%s)", kernel.function, kernel.argument);
+    } else {
+      snprintf(text, sizeof(text), "%s×%s", kernel.argument, kernel.argument);
+    }
+    Expression e = Expression::Parse(text, &globalContext);
+    std::chrono::steady_clock::time_point startTime =
+        std::chrono::steady_clock::now();
+    for (int run = 0; run < k_numberOfRuns; run++) {
+      e.approximateToEvaluation<double>(context);
+    }
+    PrintDuration(kernel.name, MillisecondsSince(startTime));
+  }
+}
+
+void Approximation() {
+  PrintTitle("Approximation");
+  BenchmarkDispatch();
+  BenchmarkValuesForSymbol();
+  BenchmarkIntegralPanels();
+  BenchmarkHardIntegrals();
+  BenchmarkDenseKernels();
+}
+
+}  // namespace Benchmark
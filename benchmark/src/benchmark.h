@@ -0,0 +1,30 @@
+#ifndef BENCHMARK_BENCHMARK_H
+#define BENCHMARK_BENCHMARK_H
+
+#include <apps/i18n.h>
+
+#include <chrono>
+
+namespace Benchmark {
+
+// Ion::Timing::millis is too coarse for a single frame
+float MillisecondsSince(std::chrono::steady_clock::time_point startTime);
+void PrintTitle(const char* title);
+void PrintDuration(const char* name, float milliseconds);
+// Return false, with a note, if the app is not part of the build
+bool SwitchToApp(I18n::Message name);
+
+/* Each benchmark prints its measures under its title. They are run in this
+ * order by ion_main. */
+void Approximation();
+void Calculation();
+void ExactValues();
+void LayoutField();
+void Parsing();
+void Plots();
+void Python();
+void Storage();
+
+}  // namespace Benchmark
+
+#endif
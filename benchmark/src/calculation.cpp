@@ -0,0 +1,56 @@
+#include <apps/shared/expression_display_permissions.h>
+#include <apps/shared/global_context.h>
+#include <apps/shared/poincare_helpers.h>
+#include <poincare/expression.h>
+
+#include "benchmark.h"
+
+using namespace Poincare;
+
+namespace Benchmark {
+
+// Follow the steps of CalculationStore::push up to the approximate output
+static Expression ApproximateOutput(const char* input, bool skipReduction,
+                                    Context* context) {
+  Expression e = Expression::Parse(input, context);
+  if (skipReduction &&
+      Shared::ExpressionDisplayPermissions::ReductionOfInputCanBeSkipped(
+          e, context)) {
+    return Shared::PoincareHelpers::Approximate<double>(e, context);
+  }
+  Expression exact, approximate;
+  Shared::PoincareHelpers::CloneAndSimplifyAndApproximate(
+      e, &exact, &approximate, context,
+      {.symbolicComputation =
+           SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined});
+  return approximate;
+}
+
+void Calculation() {
+  // Inputs typical of a calculation history
+  constexpr const char* k_historyInputs[] = {
+      "1+3/4",                "2^10",
+      "√(2)/2",               "1.5×3.2",
+      "diff(x^3,x,2)",        "int(x^2,x,0,1)",
+      "int(e^(-x^2),x,-3,3)", "sum(1/k^2,k,1,100)",
+      "normcdf(1.96,0,1)",    "binompdf(3,10,0.5)",
+      "round(π,3)",           "random()",
+      "randint(1,6)"};
+  constexpr int k_numberOfRuns = 20;
+  PrintTitle("Calculation");
+  Shared::GlobalContext context;
+  for (bool skipReduction : {false, true}) {
+    std::chrono::steady_clock::time_point startTime =
+        std::chrono::steady_clock::now();
+    for (int run = 0; run < k_numberOfRuns; run++) {
+      for (const char* input : k_historyInputs) {
+        ApproximateOutput(input, skipReduction, &context);
+      }
+    }
+    PrintDuration(skipReduction ? "History, skipped reduction"
+                                : "History, full reduction",
+                  MillisecondsSince(startTime));
+  }
+}
+
+}  // namespace Benchmark
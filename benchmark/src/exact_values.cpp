@@ -0,0 +1,75 @@
+#include <apps/graph/app.h>
+#include <apps/graph/values/exact_values_cache.h>
+#include <apps/graph/values/exact_values_job.h>
+#include <apps/shared/global_context.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+
+/* Exact values benchmark. The exact values of a catalog of functions are
+ * computed over the interval of the values table by an ExactValuesJob, as
+ * when the table is idle. The time the cache records for the column is
+ * reported along with the time of the whole job. */
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Benchmark {
+
+constexpr static const char* k_functions[] = {
+    "f(x)=x^2-2",          "f(x)=√(x)/x",        "f(x)=sin(πx/6)",
+    "f(x)=ln(x)",          "f(x)=e^(x/2)",       "f(x)=(x^2+1)/(x-3)",
+    "f(x)=binomial(20,x)", "f(x)=√(x^2+2x+3)",
+};
+
+void ExactValues() {
+  if (!SwitchToApp(I18n::Message::FunctionApp)) {
+    return;
+  }
+  Graph::App* app = Graph::App::app();
+  Context* context = app->localContext();
+  ContinuousFunctionStore* store = app->functionStore();
+  Interval* interval = app->intervalForSymbolType(
+      ContinuousFunctionProperties::SymbolType::X);
+  Interval::IntervalParameters parameters;
+  parameters.setStart(-10.);
+  parameters.setEnd(10.);
+  parameters.setStep(0.5);
+  interval->setParameters(parameters);
+  interval->forceRecompute();
+  // The cache is too large for the stack
+  static Graph::ExactValuesCache s_cache;
+
+  printf("\n%s\n%-34s %10s %10s %10s\n", "Exact values", "function", "rows",
+         "ms", "ms");
+  printf("%-34s %10s %10s %10s\n", "", "", "(column)", "(job)");
+  for (const char* definition : k_functions) {
+    store->removeAll();
+    if (store->addEmptyModel() != Ion::Storage::Record::ErrorStatus::None ||
+        store->modelForRecord(store->recordAtIndex(0))
+                ->setContent(definition, context) !=
+            Ion::Storage::Record::ErrorStatus::None) {
+      printf("%-34s could not be defined\n", definition);
+      continue;
+    }
+    s_cache.reset();
+    s_cache.addColumn(store->recordAtIndex(0));
+    Graph::ExactValuesJob job(&s_cache);
+    std::chrono::steady_clock::time_point startTime =
+        std::chrono::steady_clock::now();
+    job.runUntilDone();
+    float jobTime = MillisecondsSince(startTime);
+    int numberOfRows = 0;
+    for (int row = 0; row < interval->numberOfElements(); row++) {
+      numberOfRows += s_cache.hasLayout(0, row, interval->element(row));
+    }
+    printf("%-34s %10d %10u %10.2f\n", definition, numberOfRows,
+           static_cast<unsigned>(s_cache.millisecondsSpentOnColumn(0)),
+           jobTime);
+  }
+  store->removeAll();
+  s_cache.reset();
+  interval->reset();
+}
+
+}  // namespace Benchmark
@@ -0,0 +1,51 @@
+#include <escher/layout_field.h>
+#include <escher/window.h>
+#include <ion/events.h>
+
+#include "benchmark.h"
+
+using namespace Escher;
+
+namespace Benchmark {
+
+void LayoutField() {
+  constexpr int k_numberOfDigits = 200;
+  PrintTitle("Layout field");
+  Escher::LayoutField field(nullptr, nullptr);
+  Window window;
+  window.setAbsoluteFrame(KDRectScreen);
+  window.setContentView(&field);
+  field.setEditing(true);
+
+  // A 10x10 matrix of 0, with the cursor in its last entry
+  constexpr int k_dimension = 10;
+  char text[k_dimension * (1 + 2 * k_dimension) + 3];
+  int length = 0;
+  text[length++] = '[';
+  for (int i = 0; i < k_dimension; i++) {
+    text[length++] = '[';
+    for (int j = 0; j < k_dimension; j++) {
+      text[length++] = '0';
+      text[length++] = j < k_dimension - 1 ? ',' : ']';
+    }
+  }
+  text[length++] = ']';
+  text[length] = 0;
+  field.handleEventWithText(text);
+  field.putCursorOnOneSide(OMG::Direction::Right());
+  field.handleEvent(Ion::Events::Left);
+  window.redraw(true);
+
+  // Each digit is typed, deleted and drawn as it would be on the device
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  for (int i = 0; i < k_numberOfDigits; i++) {
+    field.handleEvent(Ion::Events::One);
+    window.redraw();
+    field.handleEvent(Ion::Events::Backspace);
+    window.redraw();
+  }
+  PrintDuration("200 digits in a 10x10 matrix", MillisecondsSince(startTime));
+}
+
+}  // namespace Benchmark
@@ -0,0 +1,77 @@
+#include <apps/apps_container.h>
+#include <apps/init.h>
+#include <escher/init.h>
+#include <ion.h>
+#include <poincare/init.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+namespace Benchmark {
+
+float MillisecondsSince(std::chrono::steady_clock::time_point startTime) {
+  return std::chrono::duration<float, std::milli>(
+             std::chrono::steady_clock::now() - startTime)
+      .count();
+}
+
+void PrintTitle(const char* title) { printf("\n%s\n", title); }
+
+void PrintDuration(const char* name, float milliseconds) {
+  printf("%-34s %10.2f ms\n", name, milliseconds);
+}
+
+bool SwitchToApp(I18n::Message name) {
+  AppsContainer* container = AppsContainer::sharedAppsContainer();
+  int numberOfApps = container->numberOfBuiltinApps();
+  for (int i = 0; i < numberOfApps; i++) {
+    Escher::App::Snapshot* snapshot = container->appSnapshotAtIndex(i);
+    if (snapshot->descriptor()->name() == name) {
+      container->switchToBuiltinApp(snapshot);
+      return true;
+    }
+  }
+  printf("\nThe app is not part of this build, it is skipped\n");
+  return false;
+}
+
+struct NamedBenchmark {
+  const char* name;
+  void (*run)();
+};
+
+constexpr static NamedBenchmark k_benchmarks[] = {
+    {"approximation", Approximation},
+    {"calculation", Calculation},
+    {"exact_values", ExactValues},
+    {"layout_field", LayoutField},
+    {"parsing", Parsing},
+    {"plots", Plots},
+    {"python", Python},
+    {"storage", Storage},
+};
+
+}  // namespace Benchmark
+
+void ion_main(int argc, const char* const argv[]) {
+  Poincare::Init();
+  Escher::Init();
+  Apps::Init();
+  volatile int stackTop;
+  Ion::setStackStart((void*)(&stackTop));
+
+  // As with the tests, -f only runs the benchmarks whose name starts with it
+  const char* filter = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "--filter") == 0 || strcmp(argv[i], "-f") == 0) &&
+        i + 1 < argc) {
+      filter = argv[i + 1];
+    }
+  }
+  for (const Benchmark::NamedBenchmark& benchmark : Benchmark::k_benchmarks) {
+    if (!filter || strstr(benchmark.name, filter) == benchmark.name) {
+      benchmark.run();
+    }
+  }
+}
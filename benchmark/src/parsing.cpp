@@ -0,0 +1,42 @@
+#include <apps/shared/global_context.h>
+#include <poincare/expression.h>
+
+#include "benchmark.h"
+
+using namespace Poincare;
+
+namespace Benchmark {
+
+/* Parse typical inputs of the apps. Most of the time is spent splitting
+ * identifiers, which tries every substring as a reserved name or a unit. */
+constexpr static const char* k_parsingCorpus[] = {
+    "3×cos(2π/5)+√(2)",
+    "abcdefghij",
+    "xyzt^2+tanh(x)-arcsin(y)",
+    "int(e^(-x^2),x,0,∞)",
+    "_km/_h→_m/_s",
+    "5_kg×9.81_m/_s^2",
+    "binompdf(3,10,0.2)+normcdf(1,0,1)",
+    "sum(k^2,k,1,n)",
+    "[[1,2][3,4]]^-1",
+    "log(ab)+ln(cd)+exp(ef)",
+    "{1,2,3}+mean({4,5,6})",
+    "piecewise(-x,x<0,x)",
+    "3km+2kg×5mA",
+};
+
+void Parsing() {
+  constexpr int k_numberOfRuns = 200;
+  PrintTitle("Parsing");
+  Shared::GlobalContext context;
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  for (int run = 0; run < k_numberOfRuns; run++) {
+    for (const char* input : k_parsingCorpus) {
+      Expression::Parse(input, &context);
+    }
+  }
+  PrintDuration("200 runs of the corpus", MillisecondsSince(startTime));
+}
+
+}  // namespace Benchmark
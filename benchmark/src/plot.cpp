@@ -0,0 +1,273 @@
+#include <apps/apps_container.h>
+#include <apps/distributions/models/calculation/left_integral_calculation.h>
+#include <apps/distributions/models/distribution/binomial_distribution.h>
+#include <apps/distributions/models/distribution/normal_distribution.h>
+#include <apps/distributions/probability/distribution_curve_view.h>
+#include <apps/graph/graph/graph_view.h>
+#include <apps/i18n.h>
+#include <apps/sequence/graph/graph_view.h>
+#include <apps/shared/global_context.h>
+#include <escher/metric.h>
+#include <ion.h>
+#include <kandinsky/framebuffer.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+
+#if !PLOT_VIEW_COUNT_EVALUATIONS
+#error "The plotting benchmark needs PLOT_VIEW_COUNT_EVALUATIONS=1"
+#endif
+
+/* Plotting throughput benchmark. A catalog of curves is drawn by the plot
+ * views of the Graph, Sequence and Distributions apps into an in-memory
+ * context, at several zooms. For each curve and zoom, the first frame is drawn
+ * after the range has changed, as when the user zooms, and is followed by
+ * redraws of the same range, which may use the caches of the models. The
+ * number of evaluations of the models and the time of each kind of frame are
+ * reported. */
+
+using namespace Escher;
+using namespace Poincare;
+using namespace Shared;
+
+namespace Benchmark {
+
+constexpr static int k_numberOfRedraws = 10;
+constexpr static KDCoordinate k_width = Ion::Display::Width;
+constexpr static KDCoordinate k_height =
+    Metric::DisplayHeightWithoutTitleBar - Metric::TabHeight;
+
+class FrameBufferContext : public KDContext {
+ public:
+  FrameBufferContext()
+      : KDContext(KDPointZero, KDRect(0, 0, k_width, k_height)),
+        m_frameBuffer(m_pixels, KDSize(k_width, k_height)) {}
+
+ private:
+  void pushRect(KDRect rect, const KDColor* pixels) override {
+    m_frameBuffer.pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_frameBuffer.pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor* pixels) override {
+    m_frameBuffer.pullRect(rect, pixels);
+  }
+
+  KDColor m_pixels[k_width * k_height];
+  KDFrameBuffer m_frameBuffer;
+};
+
+// The plot views are drawn without focus, so that the banner is hidden
+class EmptyBannerView : public BannerView {
+ private:
+  int numberOfSubviews() const override { return 0; }
+  View* subviewAtIndex(int index) override {
+    assert(false);
+    return nullptr;
+  }
+};
+
+struct Window {
+  float xMin;
+  float xMax;
+  float yMin;
+  float yMax;
+};
+
+struct Curve {
+  const char* definition;
+  Window window;
+  // Sequences only
+  const char* firstInitialCondition = nullptr;
+  const char* secondInitialCondition = nullptr;
+};
+
+// The window of each curve is scaled around its center
+constexpr static float k_zooms[] = {0.01f, 1.f, 100.f};
+
+constexpr static Window k_standardWindow = {-10.f, 10.f, -6.f, 6.f};
+
+constexpr static Curve k_functions[] = {
+    {"f(x)=0.1x^3-x+1", k_standardWindow},
+    {"f(x)=sin(x)+cos(3x)", k_standardWindow},
+    {"f(x)=1/x", k_standardWindow},
+    {"f(x)=floor(x)", k_standardWindow},
+    {"f(t)=[[5cos(3t)][5sin(2t)]]", k_standardWindow},
+    {"r=5cos(5θ)", k_standardWindow},
+    {"f(x)=piecewise(-x,x<0,ln(x),x>0)", k_standardWindow},
+};
+
+constexpr static Curve k_sequences[] = {
+    {"sin(n/10)", {0.f, 300.f, -1.2f, 1.2f}},
+    {"u(n)+1/(n+1)", {0.f, 300.f, -1.f, 8.f}, "0"},
+    {"0.5u(n+1)+0.5u(n)", {0.f, 300.f, -0.2f, 1.2f}, "0", "1"},
+};
+
+struct DistributionParameters {
+  double firstParameter;
+  double secondParameter;
+};
+
+constexpr static DistributionParameters k_binomialParameters[] = {
+    {20., 0.5}, {200., 0.5}, {2000., 0.3}};
+
+constexpr static DistributionParameters k_normalParameters[] = {
+    {0., 1.}, {0., 100.}, {1000., 0.01}};
+
+static FrameBufferContext s_context;
+
+static void ApplyZoom(InteractiveCurveViewRange* range, Window window,
+                      float zoom) {
+  float xCenter = (window.xMin + window.xMax) / 2.f;
+  float yCenter = (window.yMin + window.yMax) / 2.f;
+  range->setZoomAuto(false);
+  range->setXRange(xCenter + zoom * (window.xMin - xCenter),
+                   xCenter + zoom * (window.xMax - xCenter));
+  range->setYRange(yCenter + zoom * (window.yMin - yCenter),
+                   yCenter + zoom * (window.yMax - yCenter));
+}
+
+static void PrintHeader(const char* title) {
+  printf("\n%s\n%-34s %8s %10s %10s %10s %10s\n", title, "curve", "zoom",
+         "evals", "ms", "evals", "ms");
+  printf("%-34s %8s %21s %21s\n", "", "", "(first frame)", "(redraw)");
+}
+
+static void DrawFrames(AbstractPlotView* view, const char* name, float zoom) {
+  view->setSize(KDSize(k_width, k_height));
+  view->reload(true, true);
+  KDRect bounds = view->bounds();
+
+  view->resetNumberOfEvaluations();
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  view->drawRect(&s_context, bounds);
+  float firstFrameTime = MillisecondsSince(startTime);
+  int firstFrameEvaluations = view->numberOfEvaluations();
+
+  view->resetNumberOfEvaluations();
+  startTime = std::chrono::steady_clock::now();
+  for (int i = 0; i < k_numberOfRedraws; i++) {
+    view->drawRect(&s_context, bounds);
+  }
+  float redrawTime = MillisecondsSince(startTime) / k_numberOfRedraws;
+  float redrawEvaluations =
+      static_cast<float>(view->numberOfEvaluations()) / k_numberOfRedraws;
+
+  printf("%-34s %8g %10d %10.2f %10.0f %10.2f\n", name, zoom,
+         firstFrameEvaluations, firstFrameTime, redrawEvaluations, redrawTime);
+}
+
+static void BenchmarkFunctions() {
+  if (!SwitchToApp(I18n::Message::FunctionApp)) {
+    return;
+  }
+  // The graph view of the Graph app reads its functions from the active app
+  Context* context = App::app()->localContext();
+  ContinuousFunctionStore* store =
+      GlobalContext::continuousFunctionStore.get();
+  InteractiveCurveViewRange range;
+  CurveViewCursor cursor;
+  EmptyBannerView banner;
+  Graph::GraphView view(&range, &cursor, &banner, nullptr);
+  view.setContext(context);
+
+  PrintHeader("Graph");
+  for (const Curve& curve : k_functions) {
+    store->removeAll();
+    if (store->addEmptyModel() != Ion::Storage::Record::ErrorStatus::None ||
+        store->modelForRecord(store->recordAtIndex(0))
+                ->setContent(curve.definition, context) !=
+            Ion::Storage::Record::ErrorStatus::None) {
+      printf("%-34s could not be defined\n", curve.definition);
+      continue;
+    }
+    for (float zoom : k_zooms) {
+      ApplyZoom(&range, curve.window, zoom);
+      DrawFrames(&view, curve.definition, zoom);
+    }
+  }
+  store->removeAll();
+}
+
+static void BenchmarkSequences() {
+  if (!SwitchToApp(I18n::Message::SequenceApp)) {
+    return;
+  }
+  SequenceContext* context =
+      AppsContainer::sharedAppsContainer()->globalContext()->sequenceContext();
+  SequenceStore* store = GlobalContext::sequenceStore.get();
+  InteractiveCurveViewRange range;
+  CurveViewCursor cursor;
+  EmptyBannerView banner;
+  Sequence::GraphView view(store, &range, &cursor, &banner, nullptr);
+  view.setContext(context);
+
+  PrintHeader("Sequence");
+  for (const Curve& curve : k_sequences) {
+    store->removeAll();
+    context->resetCache();
+    if (store->addEmptyModel() != Ion::Storage::Record::ErrorStatus::None) {
+      continue;
+    }
+    Shared::Sequence* sequence = store->modelForRecord(store->recordAtIndex(0));
+    sequence->setType(curve.secondInitialCondition
+                          ? Shared::Sequence::Type::DoubleRecurrence
+                      : curve.firstInitialCondition
+                          ? Shared::Sequence::Type::SingleRecurrence
+                          : Shared::Sequence::Type::Explicit);
+    if (sequence->setContent(curve.definition, context) !=
+            Ion::Storage::Record::ErrorStatus::None ||
+        (curve.firstInitialCondition &&
+         sequence->setFirstInitialConditionContent(
+             curve.firstInitialCondition, context) !=
+             Ion::Storage::Record::ErrorStatus::None) ||
+        (curve.secondInitialCondition &&
+         sequence->setSecondInitialConditionContent(
+             curve.secondInitialCondition, context) !=
+             Ion::Storage::Record::ErrorStatus::None)) {
+      printf("%-34s could not be defined\n", curve.definition);
+      continue;
+    }
+    for (float zoom : k_zooms) {
+      ApplyZoom(&range, curve.window, zoom);
+      DrawFrames(&view, curve.definition, zoom);
+    }
+  }
+  store->removeAll();
+  context->resetCache();
+}
+
+template <typename D>
+static void BenchmarkDistribution(
+    const char* name, const DistributionParameters (&parameters)[3]) {
+  D distribution;
+  Distributions::LeftIntegralCalculation calculation(&distribution);
+  Distributions::DistributionCurveView view(&distribution, &calculation);
+  char label[64];
+  for (DistributionParameters p : parameters) {
+    // The distribution computes its own range from its parameters
+    distribution.setParameterAtIndex(p.firstParameter, 0);
+    distribution.setParameterAtIndex(p.secondParameter, 1);
+    snprintf(label, sizeof(label), "%s(%g,%g)", name, p.firstParameter,
+             p.secondParameter);
+    DrawFrames(&view, label, 1.f);
+  }
+}
+
+static void BenchmarkDistributions() {
+  PrintHeader("Distributions");
+  BenchmarkDistribution<Distributions::BinomialDistribution>(
+      "binomial", k_binomialParameters);
+  BenchmarkDistribution<Distributions::NormalDistribution>(
+      "normal", k_normalParameters);
+}
+
+void Plots() {
+  BenchmarkFunctions();
+  BenchmarkSequences();
+  BenchmarkDistributions();
+}
+
+}  // namespace Benchmark
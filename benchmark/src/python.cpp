@@ -0,0 +1,139 @@
+#include <apps/code/app.h>
+#include <python/port/port.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+namespace Benchmark {
+
+/* Scripts measuring the throughput of the interpreter on the kinds of code
+ * met in the Code app: loops of arithmetic, calls of Python functions, float
+ * computations and list and string manipulations. The numpy scripts repeat
+ * their operations on arrays of 1000 floats, since arrays of 10k floats do not
+ * fit in the heap. The strided scripts run the same operations on views of
+ * every other element, which go through the generic loops. */
+
+struct PythonScript {
+  const char* name;
+  const char* script;
+};
+
+constexpr static PythonScript k_scripts[] = {
+    {"Integer loop",
+     "s = 0\n"
+     "for i in range(300000):\n"
+     "  s += i * i % 7\n"},
+    {"While loop",
+     "i = 0\n"
+     "while i < 500000:\n"
+     "  i += 1\n"},
+    {"Function calls",
+     "def f(x):\n"
+     "  return x + 1\n"
+     "s = 0\n"
+     "for i in range(200000):\n"
+     "  s = f(s)\n"},
+    // The recursion is kept shallow to fit in the stack of debug builds
+    {"Recursion",
+     "def t(n):\n"
+     "  return 1 if n == 0 else t(n - 1) + t(n - 1) + t(n - 1) + t(n - 1)\n"
+     "t(8)\n"},
+    {"Float math",
+     "from math import *\n"
+     "s = 0.0\n"
+     "for i in range(100000):\n"
+     "  s += sin(i) * sqrt(i) / (1 + exp(-i / 1000))\n"},
+    {"Lists",
+     "for k in range(50):\n"
+     "  l = [i for i in range(1000)]\n"
+     "  l.sort(reverse=True)\n"
+     "  s = sum([x * 2 for x in l if x % 3])\n"},
+    {"Strings",
+     "s = ''\n"
+     "for i in range(50000):\n"
+     "  s = str(i) + s[:50]\n"},
+};
+
+#define NUMPY_ARRAYS                  \
+  "import numpy as np\n"              \
+  "a = np.linspace(0.5, 1.5, 1000)\n" \
+  "b = np.linspace(1.0, 2.0, 1000)\n"
+
+#define NUMPY_STRIDED_ARRAYS          \
+  "import numpy as np\n"              \
+  "x = np.linspace(0.5, 2.0, 2000)\n" \
+  "a = x[::2]\n"                      \
+  "b = x[1::2]\n"
+
+#define NUMPY_ARITHMETIC   \
+  "for i in range(100):\n" \
+  "  c = (a + b) * a - b / a\n"
+
+#define NUMPY_REDUCTIONS                                      \
+  "for i in range(100):\n"                                    \
+  "  s = np.sum(a) + np.mean(b) + np.std(a) + np.dot(a, b)\n" \
+  "  c = np.polyval([1.0, -2.0, 3.0, -4.0], a)\n"
+
+constexpr static PythonScript k_numpyScripts[] = {
+    {"Numpy arithmetic", NUMPY_ARRAYS NUMPY_ARITHMETIC},
+    {"Numpy strided arithmetic", NUMPY_STRIDED_ARRAYS NUMPY_ARITHMETIC},
+    {"Numpy reductions", NUMPY_ARRAYS NUMPY_REDUCTIONS},
+    {"Numpy strided reductions", NUMPY_STRIDED_ARRAYS NUMPY_REDUCTIONS},
+};
+
+// The output of the scripts is dropped, only their errors are reported
+class SilentExecutionEnvironment : public MicroPython::ExecutionEnvironment {
+ public:
+  void printText(const char* text, size_t length) override {}
+};
+
+static char s_pythonHeap[Code::App::k_pythonHeapSize];
+
+/* Runs the script as a single input of the console, as exec of its text
+ * where new lines are escaped. */
+static bool RunScript(const char* script) {
+  constexpr static const char* k_openExec = "exec(\"";
+  constexpr static const char* k_closeExec = "\")";
+  constexpr size_t k_bufferSize = 1000;
+  char buffer[k_bufferSize];
+  size_t length = strlcpy(buffer, k_openExec, k_bufferSize);
+  for (const char* c = script; *c != 0; c++) {
+    if (length + 2 + strlen(k_closeExec) >= k_bufferSize) {
+      return false;
+    }
+    if (*c == '\n') {
+      buffer[length++] = '\\';
+      buffer[length++] = 'n';
+    } else {
+      buffer[length++] = *c;
+    }
+  }
+  strlcpy(buffer + length, k_closeExec, k_bufferSize - length);
+  MicroPython::init(s_pythonHeap, s_pythonHeap + Code::App::k_pythonHeapSize);
+  SilentExecutionEnvironment environment;
+  bool succeeded = environment.runCode(buffer);
+  MicroPython::deinit();
+  return succeeded;
+}
+
+template <int N>
+static void BenchmarkScripts(const PythonScript (&scripts)[N]) {
+  for (const PythonScript& script : scripts) {
+    std::chrono::steady_clock::time_point startTime =
+        std::chrono::steady_clock::now();
+    if (RunScript(script.script)) {
+      PrintDuration(script.name, MillisecondsSince(startTime));
+    } else {
+      printf("%-34s %13s\n", script.name, "failed");
+    }
+  }
+}
+
+void Python() {
+  PrintTitle("Python");
+  BenchmarkScripts(k_scripts);
+  BenchmarkScripts(k_numpyScripts);
+}
+
+}  // namespace Benchmark
@@ -0,0 +1,55 @@
+#include <ion/storage/file_system.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+using namespace Ion;
+
+namespace Benchmark {
+
+void Storage() {
+  constexpr int k_numberOfEdits = 200;
+  PrintTitle("Storage");
+  Storage::FileSystem* fileSystem = Storage::FileSystem::sharedFileSystem;
+  const char* scriptText = "from math import *\n";
+  fileSystem->createRecordWithExtension("script", "py", scriptText,
+                                        strlen(scriptText) + 1);
+
+  // 40 KB of records after the script
+  constexpr int k_numberOfOtherRecords = 40;
+  constexpr size_t k_otherRecordSize = 1000;
+  char otherData[k_otherRecordSize];
+  memset(otherData, 'a', k_otherRecordSize);
+  char otherBaseName[] = "otherA";
+  for (int i = 0; i < k_numberOfOtherRecords; i++) {
+    otherBaseName[5] = 'A' + i;
+    fileSystem->createRecordWithExtension(otherBaseName, "rec", otherData,
+                                          k_otherRecordSize);
+  }
+
+  /* A character is typed in the script as the Python editor does, which takes
+   * and gives back the available space, and the script is renamed. */
+  size_t scriptLength = strlen(scriptText);
+  std::chrono::steady_clock::time_point startTime =
+      std::chrono::steady_clock::now();
+  for (int i = 0; i < k_numberOfEdits; i++) {
+    Storage::Record script = fileSystem->recordBaseNamedWithExtension(
+        i % 2 == 0 ? "script" : "edited", "py");
+    fileSystem->putAvailableSpaceAtEndOfRecord(script);
+    Storage::Record::Data value = script.value();
+    char* text = const_cast<char*>(static_cast<const char*>(value.buffer));
+    text[scriptLength++] = '#';
+    text[scriptLength] = 0;
+    fileSystem->getAvailableSpaceFromEndOfRecord(
+        script, value.size - (scriptLength + 1));
+    Storage::Record::SetBaseNameWithExtension(
+        &script, i % 2 == 0 ? "edited" : "script", "py");
+  }
+  PrintDuration("200 edits before 40 KB of records",
+                MillisecondsSince(startTime));
+
+  fileSystem->destroyRecordsWithExtension("rec");
+  fileSystem->destroyRecordsWithExtension("py");
+}
+
+}  // namespace Benchmark
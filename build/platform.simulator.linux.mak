@@ -3,3 +3,4 @@ EXE = bin
 
 EPSILON_TELEMETRY ?= 0
 TERMS_OF_USE ?= 0
+OMG_THREAD_LOCAL_GLOBALS ?= 1
@@ -5,6 +5,7 @@ APPLE_PLATFORM = macos
 APPLE_PLATFORM_MIN_VERSION = 10.10
 EPSILON_TELEMETRY ?= 0
 TERMS_OF_USE ?= 0
+OMG_THREAD_LOCAL_GLOBALS ?= 1
 
 ifeq ($(DEBUG),1)
 ARCHS ?= $(shell uname -m)
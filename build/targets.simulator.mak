@@ -1,2 +1,12 @@
 -include build/targets.simulator.$(TARGET).mak
 -include build/targets.simulator.$(COVERAGE).mak
+
+# In-process fuzzing harness, see fuzz/README.md
+fuzz_runner_src = $(base_src) $(filter-out apps/main.cpp,$(apps_src)) $(fuzz_src)
+$(BUILD_DIR)/fuzz.$(EXE): $(call flavored_object_for,$(fuzz_runner_src),)
+HANDY_TARGETS += fuzz
+
+# Plotting throughput benchmark, see benchmark/README.md
+benchmark_runner_src = $(base_src) $(filter-out apps/main.cpp,$(apps_src)) $(benchmark_src)
+$(BUILD_DIR)/benchmark.$(EXE): $(call flavored_object_for,$(benchmark_runner_src),)
+HANDY_TARGETS += benchmark
@@ -0,0 +1,20 @@
+CC = clang
+CXX = clang++
+LD = clang++
+
+# Instrument everything, fuzz/src/main.cpp then hands control to the libFuzzer
+# driver
+SFLAGS += -fsanitize=fuzzer-no-link -DFUZZ_LIBFUZZER=1
+LDFLAGS += -fsanitize=fuzzer-no-link $(shell clang -print-file-name=libclang_rt.fuzzer_no_main-x86_64.a)
+
+ifeq ($(ASAN),1)
+SFLAGS += -fsanitize=address
+LDFLAGS += -fsanitize=address
+endif
+
+# Always use assertions when the code is being fuzzed
+ASSERTIONS = 1
+
+ifeq ($(ASSERTIONS),0)
+$(error ASSERTIONS=0 is useless with libfuzzer toolchain: assertions won't be handled.)
+endif
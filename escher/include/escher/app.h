@@ -12,6 +12,7 @@
 #include <escher/warning_controller.h>
 #include <ion/storage/file_system.h>
 #include <poincare/context.h>
+#include <poincare/job.h>
 
 /* An app is fed events and outputs drawing calls.
  *
@@ -95,6 +96,12 @@ class App : public Responder {
     return nullptr;
   }
   virtual Poincare::Context* localContext() { return nullptr; }
+  /* The background job is advanced by the run loop, a time slice at a time,
+   * while no event is pending. It is cancelled if it is replaced or if the app
+   * becomes inactive before it is over. */
+  Poincare::Job* backgroundJob() const { return m_backgroundJob; }
+  void setBackgroundJob(Poincare::Job* job);
+  void didAdvanceBackgroundJob();
   virtual EditableFieldHelpBox* toolbox() { return nullptr; }
   virtual EditableFieldHelpBox* variableBox() { return nullptr; }
 
@@ -117,13 +124,17 @@ class App : public Responder {
         m_modalViewController(this, rootViewController),
         m_firstResponder(this),
         m_snapshot(snapshot),
-        m_warningController(this, warningMessage) {}
+        m_warningController(this, warningMessage),
+        m_backgroundJob(nullptr) {}
+  // Called after each time slice given to the background job
+  virtual void backgroundJobDidAdvance(Poincare::Job* job) {}
   ModalViewController m_modalViewController;
 
  private:
   Responder* m_firstResponder;
   Snapshot* m_snapshot;
   WarningController m_warningController;
+  Poincare::Job* m_backgroundJob;
 };
 
 }  // namespace Escher
@@ -0,0 +1,57 @@
+#ifndef ESCHER_DIRTY_REGION_H
+#define ESCHER_DIRTY_REGION_H
+
+#include <kandinsky/rect.h>
+#include <stdint.h>
+
+namespace Escher {
+
+/* A DirtyRegion is a union of at most k_maxNumberOfRects rectangles. Unioning
+ * two distant rectangles into their bounding rectangle would also dirty all
+ * the pixels in between, like when a cursor jumps from a corner of a graph to
+ * the other one. So rectangles are only merged:
+ * - if their union is not larger than their two areas together, which is the
+ *   case of overlapping or adjacent rectangles,
+ * - or when the region is full, in which case the two rectangles whose union
+ *   adds the fewest pixels are merged.
+ * The capacity is kept small since every view holds a DirtyRegion. */
+
+class DirtyRegion {
+ public:
+  constexpr static int k_maxNumberOfRects = 2;
+  static_assert(k_maxNumberOfRects == 2, "Update the constructor");
+
+  DirtyRegion() : m_rects{KDRectZero, KDRectZero}, m_numberOfRects(0) {}
+  DirtyRegion(KDRect rect) : DirtyRegion() { add(rect); }
+
+  int numberOfRects() const { return m_numberOfRects; }
+  KDRect rectAtIndex(int i) const;
+  bool isEmpty() const { return m_numberOfRects == 0; }
+  // Bounding rectangle of the region
+  KDRect bounds() const;
+  // Return true if a single rectangle of the region contains rect
+  bool covers(KDRect rect) const;
+  bool intersects(KDRect rect) const;
+  int32_t area() const;
+
+  void add(KDRect rect);
+  void add(const DirtyRegion& other);
+  DirtyRegion intersectedWith(KDRect rect) const;
+
+ private:
+  static int32_t Area(KDRect rect) {
+    return static_cast<int32_t>(rect.width()) * rect.height();
+  }
+  // Number of pixels added by unioning a and b instead of keeping both
+  static int32_t CostOfUnion(KDRect a, KDRect b) {
+    return Area(a.unionedWith(b)) - Area(a) - Area(b);
+  }
+  void removeRectAtIndex(int i);
+
+  KDRect m_rects[k_maxNumberOfRects];
+  uint8_t m_numberOfRects;
+};
+
+}  // namespace Escher
+
+#endif
@@ -103,6 +103,33 @@ class LayoutField : public EditableField {
     return &m_contentView;
   }
 
+  /* Frames of the edited layout and of its ancestors, recorded before an event
+   * is handled. After the edition, only the lowest of them whose frame did not
+   * change is redrawn, instead of the whole field. */
+  class EditionDamage {
+   public:
+    EditionDamage(const Poincare::LayoutCursor* cursor, KDFont::Size font);
+    /* Return false if the whole field must be redrawn. Otherwise, rect is set
+     * to the damaged rect, relative to the origin of the layout. */
+    bool damagedRect(const Poincare::LayoutCursor* cursor, KDFont::Size font,
+                     KDRect* rect) const;
+
+   private:
+    constexpr static int k_maxNumberOfFrames = 16;
+    struct Frame {
+      Poincare::Layout layout;
+      KDRect rect = KDRectZero;
+      KDCoordinate baseline = 0;
+    };
+    static KDRect FrameOfLayout(Poincare::Layout l, KDFont::Size font);
+    static bool IsDrawnFromFramesOfChildren(Poincare::Layout l);
+    const Frame* recordedFrame(Poincare::Layout l) const;
+    bool frameDidChange(Poincare::Layout l, KDFont::Size font) const;
+
+    Frame m_frames[k_maxNumberOfFrames];
+    int m_numberOfFrames;
+  };
+
   class ContentView : public TextCursorView::CursorFieldView {
    public:
     ContentView(KDGlyph::Format format);
@@ -137,6 +164,8 @@ class LayoutField : public EditableField {
 
   ContentView m_contentView;
   LayoutFieldDelegate* m_delegate;
+  // Set while an event is handled
+  const EditionDamage* m_editionDamage;
   KDCoordinate m_inputViewMemoizedHeight;
   char* m_draftBuffer;
   size_t m_draftBufferSize;
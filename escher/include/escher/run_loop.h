@@ -3,6 +3,7 @@
 
 #include <escher/timer.h>
 #include <ion.h>
+#include <poincare/job.h>
 
 namespace Escher {
 
@@ -16,8 +17,15 @@ class RunLoop {
   virtual bool dispatchEvent(Ion::Events::Event e) = 0;
   virtual int numberOfTimers();
   virtual Timer* timerAtIndex(int i);
+  virtual Poincare::Job* backgroundJob() { return nullptr; }
+  virtual void didAdvanceBackgroundJob() {}
 
  private:
+  /* Time given to the background job when no event is pending. It is short
+   * enough for the UI to remain responsive, and a key press interrupts it
+   * anyway. */
+  constexpr static int k_backgroundJobSliceDuration = 50;  // In milliseconds
+
   // Returns true while the Termination event is not fired.
   bool step();
   int m_time;
@@ -11,6 +11,7 @@ class SolidColorView : public View {
   void reload();
   virtual void setColor(KDColor color);
   void drawRect(KDContext *ctx, KDRect rect) const override;
+  bool isOpaque() const override { return true; }
 
  protected:
 #if ESCHER_VIEW_LOGGING
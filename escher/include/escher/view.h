@@ -1,6 +1,7 @@
 #ifndef ESCHER_VIEW_H
 #define ESCHER_VIEW_H
 
+#include <escher/dirty_region.h>
 #include <kandinsky/context.h>
 #include <kandinsky/point.h>
 #include <kandinsky/rect.h>
@@ -36,7 +37,7 @@ class View {
   friend class Window;
 
  public:
-  View() : m_frame(KDRectZero), m_dirtyRect(KDRectZero) {}
+  View() : m_frame(KDRectZero) {}
 
   /* The drawRect method should be implemented by each View subclass. In a
    * typical drawRect implementation, a subclass will make drawing calls to
@@ -44,6 +45,10 @@ class View {
   virtual void drawRect(KDContext *ctx, KDRect rect) const {
     // By default, a view doesn't do anything, it's transparent
   }
+  /* An opaque view paints every pixel of any rect given to drawRect. Its
+   * superview can then skip drawing the parts that it hides, since they are
+   * drawn over anyway. */
+  virtual bool isOpaque() const { return false; }
 
   void setSize(KDSize size);
   void setChildFrame(View *child, KDRect frame, bool force);
@@ -58,7 +63,7 @@ class View {
   }
 
   KDRect bounds() const;
-  KDRect dirtyRect() const { return m_dirtyRect; }
+  KDRect dirtyRect() const { return m_dirtyRegion.bounds(); }
 
   virtual KDSize minimalSizeForOptimalDisplay() const { return KDSizeZero; }
 
@@ -80,7 +85,7 @@ class View {
   void markRectAsDirty(KDRect rect);
   void markAbsoluteRectAsDirty(KDRect rect);
   // Doing this is equivalent to markAbsoluteRectAsDirty(m_frame) but faster
-  void markWholeFrameAsDirty() { m_dirtyRect = m_frame; }
+  void markWholeFrameAsDirty() { m_dirtyRegion = DirtyRegion(m_frame); }
 
 #if ESCHER_VIEW_LOGGING
   virtual const char *className() const;
@@ -93,7 +98,10 @@ class View {
   void setFrame(KDRect frame, bool force);
   virtual void layoutSubviews(bool force = false) {}
   void translate(KDPoint origin);
-  KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  DirtyRegion redraw(KDRect rect,
+                     const DirtyRegion &forceRedrawRegion = DirtyRegion());
+  // Shrink rect by the parts hidden by the opaque subviews
+  KDRect rectNotHiddenBySubviews(KDRect rect, KDRect visibleRect);
 
   /* At destruction, subviews aren't notified that their own pointer
    * 'm_superview' is outdated. This is not an issue since all view hierarchy
@@ -101,8 +109,8 @@ class View {
    * view and its subviews are then destroyed concomitantly.
    * Otherwise, we would just have to implement the destructor to notify
    * subviews that 'm_superview = nullptr'. */
-  KDRect m_frame;      // absolute
-  KDRect m_dirtyRect;  // absolute
+  KDRect m_frame;             // absolute
+  DirtyRegion m_dirtyRegion;  // absolute
 };
 
 }  // namespace Escher
@@ -7,8 +7,11 @@ namespace Escher {
 
 class Window : public View {
  public:
-  Window() : m_contentView(nullptr) {}
+  Window() : m_contentView(nullptr), m_numberOfPixelsPushedByLastRedraw(0) {}
   void redraw(bool force = false);
+  uint32_t numberOfPixelsPushedByLastRedraw() const {
+    return m_numberOfPixelsPushedByLastRedraw;
+  }
   void setContentView(View* contentView);
   void setAbsoluteFrame(KDRect frame) { m_frame = frame; }
 
@@ -20,6 +23,9 @@ class Window : public View {
   void layoutSubviews(bool force = false) override;
   View* subviewAtIndex(int index) override;
   View* m_contentView;
+
+ private:
+  uint32_t m_numberOfPixelsPushedByLastRedraw;
 };
 
 }  // namespace Escher
@@ -107,7 +107,24 @@ void App::didBecomeActive(Window* window) {
   setFirstResponder(&m_modalViewController);
 }
 
+void App::setBackgroundJob(Poincare::Job* job) {
+  if (m_backgroundJob && m_backgroundJob != job) {
+    m_backgroundJob->cancel();
+  }
+  m_backgroundJob = job;
+}
+
+void App::didAdvanceBackgroundJob() {
+  Poincare::Job* job = m_backgroundJob;
+  assert(job);
+  if (!job->isRunning()) {
+    m_backgroundJob = nullptr;
+  }
+  backgroundJobDidAdvance(job);
+}
+
 void App::willBecomeInactive() {
+  setBackgroundJob(nullptr);
   setFirstResponder(nullptr);
   m_modalViewController.viewDidDisappear();
 }
@@ -60,6 +60,15 @@ Timer* Container::timerAtIndex(int i) {
   return containerTimerAtIndex(i - s_activeApp->numberOfTimers());
 }
 
+Poincare::Job* Container::backgroundJob() {
+  return s_activeApp->backgroundJob();
+}
+
+void Container::didAdvanceBackgroundJob() {
+  s_activeApp->didAdvanceBackgroundJob();
+  window()->redraw();
+}
+
 int Container::numberOfContainerTimers() { return 0; }
 
 Timer* Container::containerTimerAtIndex(int i) {
@@ -0,0 +1,119 @@
+#include <assert.h>
+#include <escher/dirty_region.h>
+
+namespace Escher {
+
+KDRect DirtyRegion::rectAtIndex(int i) const {
+  assert(0 <= i && i < m_numberOfRects);
+  return m_rects[i];
+}
+
+KDRect DirtyRegion::bounds() const {
+  KDRect result = KDRectZero;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result = result.unionedWith(m_rects[i]);
+  }
+  return result;
+}
+
+bool DirtyRegion::covers(KDRect rect) const {
+  for (int i = 0; i < m_numberOfRects; i++) {
+    if (m_rects[i].containsRect(rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool DirtyRegion::intersects(KDRect rect) const {
+  for (int i = 0; i < m_numberOfRects; i++) {
+    if (m_rects[i].intersects(rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int32_t DirtyRegion::area() const {
+  // Overlaps are counted twice, as they are drawn twice
+  int32_t result = 0;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result += Area(m_rects[i]);
+  }
+  return result;
+}
+
+void DirtyRegion::add(KDRect rect) {
+  if (rect.isEmpty() || covers(rect)) {
+    return;
+  }
+  int i = 0;
+  while (i < m_numberOfRects) {
+    /* Merge the rectangles which are not worth keeping apart. The merged
+     * rectangle is added again since it can now be merged with the others. */
+    if (CostOfUnion(rect, m_rects[i]) <= 0) {
+      rect = rect.unionedWith(m_rects[i]);
+      removeRectAtIndex(i);
+      i = 0;
+      continue;
+    }
+    i++;
+    if (i < m_numberOfRects || m_numberOfRects < k_maxNumberOfRects) {
+      continue;
+    }
+    // The region is full: merge the cheapest pair, rect included
+    int bestIndex = 0;
+    int32_t bestCost = CostOfUnion(rect, m_rects[0]);
+    for (int j = 1; j < m_numberOfRects; j++) {
+      int32_t cost = CostOfUnion(rect, m_rects[j]);
+      if (cost < bestCost) {
+        bestIndex = j;
+        bestCost = cost;
+      }
+    }
+    int bestFirst = -1;
+    for (int j = 0; j < m_numberOfRects; j++) {
+      for (int k = j + 1; k < m_numberOfRects; k++) {
+        int32_t cost = CostOfUnion(m_rects[j], m_rects[k]);
+        if (cost < bestCost) {
+          bestFirst = j;
+          bestIndex = k;
+          bestCost = cost;
+        }
+      }
+    }
+    if (bestFirst >= 0) {
+      m_rects[bestFirst] = m_rects[bestFirst].unionedWith(m_rects[bestIndex]);
+    } else {
+      rect = rect.unionedWith(m_rects[bestIndex]);
+    }
+    removeRectAtIndex(bestIndex);
+    i = 0;
+  }
+  assert(m_numberOfRects < k_maxNumberOfRects);
+  m_rects[m_numberOfRects++] = rect;
+}
+
+void DirtyRegion::add(const DirtyRegion& other) {
+  for (int i = 0; i < other.m_numberOfRects; i++) {
+    add(other.m_rects[i]);
+  }
+}
+
+DirtyRegion DirtyRegion::intersectedWith(KDRect rect) const {
+  DirtyRegion result;
+  for (int i = 0; i < m_numberOfRects; i++) {
+    result.add(m_rects[i].intersectedWith(rect));
+  }
+  return result;
+}
+
+void DirtyRegion::removeRectAtIndex(int i) {
+  assert(0 <= i && i < m_numberOfRects);
+  m_numberOfRects--;
+  for (int j = i; j < m_numberOfRects; j++) {
+    m_rects[j] = m_rects[j + 1];
+  }
+}
+
+}  // namespace Escher
@@ -124,11 +124,108 @@ LayoutField::ContentView::ContentView(KDGlyph::Format format)
  * space (for example the one from TextField). */
 static char s_draftBuffer[AbstractTextField::MaxBufferSize()];
 
+LayoutField::EditionDamage::EditionDamage(const LayoutCursor *cursor,
+                                          KDFont::Size font)
+    : m_numberOfFrames(0) {
+  if (cursor->isUninitialized()) {
+    return;
+  }
+  Layout l = cursor->editedLayout();
+  while (!l.isUninitialized() && m_numberOfFrames < k_maxNumberOfFrames) {
+    m_frames[m_numberOfFrames++] = {l, FrameOfLayout(l, font), l.baseline(font)};
+    l = l.parent();
+  }
+}
+
+bool LayoutField::EditionDamage::damagedRect(const LayoutCursor *cursor,
+                                             KDFont::Size font,
+                                             KDRect *rect) const {
+  if (m_numberOfFrames == 0 || cursor->isUninitialized()) {
+    return false;
+  }
+  /* The edition happened in the previous edited layout and in the current
+   * one, and in the state of their ancestors. */
+  Layout previousEditedLayout = m_frames[0].layout;
+  Layout editedLayout = cursor->editedLayout();
+  if (!editedLayout.hasAncestor(previousEditedLayout, true)) {
+    if (!previousEditedLayout.hasAncestor(editedLayout, true)) {
+      return false;
+    }
+    editedLayout = previousEditedLayout;
+  }
+  /* Nothing outside of an ancestor whose frame did not change needs to be
+   * redrawn, provided that the ancestors above it are drawn from the frames
+   * of their children only. */
+  Layout damagedLayout;
+  Layout childOfDamagedLayout;
+  Layout child;
+  for (Layout l = editedLayout; !l.isUninitialized(); l = l.parent()) {
+    if (!damagedLayout.isUninitialized() && !IsDrawnFromFramesOfChildren(l)) {
+      damagedLayout = Layout();
+    }
+    if (damagedLayout.isUninitialized() && !frameDidChange(l, font)) {
+      damagedLayout = l;
+      childOfDamagedLayout = child;
+    }
+    child = l;
+  }
+  if (damagedLayout.isUninitialized()) {
+    return false;
+  }
+  *rect = FrameOfLayout(damagedLayout, font);
+  if (damagedLayout.type() == LayoutNode::Type::MatrixLayout &&
+      !childOfDamagedLayout.isUninitialized()) {
+    /* If the size of the matrix did not change, neither did the width of the
+     * column of the edited cell. If the height and the baseline of the cell
+     * did not change either, the other cells were not moved. */
+    const Frame *previousFrame = recordedFrame(childOfDamagedLayout);
+    KDRect frame = FrameOfLayout(childOfDamagedLayout, font);
+    if (previousFrame && previousFrame->rect.height() == frame.height() &&
+        previousFrame->baseline == childOfDamagedLayout.baseline(font)) {
+      *rect = previousFrame->rect.unionedWith(frame);
+    }
+  }
+  return true;
+}
+
+KDRect LayoutField::EditionDamage::FrameOfLayout(Layout l, KDFont::Size font) {
+  KDPoint origin = l.absoluteOrigin(font).translatedBy(
+      KDPoint(-l.node()->leftMargin(), 0));
+  return KDRect(origin, l.layoutSize(font));
+}
+
+bool LayoutField::EditionDamage::IsDrawnFromFramesOfChildren(Layout l) {
+  /* Other layouts may draw depending on the content of their children, such
+   * as the derivative which draws a copy of its variable. */
+  LayoutNode::Type type = l.type();
+  return type == LayoutNode::Type::HorizontalLayout ||
+         type == LayoutNode::Type::FractionLayout ||
+         type == LayoutNode::Type::MatrixLayout;
+}
+
+const LayoutField::EditionDamage::Frame *
+LayoutField::EditionDamage::recordedFrame(Layout l) const {
+  for (int i = 0; i < m_numberOfFrames; i++) {
+    if (m_frames[i].layout.identifier() == l.identifier()) {
+      return m_frames + i;
+    }
+  }
+  return nullptr;
+}
+
+bool LayoutField::EditionDamage::frameDidChange(Layout l,
+                                                KDFont::Size font) const {
+  const Frame *previousFrame = recordedFrame(l);
+  return !previousFrame || previousFrame->rect != FrameOfLayout(l, font) ||
+         previousFrame->baseline != l.baseline(font);
+}
+
 LayoutField::LayoutField(Responder *parentResponder,
                          LayoutFieldDelegate *delegate, KDGlyph::Format format)
     : EditableField(parentResponder, &m_contentView),
       m_contentView(format),
       m_delegate(delegate),
+      m_editionDamage(nullptr),
       m_inputViewMemoizedHeight(0),
       m_draftBuffer(s_draftBuffer),
       m_draftBufferSize(AbstractTextField::MaxBufferSize()) {
@@ -272,7 +369,16 @@ void LayoutField::reload(KDSize previousSize) {
   }
   m_contentView.cursorPositionChanged();
   scrollToCursor();
-  markWholeFrameAsDirty();
+  KDRect damagedRect = KDRectZero;
+  if (m_editionDamage && previousSize == newSize &&
+      m_editionDamage->damagedRect(cursor(), m_contentView.font(),
+                                   &damagedRect)) {
+    const LayoutView *view = m_contentView.layoutView();
+    markAbsoluteRectAsDirty(damagedRect.translatedBy(
+        view->absoluteOrigin().translatedBy(view->drawingOrigin())));
+  } else {
+    markWholeFrameAsDirty();
+  }
 }
 
 using LayoutInsertionMethod =
@@ -461,18 +567,28 @@ KDCoordinate LayoutField::inputViewHeight() const {
 bool LayoutField::handleEventWithText(const char *text, bool indentation,
                                       bool forceCursorRightOfText) {
   KDSize previousSize = minimalSizeForOptimalDisplay();
+  EditionDamage editionDamage(cursor(), m_contentView.font());
+  const EditionDamage *previousEditionDamage = m_editionDamage;
+  m_editionDamage = &editionDamage;
   bool didHandle = insertText(text, indentation, forceCursorRightOfText);
-  return didHandleEvent(didHandle, didHandle, true, previousSize);
+  didHandle = didHandleEvent(didHandle, didHandle, true, previousSize);
+  m_editionDamage = previousEditionDamage;
+  return didHandle;
 }
 
 bool LayoutField::handleEvent(Ion::Events::Event event) {
   KDSize previousSize = minimalSizeForOptimalDisplay();
+  EditionDamage editionDamage(cursor(), m_contentView.font());
+  const EditionDamage *previousEditionDamage = m_editionDamage;
+  m_editionDamage = &editionDamage;
   bool shouldRedrawLayout;
   bool shouldUpdateCursor;
   bool didHandle =
       privateHandleEvent(event, &shouldRedrawLayout, &shouldUpdateCursor);
-  return didHandleEvent(didHandle, shouldRedrawLayout, shouldUpdateCursor,
-                        previousSize);
+  didHandle = didHandleEvent(didHandle, shouldRedrawLayout, shouldUpdateCursor,
+                             previousSize);
+  m_editionDamage = previousEditionDamage;
+  return didHandle;
 }
 
 bool LayoutField::privateHandleEvent(Ion::Events::Event event,
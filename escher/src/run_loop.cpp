@@ -1,6 +1,8 @@
 #include <assert.h>
 #include <escher/run_loop.h>
 #include <kandinsky/font.h>
+
+#include <algorithm>
 #if ESCHER_LOG_EVENTS_NAME
 #include <ion/console.h>
 #include <ion/keyboard/layout_events.h>
@@ -31,8 +33,10 @@ void RunLoop::runWhile(bool (*callback)(void* ctx), void* ctx) {
 }
 
 bool RunLoop::step() {
-  // Fetch the event, if any
-  int eventDuration = Timer::TickDuration;
+  Poincare::Job* job = backgroundJob();
+  /* Fetch the event, if any. Do not wait for it while a background job could
+   * use the idle time. */
+  int eventDuration = job ? 0 : Timer::TickDuration;
   int timeout = eventDuration;
 
   Ion::Events::Event event = Ion::Events::getEvent(&timeout);
@@ -47,6 +51,15 @@ bool RunLoop::step() {
    * TickDuration.  The event returned can be None if nothing worth taking care
    * of happened. In other words, getEvent is a blocking call with a timeout. */
 
+  if (job && (event == Ion::Events::None || event == Ion::Events::Idle)) {
+    uint64_t sliceStart = Ion::Timing::millis();
+    job->advance(sliceStart + k_backgroundJobSliceDuration);
+    didAdvanceBackgroundJob();
+    // Timers keep running during the slice
+    eventDuration += std::min<uint64_t>(Ion::Timing::millis() - sliceStart,
+                                        Timer::TickDuration);
+  }
+
   m_time += eventDuration;
 
   if (m_time >= Timer::TickDuration) {
@@ -15,43 +15,48 @@ void View::markRectAsDirty(KDRect rect) {
 
 void View::markAbsoluteRectAsDirty(KDRect rect) {
   /* Intersect with m_frame before unioning to avoid KDCoordinate overflow. */
-  m_dirtyRect = m_dirtyRect.intersectedWith(m_frame).unionedWith(
-      rect.intersectedWith(m_frame));
+  m_dirtyRegion = m_dirtyRegion.intersectedWith(m_frame);
+  m_dirtyRegion.add(rect.intersectedWith(m_frame));
 }
 
-KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
+DirtyRegion View::redraw(KDRect rect, const DirtyRegion &forceRedrawRegion) {
   /* View::redraw recursively redraws the rectangle 'rect' of the view and all
    * its subviews.
    * To optimize the function, we redraw only the union of the current dirty
-   * rectangle with a rectangle forced to be redrawn (forceRedrawRect). This
-   * rectangle is initially empty and recursively expands by unioning with the
-   * rectangles that are redrawn. This process handles the case when several
+   * region with a region forced to be redrawn (forceRedrawRegion). This
+   * region is initially empty and recursively expands by unioning with the
+   * regions that are redrawn. This process handles the case when several
    * sister views are overlapping (provided that the sister views are indexed in
    * the right order).
    */
 
-  /* First, for the current view, the rectangle to redraw is the union of the
-   * dirty rectangle and the rectangle forced to be redrawn. The rectangle to
-   * redraw must also be included in the current view bounds and in the
-   * rectangle rect. */
+  /* First, for the current view, the region to redraw is the union of the
+   * dirty region and the region forced to be redrawn. The region to redraw
+   * must also be included in the current view bounds and in the rectangle
+   * rect. */
   if (rect.isEmpty()) {
-    return KDRectZero;
+    return DirtyRegion();
   }
   KDRect visibleRect = rect.intersectedWith(m_frame);
-  KDRect rectNeedingRedraw =
-      visibleRect.intersectedWith(m_dirtyRect)
-          .unionedWith(forceRedrawRect.intersectedWith(m_frame));
-
-  // This redraws the rectNeedingRedraw calling drawRect.
-  if (!rectNeedingRedraw.isEmpty()) {
-    KDPoint absOrigin = absoluteOrigin();
-    KDContext *ctx = KDIonContext::SharedContext;
-    ctx->setOrigin(absOrigin);
-    ctx->setClippingRect(rectNeedingRedraw);
-    drawRect(ctx, rectNeedingRedraw.relativeTo(m_frame.origin()));
+  DirtyRegion regionNeedingRedraw = m_dirtyRegion.intersectedWith(visibleRect);
+  regionNeedingRedraw.add(forceRedrawRegion.intersectedWith(m_frame));
+
+  /* This redraws each rectangle of regionNeedingRedraw calling drawRect,
+   * except for the parts that opaque subviews will draw over. */
+  for (int i = 0; i < regionNeedingRedraw.numberOfRects(); i++) {
+    KDRect rectToDraw = rectNotHiddenBySubviews(
+        regionNeedingRedraw.rectAtIndex(i), visibleRect);
+    if (!rectToDraw.isEmpty()) {
+      KDPoint absOrigin = absoluteOrigin();
+      KDContext *ctx = KDIonContext::SharedContext;
+      ctx->setOrigin(absOrigin);
+      ctx->setClippingRect(rectToDraw);
+      drawRect(ctx, rectToDraw.relativeTo(m_frame.origin()));
+    }
   }
-  // This initializes the area that has been redrawn.
-  KDRect redrawnArea = rectNeedingRedraw;
+  /* This initializes the area that has been redrawn. The hidden parts are
+   * included so that the opaque subviews are forced to draw them. */
+  DirtyRegion redrawnArea = regionNeedingRedraw;
 
   // Then, let's recursively draw our children over ourself
   uint8_t subviewsNumber = numberOfSubviews();
@@ -62,20 +67,35 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
       continue;
     }
 
-    /* We redraw the current subview by passing the rectangle previously redrawn
+    /* We redraw the current subview by passing the region previously redrawn
      * (by the parent view or previous sister views) as forced to be redraw. */
-    KDRect subviewRedrawnArea = subview->redraw(visibleRect, redrawnArea);
+    DirtyRegion subviewRedrawnArea = subview->redraw(visibleRect, redrawnArea);
 
     // We expand the redrawn area to include the area just drawn.
-    redrawnArea = redrawnArea.unionedWith(subviewRedrawnArea);
+    redrawnArea.add(subviewRedrawnArea);
   }
   // Eventually, mark that we don't need to be redrawn
-  m_dirtyRect = KDRectZero;
+  m_dirtyRegion = DirtyRegion();
 
   // The function returns the total area that have been redrawn.
   return redrawnArea;
 }
 
+KDRect View::rectNotHiddenBySubviews(KDRect rect, KDRect visibleRect) {
+  /* An opaque subview only draws over the part of its frame that is visible.
+   * KDRect::differencedWith is conservative when the difference is not a
+   * rectangle, so rect is only shrunk when a subview hides a whole side. */
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber && !rect.isEmpty(); i++) {
+    View *subview = subviewAtIndex(i);
+    if (subview != nullptr && subview->isOpaque()) {
+      rect = rect.differencedWith(
+          subview->absoluteFrame().intersectedWith(visibleRect));
+    }
+  }
+  return rect;
+}
+
 void View::setSize(KDSize size) {
   setFrame(KDRect(m_frame.origin(), size), false);
 }
@@ -85,12 +105,12 @@ void View::setChildFrame(View *child, KDRect frame, bool force) {
    * previously was. At this point, we know that the only area that needs to be
    * redrawn in the superview is the old frame minus the part covered by the new
    * frame.
-   * Check first if m_dirtyRect == m_frame. If it is, it's useless to
+   * Check first if m_dirtyRegion covers m_frame. If it does, it's useless to
    * compute previousFrame since everything is already dirty.
    * WARNING: When this->setFrame is called, m_frame changes which makes
    * relativeChildFrame return a wrong value. Fortunately, in this case,
-   * m_dirtyRect == m_frame so we can avoid calling relativeChildFrame. */
-  if (m_dirtyRect != m_frame) {
+   * m_dirtyRegion covers m_frame so we can avoid calling relativeChildFrame. */
+  if (!m_dirtyRegion.covers(m_frame)) {
     KDRect previousFrame = relativeChildFrame(child);
     markRectAsDirty(previousFrame.differencedWith(frame));
   }
@@ -1,5 +1,6 @@
 #include <escher/window.h>
 #include <ion.h>
+#include <kandinsky/ion_context.h>
 extern "C" {
 #include <assert.h>
 }
@@ -11,7 +12,10 @@ void Window::redraw(bool force) {
     markWholeFrameAsDirty();
   }
   Ion::Display::waitForVBlank();
+  uint32_t numberOfPushedPixels = KDIonContext::NumberOfPushedPixels();
   View::redraw(bounds());
+  m_numberOfPixelsPushedByLastRedraw =
+      KDIonContext::NumberOfPushedPixels() - numberOfPushedPixels;
 }
 
 void Window::setContentView(View* contentView) {
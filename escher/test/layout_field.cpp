@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <escher/clipboard.h>
 #include <escher/layout_field.h>
+#include <escher/window.h>
 #include <ion/events.h>
 #include <quiz.h>
 
@@ -245,3 +246,86 @@ QUIZ_CASE(escher_layout_field_delete) {
     assert_events_lead_to_selection(events, eventsCount, "104");
   }
 }
+
+QUIZ_CASE(escher_layout_field_edition_damage) {
+  LayoutField field(nullptr, nullptr);
+  Window window;
+  window.setAbsoluteFrame(KDRectScreen);
+  window.setContentView(&field);
+  field.setEditing(true);
+
+  // 1/2345, with the cursor in the numerator
+  const int eventsCount = 7;
+  Ion::Events::Event events[eventsCount] = {
+      Ion::Events::One,   Ion::Events::Division, Ion::Events::Two,
+      Ion::Events::Three, Ion::Events::Four,     Ion::Events::Five,
+      Ion::Events::Up};
+  for (int i = 0; i < eventsCount; i++) {
+    field.handleEvent(events[i]);
+  }
+  window.redraw(true);
+  uint32_t numberOfPixelsOfField = window.numberOfPixelsPushedByLastRedraw();
+
+  /* The numerator is narrower than the denominator, so the fraction keeps its
+   * frame and is the only layout to be redrawn. */
+  field.handleEvent(Ion::Events::Six);
+  window.redraw();
+  uint32_t numberOfPixelsOfFraction = window.numberOfPixelsPushedByLastRedraw();
+  quiz_assert(numberOfPixelsOfFraction > 0);
+  quiz_assert(2 * numberOfPixelsOfFraction < numberOfPixelsOfField);
+
+  // The denominator grows, so the whole field is redrawn
+  field.handleEvent(Ion::Events::Down);
+  field.handleEvent(Ion::Events::Six);
+  window.redraw();
+  quiz_assert(window.numberOfPixelsPushedByLastRedraw() >
+              numberOfPixelsOfFraction);
+}
+
+QUIZ_CASE(escher_layout_field_typing_in_matrix) {
+  LayoutField field(nullptr, nullptr);
+  Window window;
+  window.setAbsoluteFrame(KDRectScreen);
+  window.setContentView(&field);
+  field.setEditing(true);
+
+  /* A 10x10 matrix of 0 whose first row holds 10, so that the columns stay as
+   * wide when a digit is typed in the other rows */
+  constexpr int k_dimension = 10;
+  char text[k_dimension * (1 + 3 * k_dimension) + 3];
+  int length = 0;
+  text[length++] = '[';
+  for (int i = 0; i < k_dimension; i++) {
+    text[length++] = '[';
+    for (int j = 0; j < k_dimension; j++) {
+      if (i == 0) {
+        text[length++] = '1';
+      }
+      text[length++] = '0';
+      text[length++] = j < k_dimension - 1 ? ',' : ']';
+    }
+  }
+  text[length++] = ']';
+  text[length] = 0;
+  field.handleEventWithText(text);
+  // The cursor goes in the last entry
+  field.putCursorOnOneSide(OMG::Direction::Right());
+  field.handleEvent(Ion::Events::Left);
+  /* The parsed entry is a single code point, which the first edition wraps in
+   * a horizontal layout as when the entry is typed. */
+  field.handleEvent(Ion::Events::One);
+  field.handleEvent(Ion::Events::Backspace);
+  window.redraw(true);
+  uint32_t numberOfPixelsOfField = window.numberOfPixelsPushedByLastRedraw();
+
+  /* The entry keeps its height and baseline and its column keeps its width,
+   * so only the entry is redrawn, whether a digit is typed or deleted. */
+  for (Ion::Events::Event event :
+       {Ion::Events::One, Ion::Events::Backspace}) {
+    field.handleEvent(event);
+    window.redraw();
+    uint32_t numberOfPixels = window.numberOfPixelsPushedByLastRedraw();
+    quiz_assert(numberOfPixels > 0);
+    quiz_assert(4 * numberOfPixels < numberOfPixelsOfField);
+  }
+}
@@ -0,0 +1,79 @@
+#include <escher/dirty_region.h>
+#include <escher/solid_color_view.h>
+#include <escher/window.h>
+#include <quiz.h>
+
+using namespace Escher;
+
+QUIZ_CASE(escher_dirty_region_merge) {
+  // Distant rectangles are kept apart
+  DirtyRegion region(KDRect(0, 0, 10, 10));
+  region.add(KDRect(300, 200, 10, 10));
+  quiz_assert(region.numberOfRects() == 2);
+  quiz_assert(region.area() == 200);
+  quiz_assert(region.bounds() == KDRect(0, 0, 310, 210));
+  quiz_assert(!region.intersects(KDRect(100, 100, 10, 10)));
+
+  // Contained and adjacent rectangles are merged
+  region.add(KDRect(2, 2, 5, 5));
+  quiz_assert(region.numberOfRects() == 2);
+  region.add(KDRect(10, 0, 10, 10));
+  quiz_assert(region.numberOfRects() == 2);
+  quiz_assert(region.covers(KDRect(0, 0, 20, 10)));
+
+  // A full region merges the pair whose union adds the fewest pixels
+  region.add(KDRect(0, 12, 20, 10));
+  quiz_assert(region.numberOfRects() == 2);
+  quiz_assert(region.covers(KDRect(0, 0, 20, 22)));
+  quiz_assert(region.covers(KDRect(300, 200, 10, 10)));
+
+  DirtyRegion clipped = region.intersectedWith(KDRect(0, 0, 5, 5));
+  quiz_assert(clipped.numberOfRects() == 1);
+  quiz_assert(clipped.rectAtIndex(0) == KDRect(0, 0, 5, 5));
+}
+
+class FilledView : public View {
+ public:
+  FilledView() : m_subview(KDColorBlack) {}
+  void drawRect(KDContext* ctx, KDRect rect) const override {
+    ctx->fillRect(rect, KDColorWhite);
+  }
+  void damageSubview(KDRect rect) { m_subview.damage(rect); }
+
+ private:
+  class DamageableView : public SolidColorView {
+   public:
+    using SolidColorView::SolidColorView;
+    void damage(KDRect rect) { markRectAsDirty(rect); }
+  };
+
+  int numberOfSubviews() const override { return 1; }
+  View* subviewAtIndex(int index) override { return &m_subview; }
+  void layoutSubviews(bool force = false) override {
+    setChildFrame(&m_subview, bounds(), force);
+  }
+
+  DamageableView m_subview;
+};
+
+QUIZ_CASE(escher_view_redraw_pushed_pixels) {
+  FilledView view;
+  Window window;
+  window.setAbsoluteFrame(KDRectScreen);
+  window.setContentView(&view);
+
+  // The background hidden by the opaque subview is not drawn
+  window.redraw(true);
+  quiz_assert(window.numberOfPixelsPushedByLastRedraw() ==
+              static_cast<uint32_t>(KDRectScreen.width()) *
+                  KDRectScreen.height());
+
+  // Only the damaged pixels are drawn, not the pixels in between
+  view.damageSubview(KDRect(0, 0, 10, 10));
+  view.damageSubview(KDRect(300, 200, 10, 10));
+  window.redraw();
+  quiz_assert(window.numberOfPixelsPushedByLastRedraw() == 200);
+
+  window.redraw();
+  quiz_assert(window.numberOfPixelsPushedByLastRedraw() == 0);
+}
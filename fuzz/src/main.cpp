@@ -0,0 +1,234 @@
+#include <apps/apps_container.h>
+#include <apps/global_preferences.h>
+#include <apps/init.h>
+#include <apps/shared/global_context.h>
+#include <escher/init.h>
+#include <ion.h>
+#include <ion/src/shared/events.h>
+#include <ion/src/shared/events_modifier.h>
+#include <ion/src/simulator/shared/journal.h>
+#include <ion/src/simulator/shared/state_file.h>
+#include <poincare/exception_checkpoint.h>
+#include <poincare/expression.h>
+#include <poincare/init.h>
+#include <poincare/preferences.h>
+#include <poincare/tree_pool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* In-process fuzzing harness. Each input is run after resetting the global
+ * state, so that thousands of inputs can be run by the same process instead of
+ * paying for its startup each time. Two targets are available:
+ * - events (default): the input is a headless state file, whose events are
+ *   dispatched to a fresh AppsContainer,
+ * - expressions (--expressions): the first byte of the input selects the
+ *   preferences and the rest is a text which is parsed, simplified,
+ *   approximated, laid out and serialized.
+ * The driver is chosen at compile time:
+ * - AFL++ persistent mode when built with afl-clang-lto,
+ * - libFuzzer when built with FUZZ_LIBFUZZER=1,
+ * - otherwise, the files given as arguments (or stdin) are run in turn, which
+ *   is how crashes are reproduced. */
+
+using namespace Poincare;
+
+namespace Fuzz {
+
+constexpr static size_t k_maxExpressionLength = 256;
+
+static bool s_expressionsTarget = false;
+
+static bool IsValidUTF8(const uint8_t* text, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    uint8_t c = text[i];
+    int numberOfContinuationBytes;
+    if (c < 0x80) {
+      numberOfContinuationBytes = 0;
+    } else if ((c & 0xE0) == 0xC0 && c >= 0xC2) {
+      numberOfContinuationBytes = 1;
+    } else if ((c & 0xF0) == 0xE0) {
+      numberOfContinuationBytes = 2;
+    } else if ((c & 0xF8) == 0xF0 && c <= 0xF4) {
+      numberOfContinuationBytes = 3;
+    } else {
+      return false;
+    }
+    if (length - i <= static_cast<size_t>(numberOfContinuationBytes)) {
+      return false;
+    }
+    for (int j = 1; j <= numberOfContinuationBytes; j++) {
+      if ((text[i + j] & 0xC0) != 0x80) {
+        return false;
+      }
+    }
+    i += numberOfContinuationBytes + 1;
+  }
+  return true;
+}
+
+static void ResetState() {
+  Apps::Shutdown();
+  // Every handle was owned by the apps, a leaked node is a bug
+  assert(TreePool::sharedPool->numberOfNodes() == 0);
+  Preferences::sharedPreferences.deinit();
+  Preferences::sharedPreferences.init();
+  Ion::Storage::FileSystem::sharedFileSystem.deinit();
+  Ion::Storage::FileSystem::sharedFileSystem.init();
+  Ion::Events::SharedModifierState.deinit();
+  Ion::Events::SharedModifierState.init();
+  Ion::Events::SharedState.deinit();
+  Ion::Events::SharedState.init();
+  Apps::Init();
+}
+
+static void RunEvents(const uint8_t* data, size_t size) {
+  Ion::Events::Journal* journal = Ion::Simulator::Journal::replayJournal();
+  while (!journal->isEmpty()) {
+    journal->popEvent();
+  }
+  Ion::Simulator::StateFile::loadMemory(reinterpret_cast<const char*>(data),
+                                        size, true);
+  // Returns when the journal is empty
+  AppsContainer::sharedAppsContainer()->run();
+}
+
+static void SetPreferences(uint8_t selector) {
+  Preferences* preferences = Preferences::sharedPreferences;
+  preferences->setAngleUnit(
+      static_cast<Preferences::AngleUnit>(selector % 3));
+  selector /= 3;
+  preferences->setComplexFormat(
+      static_cast<Preferences::ComplexFormat>(selector % 3));
+  selector /= 3;
+  preferences->setDisplayMode(
+      static_cast<Preferences::PrintFloatMode>(selector % 3));
+}
+
+static void RunExpression(const uint8_t* data, size_t size) {
+  if (size == 0) {
+    return;
+  }
+  SetPreferences(data[0]);
+  data++;
+  size--;
+  if (size > k_maxExpressionLength) {
+    size = k_maxExpressionLength;
+  }
+  char text[k_maxExpressionLength + 1];
+  memcpy(text, data, size);
+  text[size] = 0;
+  // The text fields only produce valid UTF-8 without null bytes
+  if (strlen(text) != size ||
+      !IsValidUTF8(reinterpret_cast<const uint8_t*>(text), size)) {
+    return;
+  }
+  Shared::GlobalContext context;
+  ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    Expression e = Expression::Parse(text, &context);
+    if (e.isUninitialized()) {
+      return;
+    }
+    Preferences* preferences = Preferences::sharedPreferences;
+    ReductionContext reductionContext(
+        &context, preferences->complexFormat(), preferences->angleUnit(),
+        GlobalPreferences::sharedGlobalPreferences->unitFormat(),
+        ReductionTarget::User);
+    Expression exact, approximate;
+    e.cloneAndSimplifyAndApproximate(&exact, &approximate, reductionContext);
+    char buffer[k_maxExpressionLength];
+    Expression expressions[] = {e, exact, approximate};
+    for (Expression expression : expressions) {
+      if (expression.isUninitialized()) {
+        continue;
+      }
+      expression.serialize(buffer, k_maxExpressionLength,
+                           preferences->displayMode());
+      expression.createLayout(preferences->displayMode(),
+                              preferences->numberOfSignificantDigits(),
+                              &context);
+    }
+  }
+}
+
+static void Run(const uint8_t* data, size_t size) {
+  ResetState();
+  if (s_expressionsTarget) {
+    RunExpression(data, size);
+  } else {
+    RunEvents(data, size);
+  }
+}
+
+static void RunFile(FILE* f) {
+  constexpr size_t k_maxInputSize = 64 * 1024;
+  static uint8_t s_input[k_maxInputSize];
+  size_t size = fread(s_input, 1, k_maxInputSize, f);
+  Run(s_input, size);
+}
+
+}  // namespace Fuzz
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  Fuzz::Run(data, size);
+  return 0;
+}
+
+#if FUZZ_LIBFUZZER
+extern "C" int LLVMFuzzerRunDriver(int* argc, char*** argv,
+                                   int (*callback)(const uint8_t* data,
+                                                   size_t size));
+#endif
+
+#ifdef __AFL_FUZZ_TESTCASE_LEN
+__AFL_FUZZ_INIT();
+#endif
+
+void ion_main(int argc, const char* const argv[]) {
+  Poincare::Init();
+  Escher::Init();
+  Apps::Init();
+  volatile int stackTop;
+  Ion::setStackStart((void*)(&stackTop));
+
+  /* Besides --expressions, the simulator may forward options such as
+   * --language, which are skipped along with their value. */
+  const char* inputs[argc + 1];
+  inputs[0] = argv[0];
+  int numberOfInputs = 1;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--expressions") == 0) {
+      Fuzz::s_expressionsTarget = true;
+    } else if (strncmp(argv[i], "--", 2) == 0) {
+      i++;
+    } else {
+      inputs[numberOfInputs++] = argv[i];
+    }
+  }
+  inputs[numberOfInputs] = nullptr;
+
+#if FUZZ_LIBFUZZER
+  char** driverArgv = const_cast<char**>(inputs);
+  LLVMFuzzerRunDriver(&numberOfInputs, &driverArgv, LLVMFuzzerTestOneInput);
+#elif defined(__AFL_FUZZ_TESTCASE_LEN)
+  __AFL_INIT();
+  const uint8_t* input = __AFL_FUZZ_TESTCASE_BUF;
+  while (__AFL_LOOP(10000)) {
+    Fuzz::Run(input, __AFL_FUZZ_TESTCASE_LEN);
+  }
+#else
+  if (numberOfInputs == 1) {
+    Fuzz::RunFile(stdin);
+  }
+  for (int i = 1; i < numberOfInputs; i++) {
+    FILE* f = fopen(inputs[i], "rb");
+    if (f == nullptr) {
+      fprintf(stderr, "Could not open %s\n", inputs[i]);
+      continue;
+    }
+    Fuzz::RunFile(f);
+    fclose(f);
+  }
+#endif
+}
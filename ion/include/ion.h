@@ -58,7 +58,8 @@ uint32_t random();
 // Decompress data
 void decompress(const uint8_t *src, uint8_t *dst, int srcSize, int dstSize);
 
-// Sets and returns address to the first object that can be allocated on stack
+/* Sets and returns address to the first object that can be allocated on stack.
+ * It is thread local and only set on the main thread. */
 void *stackStart();
 void setStackStart(void *);
 // Tells whether the stack pointer is within acceptable bounds
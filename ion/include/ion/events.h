@@ -137,6 +137,8 @@ class Journal {
 
 void replayFrom(Journal* l);
 void logTo(Journal* l);
+// True until the replayed journal has been emptied by getEvent
+bool isReplaying();
 #endif
 
 Event getEvent(int* timeout);
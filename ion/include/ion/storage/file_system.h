@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <ion/unicode/utf8_helper.h>
 #include <omg/global_box.h>
+#include <omg/thread_local.h>
 
 #include "record.h"
 #include "record_name_verifier.h"
@@ -16,7 +17,18 @@ namespace Ion {
 /* Storage : | Magic |             Record1                 |            Record2                  | ... | Magic |
  *           | Magic | Size1(uint16_t) | FullName1 | Body1 | Size2(uint16_t) | FullName2 | Body2 | ... | Magic |
  *
- * A record's fullName is baseName.extension. */
+ * A record's fullName is baseName.extension. The records end with a null size.
+ *
+ * In memory, the available space is kept as a gap after the last record that
+ * changed size, and the records following it are moved to the end of the
+ * buffer:
+ *
+ *           | Magic | Record1 | Record2 |      gap      | Record3 | ... | 0 | Magic |
+ *
+ * Growing, shrinking or renaming the same record again then only moves the
+ * bytes of this record. Moving the gap to another record moves the records in
+ * between. The packed layout of the first diagram is
+ * restored by packRecords. */
 // clang-format on
 
 namespace Storage {
@@ -32,7 +44,7 @@ class FileSystem {
   static_assert(UINT16_MAX >= k_storageSize - 1,
                 "record_size_t not big enough");
 
-  static OMG::GlobalBox<FileSystem> sharedFileSystem;
+  static OMG_THREAD_LOCAL OMG::GlobalBox<FileSystem> sharedFileSystem;
 
 #if ION_STORAGE_LOG
   void log();
@@ -42,6 +54,9 @@ class FileSystem {
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
   uint32_t checksum();
+  /* Move the records next to each other at the start of the buffer, as
+   * expected by the tools reading the storage over DFU. */
+  void packRecords();
 
   // Storage delegate
   void setDelegate(StorageDelegate *delegate) { m_delegate = delegate; }
@@ -165,10 +180,18 @@ class FileSystem {
   bool isNameOfRecordTaken(Record r, const Record *recordToExclude = nullptr);
   char *endBuffer();
   size_t sizeOfRecordWithName(Record::Name name, size_t dataSize);
-  bool slideBuffer(char *position, int delta);
+  /* Slide the bytes from offset to the end of the record by delta, after
+   * moving the gap behind the record. Update *record if the record moved. */
+  bool slideEndOfRecord(char **record, size_t offset, int delta);
+  // Return the position of the gap, which may move the records in between
+  char *moveGapTo(char *position);
+  char *moveGapAfterRecord(char *record);
+  void openGap();
+  void endRecordsBeforeGap();
   class RecordIterator {
    public:
-    RecordIterator(char *start) : m_recordStart(start) {}
+    RecordIterator(char *start, char *gap = nullptr, size_t gapSize = 0)
+        : m_recordStart(start), m_gap(gap), m_gapSize(gapSize) {}
     char *operator*() { return m_recordStart; }
     RecordIterator &operator++();
     bool operator!=(const RecordIterator &it) const {
@@ -177,12 +200,18 @@ class FileSystem {
 
    private:
     char *m_recordStart;
+    char *m_gap;
+    size_t m_gapSize;
   };
   RecordIterator begin() const {
-    if (sizeOfRecordStarting((char *)m_buffer) == 0) {
+    char *start = (char *)m_buffer;
+    if (start == m_gap) {
+      start += m_gapSize;
+    }
+    if (sizeOfRecordStarting(start) == 0) {
       return nullptr;
     }
-    return RecordIterator((char *)m_buffer);
+    return RecordIterator(start, m_gap, m_gapSize);
   };
   RecordIterator end() const { return RecordIterator(nullptr); }
 
@@ -201,6 +230,9 @@ class FileSystem {
   RecordNameVerifier m_recordNameVerifier;
   mutable Record m_lastRecordRetrieved;
   mutable char *m_lastRecordRetrievedPointer;
+  // Null when the records are packed
+  char *m_gap;
+  size_t m_gapSize;
 };
 
 }  // namespace Storage
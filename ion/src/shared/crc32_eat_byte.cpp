@@ -12,4 +12,29 @@ uint32_t crc32EatByte(uint32_t crc, uint8_t data) {
   return crc;
 }
 
+static uint32_t multiplyModuloPolynomial(uint32_t a, uint32_t b) {
+  uint32_t product = 0;
+  for (int i = 32; i--;) {
+    product = product & 0x80000000 ? ((product << 1) ^ polynomial)
+                                   : (product << 1);
+    if (b & (static_cast<uint32_t>(1) << i)) {
+      product ^= a;
+    }
+  }
+  return product;
+}
+
+uint32_t crc32EatNullBytes(uint32_t crc, size_t length) {
+  // x^8 to the power length, by squaring
+  uint32_t power = 1 << 8;
+  while (length > 0) {
+    if (length & 1) {
+      crc = multiplyModuloPolynomial(crc, power);
+    }
+    power = multiplyModuloPolynomial(power, power);
+    length >>= 1;
+  }
+  return crc;
+}
+
 }  // namespace Ion
@@ -1,11 +1,15 @@
 #ifndef ION_SHARED_CRC32_EAT_BYTE_H
 #define ION_SHARED_CRC32_EAT_BYTE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace Ion {
 
 uint32_t crc32EatByte(uint32_t crc, uint8_t data);
+/* Same as eating length null bytes, in O(log(length)) steps: eating a null
+ * byte multiplies the CRC by x^8 modulo the polynomial. */
+uint32_t crc32EatNullBytes(uint32_t crc, size_t length);
 
 }
 
@@ -13,19 +13,28 @@ namespace Events {
 class Scenario {
  public:
   template <int N>
-  constexpr static Scenario build(const char* name, const Event (&events)[N]) {
-    return Scenario(name, events, N);
+  constexpr static Scenario build(const char* name, const Event (&events)[N],
+                                  int firstFrameEventIndex = -1) {
+    return Scenario(name, events, N, firstFrameEventIndex);
   }
   const char* name() const { return m_name; }
   const int numberOfEvents() const { return m_numberOfEvents; }
   const Event eventAtIndex(int index) const { return m_events[index]; }
+  /* Index of the event that opens a view whose first frame is timed, until
+   * the next event is fetched, or -1. */
+  int firstFrameEventIndex() const { return m_firstFrameEventIndex; }
 
  private:
-  constexpr Scenario(const char* name, const Event* events, int numberOfEvents)
-      : m_name(name), m_events(events), m_numberOfEvents(numberOfEvents) {}
+  constexpr Scenario(const char* name, const Event* events, int numberOfEvents,
+                     int firstFrameEventIndex)
+      : m_name(name),
+        m_events(events),
+        m_numberOfEvents(numberOfEvents),
+        m_firstFrameEventIndex(firstFrameEventIndex) {}
   const char* m_name;
   const Event* m_events;
   int m_numberOfEvents;
+  int m_firstFrameEventIndex;
 };
 
 constexpr static Event scenarioCalculation[] = {
@@ -62,7 +71,8 @@ constexpr static Event scenarioEquation[] = {
 
 constexpr static Scenario scenarios[] = {
     Scenario::build("Calc scrolling", scenarioCalculation),
-    Scenario::build("Sin/Cos graph", scenarioFunctionCosSin),
+    // The 14th event opens the graph of cos and sin
+    Scenario::build("Sin/Cos graph", scenarioFunctionCosSin, 13),
     Scenario::build("Mandelbrot(15)", scenarioPythonMandelbrot),
     Scenario::build("Statistics", scenarioStatistics),
     Scenario::build("Probability", scenarioProbability),
@@ -75,6 +85,15 @@ Event getEvent(int* timeout) {
   static int eventIndex = 0;
   static uint64_t startTime = Ion::Timing::millis();
   static int timings[numberOfScenari];
+  static bool timingFirstFrame = false;
+  static uint64_t firstFrameStartTime = 0;
+  static int firstFrameTimings[numberOfScenari];
+  if (timingFirstFrame) {
+    // The previous event has been handled and the screen redrawn
+    firstFrameTimings[scenarioIndex] =
+        Ion::Timing::millis() - firstFrameStartTime;
+    timingFirstFrame = false;
+  }
   if (eventIndex >= scenarios[scenarioIndex].numberOfEvents()) {
     timings[scenarioIndex++] = Ion::Timing::millis() - startTime;
     eventIndex = 0;
@@ -100,10 +119,20 @@ Event getEvent(int* timeout) {
       ctx->drawString(scenarios[i].name(), KDPoint(0, line_y), font);
       ctx->drawString(buffer, KDPoint(200, line_y), font);
       line_y += line_height;
+      if (scenarios[i].firstFrameEventIndex() >= 0) {
+        Poincare::PrintInt::Left(firstFrameTimings[i], buffer, bufferLength);
+        ctx->drawString("  first frame", KDPoint(0, line_y), font);
+        ctx->drawString(buffer, KDPoint(200, line_y), font);
+        line_y += line_height;
+      }
     }
     while (1) {
     }
   }
+  if (eventIndex == scenarios[scenarioIndex].firstFrameEventIndex()) {
+    timingFirstFrame = true;
+    firstFrameStartTime = Ion::Timing::millis();
+  }
   return scenarios[scenarioIndex].eventAtIndex(eventIndex++);
 }
 
@@ -1,9 +1,11 @@
 #include <ion.h>
+#include <omg/thread_local.h>
 
 namespace Ion {
 
-// Stack start will be defined in ion_main.
-static void* s_stackStart = nullptr;
+/* Stack start will be defined in ion_main. It is only defined on the main
+ * thread, so that the threads of other sessions cannot run Python. */
+static OMG_THREAD_LOCAL void* s_stackStart = nullptr;
 
 void* stackStart() {
   assert(s_stackStart != nullptr);
@@ -3,7 +3,10 @@
 #include <poincare/integer.h>
 #include <string.h>
 
+#include <algorithm>
 #include <new>
+
+#include "../crc32_eat_byte.h"
 #if ION_STORAGE_LOG
 #include <iostream>
 #endif
@@ -12,7 +15,7 @@ namespace Ion {
 
 namespace Storage {
 
-OMG::GlobalBox<FileSystem> FileSystem::sharedFileSystem;
+OMG_THREAD_LOCAL OMG::GlobalBox<FileSystem> FileSystem::sharedFileSystem;
 
 // STORAGE
 
@@ -26,6 +29,9 @@ void FileSystem::log() {
 #endif
 
 size_t FileSystem::availableSize() {
+  if (m_gap) {
+    return m_gapSize;
+  }
   /* TODO maybe do: availableSize(char ** endBuffer) to get the endBuffer if it
    * is needed after calling availableSize */
   assert(k_storageSize >= (endBuffer() - m_buffer) + sizeof(record_size_t));
@@ -33,30 +39,81 @@ size_t FileSystem::availableSize() {
 }
 
 size_t FileSystem::putAvailableSpaceAtEndOfRecord(Record r) {
-  char *p = pointerOfRecord(r);
-  size_t previousRecordSize = sizeOfRecordStarting(p);
-  size_t availableStorageSize = availableSize();
-  char *nextRecord = p + previousRecordSize;
-  memmove(nextRecord + availableStorageSize, nextRecord,
-          (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
-  size_t newRecordSize = previousRecordSize + availableStorageSize;
+  char *p = moveGapAfterRecord(pointerOfRecord(r));
+  size_t newRecordSize = sizeOfRecordStarting(p) + m_gapSize;
+  m_gap += m_gapSize;
+  m_gapSize = 0;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
+  m_lastRecordRetrieved = r;
+  m_lastRecordRetrievedPointer = p;
   return newRecordSize;
 }
 
 void FileSystem::getAvailableSpaceFromEndOfRecord(Record r,
                                                   size_t recordAvailableSpace) {
-  char *p = pointerOfRecord(r);
+  char *p = moveGapAfterRecord(pointerOfRecord(r));
   size_t previousRecordSize = sizeOfRecordStarting(p);
-  char *nextRecord = p + previousRecordSize;
-  memmove(nextRecord - recordAvailableSpace, nextRecord,
-          m_buffer + k_storageSize - nextRecord);
+  m_gap -= recordAvailableSpace;
+  m_gapSize += recordAvailableSpace;
+  endRecordsBeforeGap();
   overrideSizeAtPosition(
       p, (record_size_t)(previousRecordSize - recordAvailableSpace));
+  m_lastRecordRetrieved = r;
+  m_lastRecordRetrievedPointer = p;
+}
+
+/* Ion::crc32Byte of the concatenation of a and b. crc32Byte eats whole words
+ * and then the remaining bytes, so the word astride a and b is copied, and the
+ * CRCs of the chunks are chained by linearity: eating chunk c from the state s
+ * gives crc32EatNullBytes(s ^ initial state, |c|) ^ crc32Byte(c). */
+static uint32_t crc32OfConcatenation(const uint8_t *a, size_t aLength,
+                                     const uint8_t *b, size_t bLength) {
+  constexpr size_t k_wordSize = sizeof(uint32_t);
+  constexpr uint32_t k_initialState = 0xFFFFFFFF;
+  size_t straddlingLength = aLength % k_wordSize;
+  size_t bStraddlingLength =
+      straddlingLength == 0 ? 0
+                            : std::min(k_wordSize - straddlingLength, bLength);
+  alignas(uint32_t) uint8_t straddlingWord[k_wordSize];
+  memcpy(straddlingWord, a + aLength - straddlingLength, straddlingLength);
+  memcpy(straddlingWord + straddlingLength, b, bStraddlingLength);
+  const uint8_t *chunks[] = {a, straddlingWord, b + bStraddlingLength};
+  size_t lengths[] = {aLength - straddlingLength,
+                      straddlingLength + bStraddlingLength,
+                      bLength - bStraddlingLength};
+  uint32_t crc = k_initialState;
+  for (int i = 0; i < 3; i++) {
+    if (lengths[i] > 0) {
+      crc = crc32EatNullBytes(crc ^ k_initialState, lengths[i]) ^
+            Ion::crc32Byte(chunks[i], lengths[i]);
+    }
+  }
+  return crc;
 }
 
 uint32_t FileSystem::checksum() {
-  return Ion::crc32Byte((const uint8_t *)m_buffer, endBuffer() - m_buffer);
+  if (!m_gap) {
+    return Ion::crc32Byte((const uint8_t *)m_buffer, endBuffer() - m_buffer);
+  }
+  /* The checksum is the one of the packed layout, without packing. The
+   * records after the gap end with the null size at the end of the buffer. */
+  char *afterGap = m_gap + m_gapSize;
+  return crc32OfConcatenation(
+      (const uint8_t *)m_buffer, m_gap - m_buffer, (const uint8_t *)afterGap,
+      m_buffer + k_storageSize - sizeof(record_size_t) - afterGap);
+}
+
+void FileSystem::packRecords() {
+  if (!m_gap) {
+    return;
+  }
+  // The records after the gap end with the null size at the end of the buffer
+  char *afterGap = m_gap + m_gapSize;
+  memmove(m_gap, afterGap, m_buffer + k_storageSize - afterGap);
+  m_gap = nullptr;
+  m_gapSize = 0;
+  m_lastRecordRetrieved = Record(nullptr);
+  m_lastRecordRetrievedPointer = nullptr;
 }
 
 void FileSystem::notifyChangeToDelegate(const Record record) const {
@@ -160,8 +217,10 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(
 
   assert(recordSize <= availableSize());
 
-  // Find the end of data
-  char *newRecordAddress = endBuffer();
+  // Write the record at the end of the records, where the gap is moved
+  openGap();
+  char *newRecordAddress =
+      moveGapTo(m_buffer + k_storageSize - sizeof(record_size_t));
   char *newRecord = newRecordAddress;
   // Fill totalSize
   newRecord += overrideSizeAtPosition(newRecord, (record_size_t)recordSize);
@@ -172,8 +231,9 @@ Record::ErrorStatus FileSystem::createRecordWithDataChunks(
     newRecord +=
         overrideValueAtPosition(newRecord, dataChunks[i], sizeChunks[i]);
   }
-  // Next Record is null-sized
-  overrideSizeAtPosition(newRecord, 0);
+  m_gap = newRecord;
+  m_gapSize -= recordSize;
+  endRecordsBeforeGap();
   Record r = Record(recordName);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -250,11 +310,13 @@ const char *FileSystem::extensionOfRecordBaseNamedWithExtensions(
 
 void FileSystem::destroyAllRecords() {
   overrideSizeAtPosition(m_buffer, 0);
+  m_gap = nullptr;
+  m_gapSize = 0;
   notifyChangeToDelegate();
 }
 
 void FileSystem::destroyRecordsWithExtension(const char *extension) {
-  char *currentRecordStart = (char *)m_buffer;
+  char *currentRecordStart = *begin();
   bool didChange = false;
   while (currentRecordStart && sizeOfRecordStarting(currentRecordStart) != 0) {
     Record::Name currentName = nameOfRecordStarting(currentRecordStart);
@@ -263,9 +325,12 @@ void FileSystem::destroyRecordsWithExtension(const char *extension) {
       Record currentRecord(currentName);
       currentRecord.destroy();
       didChange = true;
+      // The gap took the place of the record, the next record follows it
+      currentRecordStart = m_gap + m_gapSize;
       continue;
     }
-    currentRecordStart = *(RecordIterator(currentRecordStart).operator++());
+    currentRecordStart =
+        *(RecordIterator(currentRecordStart, m_gap, m_gapSize).operator++());
   }
   if (didChange) {
     notifyChangeToDelegate();
@@ -317,7 +382,9 @@ FileSystem::FileSystem()
       m_magicFooter(Magic),
       m_delegate(nullptr),
       m_lastRecordRetrieved(nullptr),
-      m_lastRecordRetrievedPointer(nullptr) {
+      m_lastRecordRetrievedPointer(nullptr),
+      m_gap(nullptr),
+      m_gapSize(0) {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
   // Set the size of the first record to 0
@@ -356,8 +423,8 @@ Record::ErrorStatus FileSystem::setNameOfRecord(Record *record,
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     size_t newRecordSize = previousRecordSize - previousNameSize + nameSize;
     if (newRecordSize >= k_maxRecordSize ||
-        !slideBuffer(p + sizeof(record_size_t) + previousNameSize,
-                     nameSize - previousNameSize)) {
+        !slideEndOfRecord(&p, sizeof(record_size_t) + previousNameSize,
+                          nameSize - previousNameSize)) {
       return notifyFullnessToDelegate();
     }
     overrideSizeAtPosition(p, newRecordSize);
@@ -399,12 +466,21 @@ Record::ErrorStatus FileSystem::setValueOfRecord(Record record,
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     Record::Name name = nameOfRecordStarting(p);
     size_t newRecordSize = sizeOfRecordWithName(name, data.size);
+    record_size_t nameSize = Record::SizeOfName(name);
+    /* The data may be the value of the record itself, which moves with the
+     * record when the gap is before it. */
+    const char *dataBuffer = static_cast<const char *>(data.buffer);
+    bool dataIsInRecord =
+        dataBuffer >= p && dataBuffer < p + previousRecordSize;
+    size_t dataOffset = dataBuffer - p;
     if (newRecordSize >= k_maxRecordSize ||
-        !slideBuffer(p + previousRecordSize,
-                     newRecordSize - previousRecordSize)) {
+        !slideEndOfRecord(&p, previousRecordSize,
+                          newRecordSize - previousRecordSize)) {
       return notifyFullnessToDelegate();
     }
-    record_size_t nameSize = Record::SizeOfName(name);
+    if (dataIsInRecord) {
+      data.buffer = p + dataOffset;
+    }
     overrideSizeAtPosition(p, newRecordSize);
     overrideValueAtPosition(p + sizeof(record_size_t) + nameSize, data.buffer,
                             data.size);
@@ -426,7 +502,7 @@ bool FileSystem::destroyRecord(Record record, bool notifyDelegate) {
   char *p = pointerOfRecord(record);
   if (p) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
-    slideBuffer(p + previousRecordSize, -previousRecordSize);
+    slideEndOfRecord(&p, previousRecordSize, -previousRecordSize);
     if (notifyDelegate) {
       notifyChangeToDelegate();
     }
@@ -516,6 +592,8 @@ bool FileSystem::isNameOfRecordTaken(Record r, const Record *recordToExclude) {
 }
 
 char *FileSystem::endBuffer() {
+  // The records only follow each other when there is no gap
+  assert(!m_gap);
   char *currentBuffer = m_buffer;
   for (char *p : *this) {
     currentBuffer += sizeOfRecordStarting(p);
@@ -527,15 +605,64 @@ size_t FileSystem::sizeOfRecordWithName(Record::Name name, size_t dataSize) {
   return Record::SizeOfName(name) + dataSize + sizeof(record_size_t);
 }
 
-bool FileSystem::slideBuffer(char *position, int delta) {
+bool FileSystem::slideEndOfRecord(char **record, size_t offset, int delta) {
   if (delta > (int)availableSize()) {
     return false;
   }
-  memmove(position + delta, position,
-          endBuffer() + sizeof(record_size_t) - position);
+  *record = moveGapAfterRecord(*record);
+  char *position = *record + offset;
+  memmove(position + delta, position, m_gap - position);
+  m_gap += delta;
+  m_gapSize -= delta;
+  endRecordsBeforeGap();
   return true;
 }
 
+void FileSystem::endRecordsBeforeGap() {
+  /* As in the packed layout, a null size follows the records before the gap,
+   * so that a value that is not null terminated is followed by zeros. */
+  if (m_gapSize >= sizeof(record_size_t)) {
+    overrideSizeAtPosition(m_gap, 0);
+  }
+}
+
+void FileSystem::openGap() {
+  if (m_gap) {
+    return;
+  }
+  /* The gap starts at the end of the records, and the null size that ends them
+   * goes to the end of the buffer. */
+  m_gapSize = availableSize();
+  m_gap = endBuffer();
+  overrideSizeAtPosition(m_gap + m_gapSize, 0);
+}
+
+char *FileSystem::moveGapTo(char *position) {
+  openGap();
+  if (position == m_gap) {
+    return m_gap;
+  }
+  if (position < m_gap) {
+    // The records between position and the gap slide after it
+    memmove(position + m_gapSize, position, m_gap - position);
+  } else {
+    // The records between the gap and position slide before it
+    char *afterGap = m_gap + m_gapSize;
+    assert(position >= afterGap);
+    memmove(m_gap, afterGap, position - afterGap);
+    position -= m_gapSize;
+  }
+  m_gap = position;
+  m_lastRecordRetrieved = Record(nullptr);
+  m_lastRecordRetrievedPointer = nullptr;
+  return m_gap;
+}
+
+char *FileSystem::moveGapAfterRecord(char *record) {
+  record_size_t size = sizeOfRecordStarting(record);
+  return moveGapTo(record + size) - size;
+}
+
 Record FileSystem::privateRecordBasedNamedWithExtensions(
     const char *baseName, int baseNameLength, const char *const extensions[],
     size_t numberOfExtensions, const char **extensionResult) {
@@ -585,6 +712,9 @@ FileSystem::RecordIterator &FileSystem::RecordIterator::operator++() {
   assert(m_recordStart);
   record_size_t size = StorageHelper::unalignedShort(m_recordStart);
   char *nextRecord = m_recordStart + size;
+  if (nextRecord == m_gap) {
+    nextRecord += m_gapSize;
+  }
   record_size_t newRecordSize = StorageHelper::unalignedShort(nextRecord);
   m_recordStart = (newRecordSize == 0 ? nullptr : nextRecord);
   return *this;
@@ -1,19 +1,23 @@
 #include <assert.h>
 #include <ion/circuit_breaker.h>
+#include <omg/thread_local.h>
 
 namespace Ion {
 namespace CircuitBreaker {
 
-Status sStatus = Status::Interrupted;
+/* A checkpoint can only be loaded on the thread that set it, so each session
+ * has its own checkpoints and locks. */
+OMG_THREAD_LOCAL Status sStatus = Status::Interrupted;
 constexpr static int k_numberOfCheckpointTypes =
     static_cast<uint8_t>(CheckpointType::NumberOfCheckpoints);  // 3
-bool sCheckpointsSet[k_numberOfCheckpointTypes] = {false, false, false};
-jmp_buf sBuffers[k_numberOfCheckpointTypes];
-jmp_buf sDummyBuffer;
+OMG_THREAD_LOCAL bool sCheckpointsSet[k_numberOfCheckpointTypes] = {
+    false, false, false};
+OMG_THREAD_LOCAL jmp_buf sBuffers[k_numberOfCheckpointTypes];
+OMG_THREAD_LOCAL jmp_buf sDummyBuffer;
 
-int sNumberOfLocks = 0;
-bool sLoadCheckpointInterrupted = false;
-CheckpointType sLockedCheckpointType;
+OMG_THREAD_LOCAL int sNumberOfLocks = 0;
+OMG_THREAD_LOCAL bool sLoadCheckpointInterrupted = false;
+OMG_THREAD_LOCAL CheckpointType sLockedCheckpointType;
 
 Status status() { return sStatus; }
 
@@ -1,32 +1,115 @@
+#include "crc32.h"
+
 #include <ion.h>
-#include <ion/src/shared/crc32_eat_byte.h>
 
 namespace Ion {
 
+namespace Simulator {
+namespace CRC32 {
+
+constexpr uint32_t k_polynomial = 0x04C11DB7;
 constexpr size_t k_uint32ByteLength = sizeof(uint32_t) / sizeof(uint8_t);
 
-uint32_t crc32Byte(const uint8_t *data, size_t length) {
-  if (length == 0) {
-    return 0;
+/* Slicing-by-8 tables: s_tables[k][b] is the CRC, from 0, of byte b followed
+ * by k null bytes. Eight bytes are then eaten with eight lookups. */
+struct Tables {
+  uint32_t values[8][256];
+};
+
+constexpr static Tables s_tables = [] {
+  Tables tables = {};
+  for (uint32_t b = 0; b < 256; b++) {
+    uint32_t crc = b << 24;
+    for (int i = 0; i < 8; i++) {
+      crc = crc & 0x80000000 ? ((crc << 1) ^ k_polynomial) : (crc << 1);
+    }
+    tables.values[0][b] = crc;
   }
-  assert(data != nullptr);
-  uint32_t crc = 0xFFFFFFFF;
-  size_t lengthInDoubleWords = length / k_uint32ByteLength;
-
-  for (size_t i = 0; i < lengthInDoubleWords; i++) {
-    // FIXME: Assumes little-endian byte order!
-    for (int j = k_uint32ByteLength - 1; j >= 0; j--) {
-      // scan byte by byte to avoid alignment issue when building for emscripten
-      // platform
-      crc = crc32EatByte(crc, data[i * k_uint32ByteLength + j]);
+  for (int k = 1; k < 8; k++) {
+    for (int b = 0; b < 256; b++) {
+      uint32_t previous = tables.values[k - 1][b];
+      tables.values[k][b] = (previous << 8) ^ tables.values[0][previous >> 24];
     }
   }
-  for (size_t i = lengthInDoubleWords * k_uint32ByteLength; i < length; i++) {
-    crc = crc32EatByte(crc, data[i]);
+  return tables;
+}();
+
+static uint32_t eatByte(uint32_t crc, uint8_t data) {
+  return (crc << 8) ^ s_tables.values[0][(crc >> 24) ^ data];
+}
+
+static uint32_t loadWord(const uint8_t *data) {
+  // Byte by byte to avoid alignment issues when building for emscripten
+  return data[0] | (data[1] << 8) | (data[2] << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// word must already be xored with the state
+static uint32_t eatWord(uint32_t word, const uint32_t (*tables)[256]) {
+  return tables[3][word >> 24] ^ tables[2][(word >> 16) & 0xFF] ^
+         tables[1][(word >> 8) & 0xFF] ^ tables[0][word & 0xFF];
+}
+
+uint32_t eatBytes(uint32_t crc, const uint8_t *data, size_t length) {
+  const uint8_t *end = data + length;
+  // FIXME: Assumes little-endian byte order!
+  while (end - data >= 2 * static_cast<ptrdiff_t>(k_uint32ByteLength)) {
+    uint32_t first = loadWord(data) ^ crc;
+    uint32_t second = loadWord(data + k_uint32ByteLength);
+    crc = eatWord(first, s_tables.values + 4) ^
+          eatWord(second, s_tables.values);
+    data += 2 * k_uint32ByteLength;
+  }
+  if (end - data >= static_cast<ptrdiff_t>(k_uint32ByteLength)) {
+    crc = eatWord(loadWord(data) ^ crc, s_tables.values);
+    data += k_uint32ByteLength;
+  }
+  while (data < end) {
+    crc = eatByte(crc, *data++);
   }
   return crc;
 }
 
+Shift::Shift(size_t length) {
+  assert(length % k_uint32ByteLength == 0);
+  // Image of each bit of the state, then of each byte by linearity
+  uint32_t bitImages[32];
+  uint8_t zeros[64] = {};
+  for (int bit = 0; bit < 32; bit++) {
+    uint32_t crc = static_cast<uint32_t>(1) << bit;
+    for (size_t eaten = 0; eaten < length; eaten += sizeof(zeros)) {
+      size_t chunk = length - eaten < sizeof(zeros) ? length - eaten
+                                                    : sizeof(zeros);
+      crc = eatBytes(crc, zeros, chunk);
+    }
+    bitImages[bit] = crc;
+  }
+  for (int k = 0; k < 4; k++) {
+    int firstBit = 8 * (3 - k);
+    for (int b = 0; b < 256; b++) {
+      uint32_t image = 0;
+      for (int i = 0; i < 8; i++) {
+        if (b & (1 << i)) {
+          image ^= bitImages[firstBit + i];
+        }
+      }
+      m_tables[k][b] = image;
+    }
+  }
+}
+
+}  // namespace CRC32
+}  // namespace Simulator
+
+uint32_t crc32Byte(const uint8_t *data, size_t length) {
+  if (length == 0) {
+    return 0;
+  }
+  assert(data != nullptr);
+  return Simulator::CRC32::eatBytes(Simulator::CRC32::k_initialValue, data,
+                                    length);
+}
+
 uint32_t crc32Word(const uint16_t *data, size_t length) {
   return crc32Byte(reinterpret_cast<const uint8_t *>(data),
                    length * (sizeof(uint16_t) / sizeof(uint8_t)));
@@ -34,7 +117,7 @@ uint32_t crc32Word(const uint16_t *data, size_t length) {
 
 uint32_t crc32DoubleWord(const uint32_t *data, size_t length) {
   return crc32Byte(reinterpret_cast<const uint8_t *>(data),
-                   length * k_uint32ByteLength);
+                   length * Simulator::CRC32::k_uint32ByteLength);
 }
 
 }  // namespace Ion
@@ -0,0 +1,41 @@
+#ifndef ION_SIMULATOR_CRC32_H
+#define ION_SIMULATOR_CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Ion {
+namespace Simulator {
+namespace CRC32 {
+
+/* Streaming version of Ion::crc32Byte, with the same conventions as the
+ * hardware CRC unit of the device: whole 32bit words are read in little-endian
+ * order and fed most significant byte first.
+ * crc32Byte(data, length) == eatBytes(k_initialValue, data, length), and data
+ * can be split into several calls as long as all chunks but the last one have
+ * a length multiple of 4. */
+constexpr uint32_t k_initialValue = 0xFFFFFFFF;
+uint32_t eatBytes(uint32_t crc, const uint8_t *data, size_t length);
+
+/* The CRC is linear, so that for a chunk B of fixed length, eating B from a
+ * state s gives shift(s) ^ eatBytes(0, B), where shift only depends on the
+ * length of B. This lets a checksum be updated by only rehashing the chunks
+ * which changed. */
+class Shift {
+ public:
+  // length must be a multiple of 4
+  Shift(size_t length);
+  uint32_t operator()(uint32_t crc) const {
+    return m_tables[0][crc >> 24] ^ m_tables[1][(crc >> 16) & 0xFF] ^
+           m_tables[2][(crc >> 8) & 0xFF] ^ m_tables[3][crc & 0xFF];
+  }
+
+ private:
+  uint32_t m_tables[4][256];
+};
+
+}  // namespace CRC32
+}  // namespace Simulator
+}  // namespace Ion
+
+#endif
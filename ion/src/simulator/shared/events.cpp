@@ -79,6 +79,7 @@ static Journal *sSourceJournal = nullptr;
 static Journal *sDestinationJournal = nullptr;
 void replayFrom(Journal *l) { sSourceJournal = l; }
 void logTo(Journal *l) { sDestinationJournal = l; }
+bool isReplaying() { return sSourceJournal != nullptr; }
 
 Event getEvent(int *timeout) {
   Event nextEvent = Events::None;
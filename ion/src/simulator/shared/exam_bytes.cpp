@@ -1,9 +1,12 @@
 #include <ion/exam_bytes.h>
+#include <omg/thread_local.h>
 
 namespace Ion {
 namespace ExamBytes {
 
-Int s_examBytes = 0;
+/* Each session has its own exam mode, which starts Off. The LED of the
+ * simulator is a dummy, so the sessions do not share any exam mode state. */
+static OMG_THREAD_LOCAL Int s_examBytes = 0;
 
 Int read() { return s_examBytes; }
 void write(Int examBytes) { s_examBytes = examBytes; }
@@ -4,6 +4,7 @@
 #include <kandinsky/color.h>
 #include <kandinsky/framebuffer.h>
 
+#include "crc32.h"
 #include "window.h"
 
 /* Drawing on an SDL texture
@@ -20,6 +21,23 @@
 static KDColor sPixels[Ion::Display::Width * Ion::Display::Height];
 static bool sFrameBufferActive = false;
 
+/* The CRC32 of the framebuffer is computed after each event when running
+ * scenarios with --compute-hash. Since most events only redraw a few rows, the
+ * CRC32 of each row is kept and only the rows written to since the last
+ * computation are hashed again. */
+static uint32_t sRowsCRC32[Ion::Display::Height];
+static bool sRowIsDirty[Ion::Display::Height];
+static bool sRowsCRC32AreValid = false;
+
+static void markRowsAsDirty(KDRect r) {
+  int top = r.top() < 0 ? 0 : r.top();
+  int bottom =
+      r.bottom() >= Ion::Display::Height ? Ion::Display::Height - 1 : r.bottom();
+  for (int row = top; row <= bottom; row++) {
+    sRowIsDirty[row] = true;
+  }
+}
+
 namespace Ion {
 namespace Display {
 
@@ -29,6 +47,7 @@ static KDFrameBuffer sFrameBuffer =
 void pushRect(KDRect r, const KDColor* pixels) {
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
+    markRowsAsDirty(r);
     sFrameBuffer.pushRect(r, pixels);
   }
 }
@@ -36,6 +55,7 @@ void pushRect(KDRect r, const KDColor* pixels) {
 void pushRectUniform(KDRect r, KDColor c) {
   if (sFrameBufferActive) {
     Simulator::Window::setNeedsRefresh();
+    markRowsAsDirty(r);
     sFrameBuffer.pushRectUniform(r, c);
   }
 }
@@ -57,6 +77,23 @@ const KDColor* address() { return sPixels; }
 
 void setActive(bool enabled) { sFrameBufferActive = enabled; }
 
+uint32_t crc32() {
+  constexpr size_t k_rowLength = Display::Width * sizeof(KDColor);
+  static const CRC32::Shift s_shiftByRow(k_rowLength);
+  uint32_t crc = CRC32::k_initialValue;
+  for (int row = 0; row < Display::Height; row++) {
+    if (!sRowsCRC32AreValid || sRowIsDirty[row]) {
+      sRowsCRC32[row] = CRC32::eatBytes(
+          0, reinterpret_cast<const uint8_t*>(sPixels + row * Display::Width),
+          k_rowLength);
+      sRowIsDirty[row] = false;
+    }
+    crc = s_shiftByRow(crc) ^ sRowsCRC32[row];
+  }
+  sRowsCRC32AreValid = true;
+  return crc;
+}
+
 }  // namespace Framebuffer
 }  // namespace Simulator
 }  // namespace Ion
@@ -2,6 +2,7 @@
 #define ION_SIMULATOR_FRAMEBUFFER_H
 
 #include <kandinsky/color.h>
+#include <stdint.h>
 
 namespace Ion {
 namespace Simulator {
@@ -9,6 +10,8 @@ namespace Framebuffer {
 
 const KDColor* address();
 void setActive(bool enabled);
+// Equal to Ion::crc32Word on the whole framebuffer
+uint32_t crc32();
 
 }  // namespace Framebuffer
 }  // namespace Simulator
@@ -87,19 +87,8 @@ void Screenshot::capture(Events::Event nextEvent) {
     return;
   }
 
-  constexpr static int k_maxHeight =
-      Display::Height + k_glyphHeight + 2 * k_margin;
-  constexpr static int k_width = Display::Width;
-  int height = Display::Height;
-
-  KDColor pixelsBuffer[k_maxHeight * k_width];
-  for (int i = 0; i < height * k_width; i++) {
-    pixelsBuffer[i] = Simulator::Framebuffer::address()[i];
-  }
-
   if (m_computeCRC32) {
-    uint32_t newCRC32 = Ion::crc32Word(
-        reinterpret_cast<const uint16_t*>(pixelsBuffer), height * k_width);
+    uint32_t newCRC32 = Simulator::Framebuffer::crc32();
     if (m_stepNumber == 0) {
       m_CRC32 = newCRC32;
     } else {
@@ -112,6 +101,16 @@ void Screenshot::capture(Events::Event nextEvent) {
     return;
   }
 
+  constexpr static int k_maxHeight =
+      Display::Height + k_glyphHeight + 2 * k_margin;
+  constexpr static int k_width = Display::Width;
+  int height = Display::Height;
+
+  KDColor pixelsBuffer[k_maxHeight * k_width];
+  for (int i = 0; i < height * k_width; i++) {
+    pixelsBuffer[i] = Simulator::Framebuffer::address()[i];
+  }
+
 #if DEBUG && ESCHER_LOG_EVENTS_NAME
   if (m_eachStep) {
     height = k_maxHeight;
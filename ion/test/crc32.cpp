@@ -13,3 +13,32 @@ QUIZ_CASE(ion_crc32) {
   quiz_assert(Ion::crc32Byte(inputBytes, 6) == 0x7BCD4EB3);
   quiz_assert(Ion::crc32Byte(inputBytes, 8) == 0x72EAD3FB);
 }
+
+static uint32_t bitwiseCRC32(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    // Whole words are fed most significant byte first
+    size_t wordStart = i - i % 4;
+    size_t index = wordStart + 4 <= length ? wordStart + 3 - i % 4 : i;
+    crc ^= data[index] << 24;
+    for (int j = 0; j < 8; j++) {
+      crc = crc & 0x80000000 ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1);
+    }
+  }
+  return length == 0 ? 0 : crc;
+}
+
+QUIZ_CASE(ion_crc32_lengths) {
+  constexpr size_t k_maxLength = 67;
+  uint8_t data[k_maxLength];
+  uint32_t seed = 0x2545F491;
+  for (size_t i = 0; i < k_maxLength; i++) {
+    seed = seed * 1103515245 + 12345;
+    data[i] = seed >> 24;
+  }
+  for (size_t length = 0; length <= k_maxLength; length++) {
+    quiz_assert(Ion::crc32Byte(data, length) == bitwiseCRC32(data, length));
+  }
+  // Unaligned buffers
+  quiz_assert(Ion::crc32Byte(data + 1, 33) == bitwiseCRC32(data + 1, 33));
+}
@@ -570,6 +570,87 @@ aaaaaa)";
   retrievedRecord4.destroy();
 }
 
+QUIZ_CASE(ion_storage_edit_record_before_other_records) {
+  size_t initialAvailableSize =
+      Storage::FileSystem::sharedFileSystem->availableSize();
+  const char *scriptText = "from math import *\n";
+  quiz_assert(Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
+                  "script", "py", scriptText, strlen(scriptText) + 1) ==
+              Storage::Record::ErrorStatus::None);
+
+  // 40 KB of records after the script
+  constexpr int k_numberOfOtherRecords = 40;
+  constexpr size_t k_otherRecordSize = 1000;
+  char otherData[k_otherRecordSize];
+  char otherBaseName[] = "otherA";
+  for (int i = 0; i < k_numberOfOtherRecords; i++) {
+    memset(otherData, 'a' + i % 26, k_otherRecordSize);
+    otherBaseName[5] = 'A' + i;
+    quiz_assert(
+        Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
+            otherBaseName, "rec", otherData, k_otherRecordSize) ==
+        Storage::Record::ErrorStatus::None);
+  }
+
+  /* Type a character in the script as the Python editor does, and rename it,
+   * so that each edit grows or shrinks the script. */
+  constexpr int k_numberOfEdits = 200;
+  size_t scriptLength = strlen(scriptText);
+  for (int i = 0; i < k_numberOfEdits; i++) {
+    Storage::Record script =
+        Storage::FileSystem::sharedFileSystem->recordBaseNamedWithExtension(
+            i % 2 == 0 ? "script" : "edited", "py");
+    quiz_assert(!script.isNull());
+    Storage::FileSystem::sharedFileSystem->putAvailableSpaceAtEndOfRecord(
+        script);
+    Storage::Record::Data value = script.value();
+    char *text = const_cast<char *>(static_cast<const char *>(value.buffer));
+    text[scriptLength++] = '#';
+    text[scriptLength] = 0;
+    Storage::FileSystem::sharedFileSystem->getAvailableSpaceFromEndOfRecord(
+        script, value.size - (scriptLength + 1));
+    quiz_assert(Storage::Record::SetBaseNameWithExtension(
+                    &script, i % 2 == 0 ? "edited" : "script", "py") ==
+                Storage::Record::ErrorStatus::None);
+  }
+
+  // The other records have not changed, nor their order
+  quiz_assert(Storage::FileSystem::sharedFileSystem
+                  ->numberOfRecordsWithExtension("rec") ==
+              k_numberOfOtherRecords);
+  for (int i = 0; i < k_numberOfOtherRecords; i++) {
+    Storage::Record other =
+        Storage::FileSystem::sharedFileSystem->recordWithExtensionAtIndex(
+            "rec", i);
+    otherBaseName[5] = 'A' + i;
+    quiz_assert(other == Storage::Record(otherBaseName, "rec"));
+    Storage::Record::Data value = other.value();
+    quiz_assert(value.size == k_otherRecordSize);
+    for (size_t j = 0; j < k_otherRecordSize; j++) {
+      quiz_assert(static_cast<const char *>(value.buffer)[j] == 'a' + i % 26);
+    }
+  }
+  Storage::Record script =
+      Storage::FileSystem::sharedFileSystem->recordBaseNamedWithExtension(
+          "script", "py");
+  quiz_assert(script.value().size == scriptLength + 1);
+  quiz_assert(strncmp(static_cast<const char *>(script.value().buffer),
+                      scriptText, strlen(scriptText)) == 0);
+
+  // Packing the records does not change the storage
+  uint32_t checksum = Storage::FileSystem::sharedFileSystem->checksum();
+  size_t availableSize = Storage::FileSystem::sharedFileSystem->availableSize();
+  Storage::FileSystem::sharedFileSystem->packRecords();
+  quiz_assert(Storage::FileSystem::sharedFileSystem->checksum() == checksum);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->availableSize() ==
+              availableSize);
+
+  Storage::FileSystem::sharedFileSystem->destroyRecordsWithExtension("rec");
+  script.destroy();
+  quiz_assert(Storage::FileSystem::sharedFileSystem->availableSize() ==
+              initialAvailableSize);
+}
+
 void createTestRecordWithErrorStatus(const char *baseName,
                                      const char *extension,
                                      const char *data = nullptr,
@@ -597,6 +678,159 @@ bool isDataOfRecord(const char *baseName, const char *extension,
   return strcmp(recordData, data) == 0;
 }
 
+/* The records of these tests are named by a letter and their value is this
+ * letter repeated. Their sizes are odd so that the gap is not aligned. */
+constexpr static const char *k_gapExtension = "gap";
+
+void setRepeatedRecord(const char *baseName, size_t size) {
+  char data[64];
+  assert(size <= sizeof(data));
+  memset(data, baseName[0], size);
+  Storage::Record record(baseName, k_gapExtension);
+  if (Storage::FileSystem::sharedFileSystem->hasRecord(record)) {
+    quiz_assert(record.setValue({.buffer = data, .size = size}) ==
+                Storage::Record::ErrorStatus::None);
+  } else {
+    quiz_assert(
+        Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
+            baseName, k_gapExtension, data, size) ==
+        Storage::Record::ErrorStatus::None);
+  }
+}
+
+void assertRepeatedRecordsAre(const char *baseNames, const size_t sizes[]) {
+  int numberOfRecords = strlen(baseNames);
+  quiz_assert(Storage::FileSystem::sharedFileSystem
+                  ->numberOfRecordsWithExtension(k_gapExtension) ==
+              numberOfRecords);
+  for (int i = 0; i < numberOfRecords; i++) {
+    Storage::Record record =
+        Storage::FileSystem::sharedFileSystem->recordWithExtensionAtIndex(
+            k_gapExtension, i);
+    char baseName[] = {baseNames[i], 0};
+    quiz_assert(record == Storage::Record(baseName, k_gapExtension));
+    Storage::Record::Data value = record.value();
+    quiz_assert(value.size == sizes[i]);
+    for (size_t j = 0; j < value.size; j++) {
+      quiz_assert(static_cast<const char *>(value.buffer)[j] == baseNames[i]);
+    }
+  }
+}
+
+void assertChecksumIsTheOneOfPackedRecords() {
+  uint32_t checksum = Storage::FileSystem::sharedFileSystem->checksum();
+  Storage::FileSystem::sharedFileSystem->packRecords();
+  quiz_assert(Storage::FileSystem::sharedFileSystem->checksum() == checksum);
+}
+
+QUIZ_CASE(ion_storage_gap_moves_backward_and_forward) {
+  size_t initialAvailableSize =
+      Storage::FileSystem::sharedFileSystem->availableSize();
+  size_t sizes[] = {5, 7, 9, 11};
+  setRepeatedRecord("A", sizes[0]);
+  setRepeatedRecord("B", sizes[1]);
+  setRepeatedRecord("C", sizes[2]);
+  setRepeatedRecord("D", sizes[3]);
+  assertRepeatedRecordsAre("ABCD", sizes);
+
+  // The gap goes after C, backward after A, forward after D and back after B
+  sizes[2] = 21;
+  setRepeatedRecord("C", sizes[2]);
+  assertRepeatedRecordsAre("ABCD", sizes);
+  sizes[0] = 3;
+  setRepeatedRecord("A", sizes[0]);
+  assertRepeatedRecordsAre("ABCD", sizes);
+  sizes[3] = 13;
+  setRepeatedRecord("D", sizes[3]);
+  assertRepeatedRecordsAre("ABCD", sizes);
+  sizes[1] = 1;
+  setRepeatedRecord("B", sizes[1]);
+  assertRepeatedRecordsAre("ABCD", sizes);
+
+  // New records are still appended after the last one
+  setRepeatedRecord("E", 15);
+  size_t sizesWithE[] = {sizes[0], sizes[1], sizes[2], sizes[3], 15};
+  assertRepeatedRecordsAre("ABCDE", sizesWithE);
+
+  Storage::FileSystem::sharedFileSystem->destroyRecordsWithExtension(
+      k_gapExtension);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->availableSize() ==
+              initialAvailableSize);
+}
+
+QUIZ_CASE(ion_storage_gap_at_start_of_buffer) {
+  Storage::FileSystem::sharedFileSystem->destroyAllRecords();
+  size_t sizes[] = {5, 7, 9};
+  setRepeatedRecord("A", 3);
+  setRepeatedRecord("B", sizes[0]);
+  setRepeatedRecord("C", sizes[1]);
+  setRepeatedRecord("D", sizes[2]);
+
+  // Destroying the first record leaves the gap at the start of the buffer
+  Storage::Record("A", k_gapExtension).destroy();
+  assertRepeatedRecordsAre("BCD", sizes);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->recordNamed("C.gap") ==
+              Storage::Record("C", k_gapExtension));
+  assertChecksumIsTheOneOfPackedRecords();
+  assertRepeatedRecordsAre("BCD", sizes);
+
+  Storage::FileSystem::sharedFileSystem->destroyAllRecords();
+}
+
+QUIZ_CASE(ion_storage_destroy_records_with_extension_around_gap) {
+  size_t initialAvailableSize =
+      Storage::FileSystem::sharedFileSystem->availableSize();
+  const char *kept = "kept";
+  setRepeatedRecord("A", 5);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
+                  "K", "keep", kept, strlen(kept) + 1) ==
+              Storage::Record::ErrorStatus::None);
+  setRepeatedRecord("B", 7);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
+                  "L", "keep", kept, strlen(kept) + 1) ==
+              Storage::Record::ErrorStatus::None);
+  setRepeatedRecord("C", 9);
+
+  // The gap is after B, between the records to destroy and the ones to keep
+  setRepeatedRecord("B", 3);
+  Storage::FileSystem::sharedFileSystem->destroyRecordsWithExtension(
+      k_gapExtension);
+  assertRepeatedRecordsAre("", nullptr);
+  quiz_assert(Storage::FileSystem::sharedFileSystem
+                  ->numberOfRecordsWithExtension("keep") == 2);
+  quiz_assert(isDataOfRecord("K", "keep", kept));
+  quiz_assert(isDataOfRecord("L", "keep", kept));
+  assertChecksumIsTheOneOfPackedRecords();
+
+  Storage::FileSystem::sharedFileSystem->destroyRecordsWithExtension("keep");
+  quiz_assert(Storage::FileSystem::sharedFileSystem->availableSize() ==
+              initialAvailableSize);
+}
+
+QUIZ_CASE(ion_storage_checksum_around_gap) {
+  size_t initialAvailableSize =
+      Storage::FileSystem::sharedFileSystem->availableSize();
+  uint32_t initialChecksum = Storage::FileSystem::sharedFileSystem->checksum();
+  const char *baseNames[] = {"A", "B", "C", "D", "E"};
+  for (int i = 0; i < 5; i++) {
+    setRepeatedRecord(baseNames[i], 2 * i + 1);
+  }
+  // The gap goes after each record in turn, with every alignment
+  for (int size = 1; size <= 8; size++) {
+    for (int i = 0; i < 5; i++) {
+      setRepeatedRecord(baseNames[(i * size) % 5], size + i);
+      assertChecksumIsTheOneOfPackedRecords();
+    }
+  }
+
+  Storage::FileSystem::sharedFileSystem->destroyRecordsWithExtension(
+      k_gapExtension);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->availableSize() ==
+              initialAvailableSize);
+  quiz_assert(Storage::FileSystem::sharedFileSystem->checksum() ==
+              initialChecksum);
+}
+
 QUIZ_CASE(ion_storage_record_name_verifier) {
   Ion::Storage::RecordNameVerifier *recordNameVerifier =
       Storage::FileSystem::sharedFileSystem->recordNameVerifier();
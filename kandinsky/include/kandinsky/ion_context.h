@@ -11,12 +11,17 @@ class KDIonContext : public KDContext {
   static OMG::GlobalBox<KDIonContext> SharedContext;
   static void Putchar(char c);
   static void Clear(KDPoint newCursorPosition = KDPointZero);
+  /* Number of pixels pushed to the display since boot, to measure overdraw.
+   * It wraps around, so only differences are meaningful. */
+  static uint32_t NumberOfPushedPixels() { return s_numberOfPushedPixels; }
 
  private:
   KDIonContext();
   void pushRect(KDRect rect, const KDColor* pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor* pixels) override;
+
+  static uint32_t s_numberOfPushedPixels;
 };
 
 #endif
@@ -2,14 +2,17 @@
 #include <kandinsky/ion_context.h>
 
 OMG::GlobalBox<KDIonContext> KDIonContext::SharedContext;
+uint32_t KDIonContext::s_numberOfPushedPixels = 0;
 
 KDIonContext::KDIonContext() : KDContext(KDPointZero, KDRectScreen) {}
 
 void KDIonContext::pushRect(KDRect rect, const KDColor* pixels) {
+  s_numberOfPushedPixels += rect.width() * rect.height();
   Ion::Display::pushRect(rect, pixels);
 }
 
 void KDIonContext::pushRectUniform(KDRect rect, KDColor color) {
+  s_numberOfPushedPixels += rect.width() * rect.height();
   Ion::Display::pushRectUniform(rect, color);
 }
 
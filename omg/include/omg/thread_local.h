@@ -0,0 +1,15 @@
+#ifndef OMG_THREAD_LOCAL_H
+#define OMG_THREAD_LOCAL_H
+
+/* The globals that hold the state of a calculator session are thread local on
+ * the hosts that run several sessions, or the workers of Poincare, in one
+ * process. Each thread then initializes the globals it uses. The read-only
+ * data, such as the fonts and the translations, is const and shared by all
+ * the threads. */
+#if OMG_THREAD_LOCAL_GLOBALS
+#define OMG_THREAD_LOCAL thread_local
+#else
+#define OMG_THREAD_LOCAL
+#endif
+
+#endif
@@ -48,6 +48,16 @@ class AbsoluteValueNode final : public ExpressionNode {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext,
                                                     computeOnComplex<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode,
@@ -97,6 +97,16 @@ class AdditionNode final : public NAryInfixExpressionNode {
     return ApproximationHelper::MapReduce<double>(this, approximationContext,
                                                   Compute<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapReduceToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapReduceToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 
   // Properties
   bool displayImplicitAdditionBetweenUnits(Layout l) const;
@@ -82,14 +82,31 @@ class AliasesList {
     return Iterator<AliasesList>(*this, nullptr);
   }
 
+  /* Returns nullptr if there is no next name. Unlike the iterator, this can be
+   * used to walk the aliases at compile time. */
+  constexpr const char* nextAlias(
+      const char* currentPositionInAliasesList) const {
+    if (!hasMultipleAliases()) {
+      return nullptr;
+    }
+    assert(currentPositionInAliasesList[0] != 0);
+    const char* beginningOfNextAlias = currentPositionInAliasesList;
+    while (*beginningOfNextAlias != 0) {
+      beginningOfNextAlias++;
+    }
+    beginningOfNextAlias++;
+    if (beginningOfNextAlias[0] == 0) {
+      return nullptr;  // End of list
+    }
+    return beginningOfNextAlias;
+  }
+
  private:
   constexpr static char k_listStart = '\01';
 
   constexpr bool hasMultipleAliases() const {
     return m_formattedAliasesList[0] == k_listStart;
   }
-  // Returns nullptr if there is no next name
-  const char* nextAlias(const char* currentPositionInAliasesList) const;
 
   const char* m_formattedAliasesList;
 };
@@ -0,0 +1,29 @@
+#ifndef POINCARE_APPROXIMATION_DISPATCH_H
+#define POINCARE_APPROXIMATION_DISPATCH_H
+
+#include <poincare/expression_node.h>
+
+#include <complex>
+
+namespace Poincare {
+
+/* Approximation to a complex, dispatched with a switch on the type of each
+ * node instead of a virtual call. The nodes met by the apps on their hot paths
+ * (numbers, arithmetic operators and elementary functions) are approximated by
+ * kernels given as template arguments, which the compiler can inline in the
+ * recursion. The other nodes are handed to their virtual approximateToComplex,
+ * and the result is the same as the one of ExpressionNode::approximateToComplex
+ * in every case. */
+
+namespace ApproximationDispatch {
+
+template <typename T>
+bool ApproximateToComplex(const ExpressionNode* e,
+                          const ApproximationContext& approximationContext,
+                          std::complex<T>* result);
+
+}  // namespace ApproximationDispatch
+
+}  // namespace Poincare
+
+#endif
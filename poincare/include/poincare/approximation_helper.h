@@ -125,6 +125,21 @@ Evaluation<T> MapReduce(const ExpressionNode* expression,
                         const ApproximationContext& approximationContext,
                         ReductionFunction<T> reductionFunction);
 
+/* Approximation to a complex held on the stack, see
+ * ExpressionNode::approximateToComplex. These functions return false as soon
+ * as a child does not approximate to a scalar. */
+template <typename T>
+bool ComplexOfEvaluation(Evaluation<T> evaluation, std::complex<T>* result);
+template <typename T>
+bool MapOneChildToComplex(const ExpressionNode* expression,
+                          const ApproximationContext& approximationContext,
+                          ComplexCompute<T> compute, std::complex<T>* result);
+template <typename T>
+bool MapReduceToComplex(const ExpressionNode* expression,
+                        const ApproximationContext& approximationContext,
+                        ComplexAndComplexReduction<T> computeOnComplexes,
+                        std::complex<T>* result);
+
 template <typename T>
 MatrixComplex<T> ElementWiseOnMatrixAndComplex(
     const MatrixComplex<T> n, std::complex<T> c,
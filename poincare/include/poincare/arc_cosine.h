@@ -72,6 +72,16 @@ class ArcCosineNode final : public ExpressionNode {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext,
                                                     computeOnComplex<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 };
 
 class ArcCosine final : public ExpressionOneChild<ArcCosine, ArcCosineNode> {
@@ -10,6 +10,7 @@ namespace Poincare {
 
 class ArcTangentNode final : public ExpressionNode {
   friend class ArcCotangentNode;
+  friend class DerivativeTape;
 
  public:
   constexpr static AliasesList k_functionName = AliasesLists::k_atanAliases;
@@ -72,6 +73,16 @@ class ArcTangentNode final : public ExpressionNode {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext,
                                                     computeOnComplex<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 };
 
 class ArcTangent final : public ExpressionOneChild<ArcTangent, ArcTangentNode> {
@@ -1,6 +1,7 @@
 #ifndef POINCARE_ARITHMETIC_H
 #define POINCARE_ARITHMETIC_H
 
+#include <omg/thread_local.h>
 #include <poincare/approximation_helper.h>
 #include <poincare/integer.h>
 
@@ -71,18 +72,19 @@ class Arithmetic final {
   /* When decomposing an integer into primes factors, we look for its prime
    * factors among integer from 2 to 10000. */
   constexpr static int k_biggestPrimeFactor = 10000;
-  static Arithmetic* s_lock;
+  static OMG_THREAD_LOCAL Arithmetic* s_lock;
   /* The following methods are equivalent to a simple static array declaration
    * in the header and an initialization in the source file. However, as Integer
    * itself rely on static objects, such a declaration could cause a static
    * init order fiasco. Here, the object is created on first use only. */
   static Integer* factors() {
-    static Integer staticFactors[k_maxNumberOfFactors];
+    static OMG_THREAD_LOCAL Integer staticFactors[k_maxNumberOfFactors];
     return staticFactors;
   }
 
   static Integer* coefficients() {
-    static Integer staticCoefficients[k_maxNumberOfFactors];
+    static OMG_THREAD_LOCAL Integer
+        staticCoefficients[k_maxNumberOfFactors];
     return staticCoefficients;
   }
 };
@@ -58,6 +58,16 @@ class BasedIntegerNode final : public NumberNode {
       const ApproximationContext& approximationContext) const override {
     return Complex<double>::Builder(templatedApproximate<double>());
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    *result = ComplexNode<float>::Sanitized(templatedApproximate<float>());
+    return true;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    *result = ComplexNode<double>::Sanitized(templatedApproximate<double>());
+    return true;
+  }
   template <typename T>
   T templatedApproximate() const;
 
@@ -1,6 +1,8 @@
 #ifndef POINCARE_CHECKPOINT_H
 #define POINCARE_CHECKPOINT_H
 
+#include <omg/thread_local.h>
+
 /* Usage:
  *
  * CAUTION : A scope MUST be created directly around the Checkpoint, to ensure
@@ -44,7 +46,7 @@ class Checkpoint {
   virtual void discard() const { protectedDiscard(); }
 
  protected:
-  static Checkpoint *s_topmost;
+  static OMG_THREAD_LOCAL Checkpoint *s_topmost;
 
   void rollback() const;
   void protectedDiscard() const;
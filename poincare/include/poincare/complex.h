@@ -12,6 +12,9 @@ template <typename T>
 class ComplexNode final : public EvaluationNode<T>, public std::complex<T> {
  public:
   static T ToScalar(const std::complex<T> c);
+  /* Value held by a ComplexNode built from c. Also used by the approximation
+   * to a complex, which does not build the nodes. */
+  static std::complex<T> Sanitized(std::complex<T> c);
   ComplexNode(std::complex<T> c);
 
   std::complex<T> complexAtIndex(int index) const override {
@@ -5,9 +5,11 @@
 #include <stdint.h>
 
 #include <cmath>
+#include <complex>
 
 namespace Poincare {
 
+class ApproximationContext;
 class Expression;
 class SymbolAbstract;
 class ContextWithParent;
@@ -30,6 +32,15 @@ class Context {
                                                bool clone);
   virtual bool setExpressionForSymbolAbstract(const Expression& expression,
                                               const SymbolAbstract& symbol) = 0;
+  /* Return true if the scalar approximation of the symbol named name is known
+   * to this context, in which case it is set in value without building the
+   * expression of the symbol in the pool. The value is approximated in single
+   * precision if doublePrecision is false. */
+  virtual bool scalarApproximationForSymbol(
+      const char* name, const ApproximationContext& approximationContext,
+      bool doublePrecision, std::complex<double>* value) {
+    return false;
+  }
   virtual void tidyDownstreamPoolFrom(TreeNode* treePoolCursor = nullptr) {}
   virtual bool canRemoveUnderscoreToUnits() const { return true; }
 
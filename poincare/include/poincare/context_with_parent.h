@@ -14,8 +14,11 @@ class ContextWithParent : public Context {
   // Context
   SymbolAbstractType expressionTypeForIdentifier(const char* identifier,
                                                  int length) override {
-    assert(m_parentContext);
-    return m_parentContext->expressionTypeForIdentifier(identifier, length);
+    /* The jobs of the WorkerPool approximate without the context of the apps,
+     * where no other symbol is defined. */
+    return m_parentContext ? m_parentContext->expressionTypeForIdentifier(
+                                 identifier, length)
+                           : SymbolAbstractType::None;
   }
   bool setExpressionForSymbolAbstract(const Expression& expression,
                                       const SymbolAbstract& symbol) override {
@@ -32,6 +35,7 @@ class ContextWithParent : public Context {
         symbol, clone,
         lastDescendantContext == nullptr ? this : lastDescendantContext);
   }
+  Context* parentContext() const { return m_parentContext; }
 
  private:
   Context* m_parentContext;
@@ -67,6 +67,16 @@ class DecimalNode final : public NumberNode {
       const ApproximationContext& approximationContext) const override {
     return Complex<double>::Builder(templatedApproximate<double>());
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    *result = ComplexNode<float>::Sanitized(templatedApproximate<float>());
+    return true;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    *result = ComplexNode<double>::Sanitized(templatedApproximate<double>());
+    return true;
+  }
 
   // Comparison
   /* Warning: Decimal(mantissa: 1000, exponent: 3) and Decimal(mantissa: 1,
@@ -0,0 +1,98 @@
+#ifndef POINCARE_DERIVATIVE_TAPE_H
+#define POINCARE_DERIVATIVE_TAPE_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* Forward-mode automatic differentiation of a real function of one unknown.
+ * The expression is compiled once into a tape of instructions in postfix
+ * order. The tape is then run on jets, which hold a value with its first and
+ * second derivatives, so that a single run returns f(t), f'(t) and f''(t)
+ * without building nor approximating the symbolic derivatives.
+ *
+ * The values are computed by the same kernels as the approximation of the
+ * nodes. When an intermediate value is not real, the run gives up and the
+ * caller should approximate the expression instead: the approximation may
+ * still be real, through complex intermediate values or real roots. */
+
+class DerivativeTape {
+ public:
+  template <typename T>
+  struct Jet {
+    T value;
+    T firstDerivative;
+    T secondDerivative;
+  };
+
+  DerivativeTape() { reset(); }
+
+  /* Return false if the expression holds a node that the tape does not
+   * handle. The context of approximationContext is only used to approximate
+   * the subexpressions that do not depend on the unknown. */
+  bool compile(const Expression e, const char* unknown,
+               const ApproximationContext& approximationContext);
+  void reset();
+  bool isCompiled() const { return m_status == Status::Compiled; }
+  bool hasFailed() const { return m_status == Status::Failed; }
+  bool isCompiledFor(Preferences::ComplexFormat complexFormat,
+                     Preferences::AngleUnit angleUnit) const {
+    return m_status != Status::NotCompiled &&
+           m_complexFormat == complexFormat && m_angleUnit == angleUnit;
+  }
+
+  // Return false if the caller should approximate the expression instead
+  template <typename T>
+  bool evaluate(T t, Jet<T>* result) const;
+
+ private:
+  constexpr static int k_maxNumberOfInstructions = 64;
+  constexpr static int k_maxNumberOfConstants = 16;
+  constexpr static int k_maxStackDepth = 16;
+
+  enum class Status : uint8_t { NotCompiled, Compiled, Failed };
+
+  enum class Operation : uint8_t {
+    Unknown,
+    Constant,
+    Addition,
+    Subtraction,
+    Multiplication,
+    Division,
+    Opposite,
+    IntegerPower,
+    Power,
+    SquareRoot,
+    NaperianLogarithm,
+    CommonLogarithm,
+    Sine,
+    Cosine,
+    Tangent,
+    ArcTangent,
+    AbsoluteValue,
+  };
+
+  struct Instruction {
+    Operation operation;
+    // Index of a constant, or exponent of an integer power
+    int8_t operand;
+  };
+
+  bool compileNode(const Expression e, const char* unknown,
+                   const ApproximationContext& approximationContext,
+                   int* depth);
+  bool push(Operation operation, int8_t operand = 0);
+
+  Instruction m_instructions[k_maxNumberOfInstructions];
+  double m_constants[k_maxNumberOfConstants];
+  uint8_t m_numberOfInstructions;
+  uint8_t m_numberOfConstants;
+  Status m_status;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+};
+
+}  // namespace Poincare
+
+#endif
@@ -9,6 +9,7 @@ namespace Poincare {
 class Division;
 
 class DivisionNode final : public ExpressionNode {
+  friend class DerivativeTape;
   friend class LogarithmNode;
 
  public:
@@ -57,6 +58,16 @@ class DivisionNode final : public ExpressionNode {
     return ApproximationHelper::MapReduce<double>(this, approximationContext,
                                                   Compute<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapReduceToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapReduceToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 
   // Layout
   bool childNeedsSystemParenthesesAtSerialization(
@@ -499,10 +499,26 @@ class Expression : public TreeHandle {
       const ReductionContext& reductionContext) const;
   template <typename U>
   U approximateToScalar(const ApproximationContext& approximationContext) const;
+  /* Approximate without building an Evaluation tree when the expression is a
+   * scalar. Return false otherwise, for instance on lists and matrices. */
+  template <typename U>
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<U>* result) const;
+  /* Return true if the expression holds a list, a matrix, a point or a symbol
+   * defined as a list, in which case approximateToComplex gives up at once.
+   * Only the types of the nodes and of the symbols are checked. */
+  bool approximationMayNotBeScalar(Context* context) const;
   template <typename U>
   U approximateWithValueForSymbol(
       const char* symbol, U x,
       const ApproximationContext& approximationContext) const;
+  /* Approximate at each of the values, with the workers of the WorkerPool if
+   * the expression only depends on the symbol. The results are the same as
+   * with approximateWithValueForSymbol. */
+  template <typename U>
+  void approximateWithValuesForSymbol(
+      const char* symbol, const U* values, U* results, int numberOfValues,
+      const ApproximationContext& approximationContext) const;
   // This also reduces the expression. Approximation is in double.
   Expression cloneAndApproximateKeepingSymbols(
       ReductionContext reductionContext) const;
@@ -760,6 +776,10 @@ class Expression : public TreeHandle {
   Expression defaultUnaryFunctionDifferential() { return *this; }
 
   /* Approximation */
+  // Approximate to an Evaluation without trying approximateToComplex first
+  template <typename U>
+  Evaluation<U> approximateToEvaluationTree(
+      const ApproximationContext& approximationContext) const;
   Expression deepApproximateKeepingSymbols(ReductionContext reductionContext,
                                            bool* parentCanApproximate,
                                            bool* parentShouldReduce);
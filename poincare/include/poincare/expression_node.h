@@ -251,6 +251,16 @@ class ExpressionNode : public TreeNode {
   virtual Evaluation<double> approximate(
       DoublePrecision p,
       const ApproximationContext& approximationContext) const = 0;
+  /* Approximate to a complex held on the stack, without building the
+   * Evaluation of each node. Return false if the approximation is not a
+   * scalar, in which case approximate has to be used instead. By default, the
+   * node is approximated to an Evaluation. */
+  virtual bool approximateToComplex(
+      const ApproximationContext& approximationContext,
+      std::complex<float>* result) const;
+  virtual bool approximateToComplex(
+      const ApproximationContext& approximationContext,
+      std::complex<double>* result) const;
 
   /* Simplification */
   /*!*/ void deepReduceChildren(const ReductionContext& reductionContext);
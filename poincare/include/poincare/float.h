@@ -83,6 +83,16 @@ class FloatNode final : public NumberNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    *result = ComplexNode<float>::Sanitized(static_cast<float>(m_value));
+    return true;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    *result = ComplexNode<double>::Sanitized(static_cast<double>(m_value));
+    return true;
+  }
 
  private:
   // Simplification
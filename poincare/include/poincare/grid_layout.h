@@ -121,13 +121,20 @@ class GridLayoutNode : public Array, public LayoutNode {
   KDCoordinate gridHeight(KDFont::Size font) const;
   KDCoordinate columnWidth(int column, KDFont::Size font) const;
   KDCoordinate gridWidth(KDFont::Size font) const;
+  // Position of the first entry, which leaves room for brackets or braces
+  virtual KDPoint gridOrigin(KDFont::Size font) { return KDPointZero; }
 
   // LayoutNode
   KDSize computeSize(KDFont::Size font) override;
   KDCoordinate computeBaseline(KDFont::Size font) override;
   KDPoint positionOfChild(LayoutNode *l, KDFont::Size font) override;
+  void positionChildren(KDFont::Size font) override;
 
  private:
+  /* Beyond this number of columns, which is more than an edited 10x10 matrix
+   * has, the children are positioned one by one. */
+  constexpr static int k_maxNumberOfColumnsPositionedAtOnce = 16;
+
   // GridLayoutNode
 
   bool isColumnOrRowEmpty(bool column, int index) const;
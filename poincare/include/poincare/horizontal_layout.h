@@ -73,8 +73,12 @@ class HorizontalLayoutNode final : public LayoutNode {
       return false;
     }
     m_emptyVisibility = state;
-    return numberOfChildren() ==
-           0;  // Return true if empty rectangle is displayed
+    if (numberOfChildren() > 0) {
+      return false;
+    }
+    // The empty rectangle is displayed or hidden
+    invalidSizesPositionsAndBaselinesUpToRoot();
+    return true;
   }
 
   KDCoordinate baselineBetweenIndexes(int leftIndex, int rightIndex,
@@ -93,6 +97,7 @@ class HorizontalLayoutNode final : public LayoutNode {
     return baselineBetweenIndexes(0, numberOfChildren(), font);
   }
   KDPoint positionOfChild(LayoutNode *l, KDFont::Size font) override;
+  void positionChildren(KDFont::Size font) override;
 
   void render(KDContext *ctx, KDPoint p, KDGlyph::Style style) override;
 
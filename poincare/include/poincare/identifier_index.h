@@ -0,0 +1,96 @@
+#ifndef POINCARE_IDENTIFIER_INDEX_H
+#define POINCARE_IDENTIFIER_INDEX_H
+
+#include <assert.h>
+#include <poincare/aliases_list.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* An IdentifierIndex maps a byte of a name, either its first or its last one,
+ * to the byte lengths and to the categories of all the names sharing this
+ * byte. It is built at compile time from the tables of names, so that a
+ * string which is not a name can be discarded with a single lookup instead of
+ * being compared to every entry of these tables.
+ * The index can return categories for a string that is not a name, but it
+ * never misses the category of an actual name.
+ *
+ * Usage:
+
+constexpr static IdentifierIndex<uint8_t> k_index = [] {
+  IdentifierIndex<uint8_t> index(IdentifierIndex<uint8_t>::Key::FirstByte);
+  index.addNames("cos", k_functionCategory);
+  return index;
+}();
+
+if (k_index.categoriesOf(name, length) & k_functionCategory) {
+  // Search name in the function table
+}
+
+*/
+
+template <typename Categories>
+class IdentifierIndex {
+ public:
+  enum class Key : bool { FirstByte, LastByte };
+
+  constexpr IdentifierIndex(Key key)
+      : m_key(key), m_lengths(), m_categories() {}
+
+  /* prefixLengths is a bit mask of the byte lengths of the strings that may
+   * precede the names, bit 0 standing for no prefix at all. Prefixes can only
+   * be indexed by the last byte. */
+  constexpr void addNames(AliasesList aliases, Categories categories,
+                          uint16_t prefixLengths = 1) {
+    assert(prefixLengths == 1 || m_key == Key::LastByte);
+    for (const char* alias = aliases.mainAlias(); alias;
+         alias = aliases.nextAlias(alias)) {
+      int length = 0;
+      while (alias[length] != 0) {
+        length++;
+      }
+      assert(length > 0);
+      int bucket = bucketOf(alias, length);
+      for (int prefixLength = 0; prefixLength < k_numberOfLengthBits;
+           prefixLength++) {
+        if (prefixLengths & (1 << prefixLength)) {
+          m_lengths[bucket] |= LengthBit(length + prefixLength);
+        }
+      }
+      m_categories[bucket] |= categories;
+    }
+  }
+
+  // Categories of the names which may be equal to name
+  Categories categoriesOf(const char* name, size_t length) const {
+    if (length == 0) {
+      return 0;
+    }
+    int bucket = bucketOf(name, length);
+    return (m_lengths[bucket] & LengthBit(length)) ? m_categories[bucket] : 0;
+  }
+
+ private:
+  // All non-ASCII bytes share the last bucket
+  constexpr static int k_numberOfBuckets = 0x80 + 1;
+  // Lengths from k_numberOfLengthBits - 1 onward share the last bit
+  constexpr static int k_numberOfLengthBits = 16;
+
+  constexpr static uint16_t LengthBit(size_t length) {
+    return 1 << (length < k_numberOfLengthBits ? length
+                                               : k_numberOfLengthBits - 1);
+  }
+  constexpr int bucketOf(const char* name, size_t length) const {
+    uint8_t byte = m_key == Key::FirstByte ? name[0] : name[length - 1];
+    return byte < k_numberOfBuckets - 1 ? byte : k_numberOfBuckets - 1;
+  }
+
+  Key m_key;
+  uint16_t m_lengths[k_numberOfBuckets];
+  Categories m_categories[k_numberOfBuckets];
+};
+
+}  // namespace Poincare
+
+#endif
@@ -3,9 +3,44 @@
 
 #include <poincare/parametered_expression.h>
 #include <poincare/symbol.h>
+#include <stdint.h>
 
 namespace Poincare {
 
+/* Panels of the integrals of a function computed while a bound moves, e.g. with
+ * the cursor of the graph. The interval is cut on a grid that does not depend
+ * on the bounds, and the panels of the grid that converged are kept, keyed by
+ * the checksum of the integrand. Moving a bound then only integrates the
+ * panels at the ends of the interval again. */
+class IntegralPanelCache {
+  friend class IntegralNode;
+
+ public:
+  IntegralPanelCache() { reset(); }
+  void reset();
+
+ private:
+  /* Integrals over at most this number of panels use the cache, where each
+   * of their panels has a slot of its own. */
+  constexpr static int k_numberOfPanels = 16;
+  constexpr static int32_t k_noPanel = INT32_MIN;
+
+  struct Panel {
+    // Panel [index * gridStep, (index + 1) * gridStep]
+    int32_t index;
+    double integral;
+    double absoluteError;
+  };
+
+  Panel* panelAtIndex(int32_t index);
+
+  uint32_t m_integrandChecksum;
+  double m_gridStep;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+  Panel m_panels[k_numberOfPanels];
+};
+
 class IntegralNode final : public ParameteredExpressionNode {
  public:
   // TreeNode
@@ -21,6 +56,10 @@ class IntegralNode final : public ParameteredExpressionNode {
   Type type() const override { return Type::Integral; }
   int polynomialDegree(Context* context, const char* symbolName) const override;
 
+  double approximateWithPanelCache(
+      IntegralPanelCache* cache, double gridStep,
+      const ApproximationContext& approximationContext) const;
+
  private:
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode,
@@ -59,6 +98,10 @@ class IntegralNode final : public ParameteredExpressionNode {
   template <typename T>
   static bool DetailedResultIsValid(DetailedResult<T> result);
   constexpr static int k_maxNumberOfIterations = 20;
+  /* Gauss-Kronrod uses a (0,inf) -> (-1,1) like substitution when a bound is
+   * beyond these thresholds to deal with big but finite bounds. */
+  constexpr static double k_leftOpenThreshold = -1000.0;
+  constexpr static double k_rightOpenThreshold = 1000.0;
 #ifdef LAGRANGE_METHOD
   template <typename T>
   T lagrangeGaussQuadrature(
@@ -82,8 +125,16 @@ class IntegralNode final : public ParameteredExpressionNode {
   Expression rewriteIntegrandNear(
       Expression bound, const ReductionContext& reductionContext) const;
   template <typename T>
-  T integrand(T x, Substitution<T> substitution,
-              const ApproximationContext& approximationContext) const;
+  static T SubstitutedArgument(T x, Substitution<T> substitution);
+  template <typename T>
+  static T SubstitutedIntegrand(T x, T value, Substitution<T> substitution);
+  /* Approximate the integrand at each of the abscissae, sharing the context of
+   * the symbol. */
+  template <typename T>
+  void integrands(const T* x, T* values, int numberOfValues,
+                  Substitution<T> substitution,
+                  const ApproximationContext& approximationContext) const;
+  uint32_t integrandChecksum() const;
   template <typename T>
   T integrandNearBound(T x, T xc, AlternativeIntegrand alternativeIntegrand,
                        const ApproximationContext& approximationContext) const;
@@ -124,6 +175,12 @@ class Integral final : public ParameteredExpression {
   // Expression
   void deepReduceChildren(const ReductionContext& reductionContext);
   Expression shallowReduce(ReductionContext reductionContext);
+
+  /* Same approximation as approximateToScalar, within the tolerance of the
+   * quadrature, with the panels of cache on a grid of step gridStep. */
+  double approximateWithPanelCache(
+      IntegralPanelCache* cache, double gridStep,
+      const ApproximationContext& approximationContext) const;
 };
 
 }  // namespace Poincare
@@ -0,0 +1,89 @@
+#ifndef POINCARE_JOB_H
+#define POINCARE_JOB_H
+
+#include <stdint.h>
+
+namespace Poincare {
+
+class TreeNode;
+
+/* A Job is a long computation split into bounded steps, so that it can be
+ * advanced a time slice at a time between two events of the run loop.
+ *
+ * - A step is run under an ExceptionCheckpoint and an AnyKey
+ *   CircuitBreakerCheckpoint. A pool overflow fails the job, and a key press
+ *   interrupts the current step so that the event can be handled right away.
+ * - Since an interrupted step is rolled back and run again later, a step must
+ *   only modify the state of the job once its computation has succeeded, and
+ *   must not keep handles on nodes created during the step.
+ * - Nodes created before the checkpoints are not reference counted during a
+ *   step, so handles held by the job are released in didEnd instead.
+ * - Models that memoized nodes during a rolled back step are tidied in
+ *   didRollBackStep.
+ * - A step can end the current slice, so that the run loop draws before the
+ *   next step, as between the frames of an animation.
+ *
+ * Usage:
+
+class RootsJob : public Job {
+  bool step() override {
+    Solver<double> solver = m_solver;
+    Coordinate2D<double> root = solver.nextRoot(m_expression);
+    // Commit the step
+    m_solver = solver;
+    ...
+  }
+};
+
+while (job.advance(Ion::Timing::millis() + sliceDuration) ==
+       Job::Status::Running) {
+  handleEvents();
+}
+
+*/
+
+class Job {
+ public:
+  enum class Status : uint8_t {
+    Running,
+    Completed,
+    // The pool overflowed during a step
+    Failed,
+    Cancelled,
+  };
+
+  Job() : m_status(Status::Running), m_sliceEnded(false) {}
+
+  Status status() const { return m_status; }
+  bool isRunning() const { return m_status == Status::Running; }
+  /* Run steps until the job is over, the deadline, in milliseconds of
+   * Ion::Timing::millis, has passed or a step has ended the slice. At least
+   * one step is attempted. */
+  Status advance(uint64_t deadline);
+  // Run the slices one after the other, until the job is over or interrupted
+  Status runUntilDone();
+  void cancel();
+  // Fraction of the work already done, in [0, 1]
+  virtual float progress() const = 0;
+
+ protected:
+  // Return true once the last step has been done
+  virtual bool step() = 0;
+  // Called out of the step checkpoints once the job is no longer running
+  virtual void didEnd() {}
+  /* Called once a step has been interrupted or has overflowed the pool, and
+   * the nodes created during the step have been freed. */
+  virtual void didRollBackStep(TreeNode* endOfPoolBeforeStep) {}
+  void endSlice() { m_sliceEnded = true; }
+
+ private:
+  // Return false if the step has been interrupted by a key press
+  bool runStep();
+
+  Status m_status;
+  bool m_sliceEnded;
+};
+
+}  // namespace Poincare
+
+#endif
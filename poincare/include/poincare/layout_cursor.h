@@ -112,6 +112,11 @@ class LayoutCursor final {
 
   bool isAtNumeratorOfEmptyFraction() const;
 
+  /* The layout rebuilt by the editions at the cursor: the top of the
+   * horizontal layouts and autocompleted brackets around it. The editions
+   * only change this layout and the state of its ancestors. */
+  Layout editedLayout() const;
+
   static int RightmostPossibleCursorPosition(Layout l);
 
  private:
@@ -91,6 +91,10 @@ class LayoutNode : public TreeNode {
 
   // TODO: invalid cache when tempering with hierarchy
   virtual void invalidAllSizesPositionsAndBaselines();
+  /* Invalidate the size and baseline of the layout and of its ancestors, and
+   * the positions of their children, after the layout changed in place. The
+   * sizes of the other layouts only depend on their own subtree. */
+  void invalidSizesPositionsAndBaselinesUpToRoot();
   int serialize(char *buffer, int bufferSize,
                 Preferences::PrintFloatMode floatDisplayMode =
                     Preferences::PrintFloatMode::Decimal,
@@ -178,6 +182,12 @@ class LayoutNode : public TreeNode {
   virtual KDSize computeSize(KDFont::Size font) = 0;
   virtual KDCoordinate computeBaseline(KDFont::Size font) = 0;
   virtual KDPoint positionOfChild(LayoutNode *child, KDFont::Size font) = 0;
+  /* Compute the positions of all the children at once, when one of them is
+   * needed. The layouts whose positions depend on the sizes of the previous
+   * children override it to do it in a single pass. */
+  virtual void positionChildren(KDFont::Size font);
+  void setPositionOfChild(LayoutNode *child, KDPoint position,
+                          KDFont::Size font);
 
  private:
   KDPoint absoluteOriginWithMargin(KDFont::Size font);
@@ -185,6 +195,8 @@ class LayoutNode : public TreeNode {
   bool changeGraySquaresOfAllGridRelatives(bool add, bool ancestors,
                                            Layout layoutToExclude);
 
+  /* The origin of m_frame is relative to the origin of the parent, so that it
+   * stays valid as long as the sizes of the parent and of its children do. */
   KDRect m_frame;
   /* m_baseline is the signed vertical distance from the top of the layout to
    * the fraction bar of an hypothetical fraction sibling layout. If the top of
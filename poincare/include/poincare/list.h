@@ -44,6 +44,15 @@ class ListNode : public ExpressionNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  // Lists never approximate to scalars
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return false;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return false;
+  }
 
   // Helper functions
   int extremumIndex(const ApproximationContext& approximationContext,
@@ -66,6 +75,9 @@ class ListNode : public ExpressionNode {
   template <typename T>
   Evaluation<T> templatedApproximate(
       const ApproximationContext& approximationContext, bool keepUndef) const;
+  template <typename T, typename Accumulator, typename Reduction>
+  Evaluation<T> reduceElements(const ApproximationContext& approximationContext,
+                               Reduction reductionFunction) const;
 
   /* See comment on NAryExpressionNode */
   uint16_t m_numberOfChildren;
@@ -77,9 +77,16 @@ class ListComplex final : public Evaluation<T>, public DatasetColumn<T> {
   int length() const override { return numberOfChildren(); }
 
  private:
+  // Size of the buffer of the sort fast path
+  constexpr static int k_maxNumberOfSortedRealValues = 128;
+
   ListComplexNode<T> *node() const {
     return static_cast<ListComplexNode<T> *>(Evaluation<T>::node());
   }
+  /* Sort lists of real numbers on a dense array with std::sort, instead of the
+   * insertion sort which accesses children in linear time. Return false if the
+   * list is too long or has an element which is not real. */
+  bool sortRealValues();
 };
 
 }  // namespace Poincare
@@ -36,6 +36,15 @@ class ListSequenceNode final : public ParameteredExpressionNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  // Sequences of terms never approximate to scalars
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return false;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return false;
+  }
   template <typename T>
   Evaluation<T> templatedApproximate(
       const ApproximationContext& approximationContext) const;
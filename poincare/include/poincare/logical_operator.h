@@ -84,6 +84,8 @@ class LogicalOperatorNot
 // Binary Logical Operator
 
 class BinaryLogicalOperatorNode : public LogicalOperatorNode {
+  friend class ParsingHelper;
+
  public:
   enum class OperatorType : uint8_t {
     And,
@@ -47,6 +47,15 @@ class MatrixNode final : public Array, public ExpressionNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  // Matrices never approximate to scalars
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return false;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return false;
+  }
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode,
@@ -54,6 +54,13 @@ class MatrixComplexNode final : public Array, public EvaluationNode<T> {
   std::complex<T> norm() const;
   std::complex<T> dot(MatrixComplex<T> *e) const;
   Evaluation<T> cross(MatrixComplex<T> *e) const;
+
+  /* Copy the children in a single pass, whereas complexAtIndex walks the
+   * children up to index. Non-complex children are copied as NAN. */
+  void copyOperands(std::complex<T> *operands) const;
+  /* Same with real operands, to run the real kernels which are much cheaper
+   * than the complex ones. Return false if an operand is not real. */
+  bool copyRealOperands(T *operands) const;
 };
 
 template <typename T>
@@ -67,6 +74,8 @@ class MatrixComplex final : public Evaluation<T> {
   }
   static MatrixComplex Builder(std::complex<T> *operands, int numberOfRows,
                                int numberOfColumns);
+  static MatrixComplex Builder(T *operands, int numberOfRows,
+                               int numberOfColumns);
   static MatrixComplex<T> Undefined();
   static MatrixComplex<T> CreateIdentity(int dim);
   std::complex<T> trace() const { return node()->trace(); }
@@ -80,6 +89,9 @@ class MatrixComplex final : public Evaluation<T> {
   std::complex<T> complexAtIndex(int index) const {
     return node()->complexAtIndex(index);
   }
+  bool copyRealOperands(T *operands) const {
+    return node()->copyRealOperands(operands);
+  }
   Array::VectorType vectorType() const { return node()->vectorType(); }
   bool isVector() const { return node()->isVector(); }
   int numberOfRows() const { return node()->numberOfRows(); }
@@ -39,10 +39,10 @@ class MatrixLayoutNode final : public GridLayoutNode {
  private:
   // Grid layout node
   bool isEditing() const override;
+  KDPoint gridOrigin(KDFont::Size font) override;
 
   // LayoutNode
   KDSize computeSize(KDFont::Size font) override;
-  KDPoint positionOfChild(LayoutNode *l, KDFont::Size font) override;
   KDCoordinate computeBaseline(KDFont::Size font) override;
   void render(KDContext *ctx, KDPoint p, KDGlyph::Style style) override;
 };
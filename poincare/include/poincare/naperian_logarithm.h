@@ -7,6 +7,8 @@
 namespace Poincare {
 
 class NaperianLogarithmNode final : public ExpressionNode {
+  friend class DerivativeTape;
+
  public:
   constexpr static AliasesList k_functionName = "ln";
 
@@ -62,6 +64,16 @@ class NaperianLogarithmNode final : public ExpressionNode {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext,
                                                     computeOnComplex<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 };
 
 class NaperianLogarithm final
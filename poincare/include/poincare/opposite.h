@@ -41,9 +41,21 @@ class OppositeNode final : public ExpressionNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return templatedApproximateToComplex<float>(approximationContext, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return templatedApproximateToComplex<double>(approximationContext, result);
+  }
   template <typename T>
   Evaluation<T> templatedApproximate(
       const ApproximationContext& approximationContext) const;
+  template <typename T>
+  bool templatedApproximateToComplex(
+      const ApproximationContext& approximationContext,
+      std::complex<T>* result) const;
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode,
@@ -54,11 +54,23 @@ class ParenthesisNode final : public ExpressionNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return templatedApproximateToComplex<float>(approximationContext, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return templatedApproximateToComplex<double>(approximationContext, result);
+  }
 
  private:
   template <typename T>
   Evaluation<T> templatedApproximate(
       const ApproximationContext& approximationContext) const;
+  template <typename T>
+  bool templatedApproximateToComplex(
+      const ApproximationContext& approximationContext,
+      std::complex<T>* result) const;
 };
 
 class Parenthesis final
@@ -21,6 +21,15 @@ class PointNode : public ExpressionNode {
       DoublePrecision p, const ApproximationContext& context) const override {
     return templatedApproximate<double>(context);
   }
+  // Points never approximate to scalars
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return false;
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return false;
+  }
   LayoutShape leftLayoutShape() const override {
     return LayoutShape::BoundaryPunctuation;
   }
@@ -4,6 +4,8 @@
 #include <poincare/expression.h>
 #include <poincare/rational.h>
 
+#include <complex>
+
 namespace Poincare {
 
 class Polynomial {
@@ -27,8 +29,32 @@ class Polynomial {
                                   bool* approximateSolutions = nullptr,
                                   bool beautifyRoots = true);
 
+  /* Approximation of all the complex roots of a polynomial of any degree, for
+   * equations beyond the reach of the exact methods. */
+  constexpr static int k_maxApproximateDegree = 32;
+  /* Approximate the coefficients of e, a polynomial of the given degree in
+   * symbol, from its values on a circle scaled to the moduli of its roots.
+   * The coefficients are ordered by increasing degree. Return false if one of
+   * the values is undefined. */
+  static bool ApproximateCoefficients(
+      const Expression e, const char* symbol, int degree,
+      const ApproximationContext& approximationContext,
+      std::complex<double>* coefficients);
+  /* Approximate the roots of the polynomial of given coefficients at once with
+   * the Aberth-Ehrlich method. Roots are listed with their multiplicity.
+   * Return the number of roots, which is 0 if the method diverged. */
+  static int ApproximateRoots(const std::complex<double>* coefficients,
+                              int degree, std::complex<double>* roots);
+
  private:
+  constexpr static int k_maxNumberOfAberthIterations = 100;
   constexpr static int k_maxNumberOfNodesBeforeApproximatingDelta = 16;
+  /* Approximate the coefficients of e from its values at the roots of unity
+   * scaled by radius. */
+  static bool ApproximateCoefficientsOnCircle(
+      const Expression e, const char* symbol, int degree, double radius,
+      const ApproximationContext& approximationContext,
+      std::complex<double>* coefficients);
   static Expression ReducePolynomial(const Expression* coefficients, int degree,
                                      Expression parameter,
                                      const ReductionContext& reductionContext);
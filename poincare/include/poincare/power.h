@@ -99,6 +99,18 @@ class PowerNode final : public ExpressionNode {
   template <typename T>
   Evaluation<T> templatedApproximate(
       const ApproximationContext& approximationContext) const;
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return templatedApproximateToComplex<float>(approximationContext, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return templatedApproximateToComplex<double>(approximationContext, result);
+  }
+  template <typename T>
+  bool templatedApproximateToComplex(
+      const ApproximationContext& approximationContext,
+      std::complex<T>* result) const;
 };
 
 class Power final : public ExpressionTwoChildren<Power, PowerNode> {
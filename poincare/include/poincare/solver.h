@@ -2,6 +2,7 @@
 #define POINCARE_SOLVER_H
 
 #include <math.h>
+#include <poincare/derivative_tape.h>
 #include <poincare/expression.h>
 #include <poincare/float.h>
 
@@ -91,11 +92,13 @@ class Solver {
   }
 
   /* These methods will return the solution in ]xStart,xEnd[ (or ]xEnd,xStart[)
-   * closest to xStart, or NAN if it does not exist. */
+   * closest to xStart, or NAN if it does not exist. The derivativeTape given
+   * to next must be the one of f. */
   Coordinate2D<T> next(const Expression &e, BracketTest test, HoneResult hone);
   Coordinate2D<T> next(FunctionEvaluation f, const void *aux, BracketTest test,
                        HoneResult hone,
-                       DiscontinuityEvaluation discontinuityTest = nullptr);
+                       DiscontinuityEvaluation discontinuityTest = nullptr,
+                       const DerivativeTape *derivativeTape = nullptr);
   Coordinate2D<T> nextRoot(const Expression &e);
   Coordinate2D<T> nextRoot(FunctionEvaluation f, const void *aux) {
     return next(f, aux, EvenOrOddRootInBracket, CompositeBrentForRoot);
@@ -115,6 +118,12 @@ class Solver {
   void stretch();
   void setSearchStep(T step) { m_maximalXStep = step; }
   void setGrowthSpeed(GrowthSpeed speed) { m_growthSpeed = speed; }
+  /* The tape of e is used to hone the roots and extrema of e with Newton's
+   * method, instead of Brent's methods which only evaluate the function. */
+  void setDerivativeTape(const DerivativeTape *tape, const Expression &e) {
+    m_derivativeTape = tape;
+    m_derivativeTapeExpression = e;
+  }
 
  private:
   struct FunctionEvaluationParameters {
@@ -144,6 +153,11 @@ class Solver {
                                                Interest interest, T precision,
                                                TrinaryBoolean discontinuous);
 
+  /* Safeguarded Newton's method on f for roots, and on f' for extrema. Return
+   * NAN if the tape cannot be used on the interval. */
+  static Coordinate2D<T> NewtonHone(FunctionEvaluation f, const void *aux,
+                                    const DerivativeTape *tape, T xMin, T xMax,
+                                    Interest interest, T precision);
   static bool DiscontinuityTestForExpression(T x1, T x2, const void *aux);
   static void ExcludeUndefinedFromBracket(Coordinate2D<T> *p1,
                                           Coordinate2D<T> *p2,
@@ -166,7 +180,9 @@ class Solver {
   Coordinate2D<T> nextRootInAddition(const Expression &m) const;
   Coordinate2D<T> honeAndRoundSolution(
       FunctionEvaluation f, const void *aux, T start, T end, Interest interest,
-      HoneResult hone, DiscontinuityEvaluation discontinuityTest);
+      BracketTest test, HoneResult hone,
+      DiscontinuityEvaluation discontinuityTest,
+      const DerivativeTape *derivativeTape);
   void registerSolution(Coordinate2D<T> solution, Interest interest);
 
   T m_xStart;
@@ -179,6 +195,8 @@ class Solver {
   Preferences::AngleUnit m_angleUnit;
   Interest m_lastInterest;
   GrowthSpeed m_growthSpeed;
+  const DerivativeTape *m_derivativeTape;
+  Expression m_derivativeTapeExpression;
 };
 
 }  // namespace Poincare
@@ -0,0 +1,41 @@
+#ifndef POINCARE_SOLVER_JOB_H
+#define POINCARE_SOLVER_JOB_H
+
+#include <poincare/job.h>
+#include <poincare/solver.h>
+
+namespace Poincare {
+
+/* Find the successive solutions of an expression, one solution per step, so
+ * that a search on a wide interval does not block the run loop. */
+
+class SolverJob : public Job {
+ public:
+  typedef Coordinate2D<double> (Solver<double>::*NextSolution)(
+      const Expression &e);
+
+  SolverJob(Solver<double> solver, const Expression &e, NextSolution next,
+            Coordinate2D<double> *solutions, int maxNumberOfSolutions);
+
+  int numberOfSolutions() const { return m_numberOfSolutions; }
+  // Whether the search was stopped by maxNumberOfSolutions
+  bool hasMoreSolutions() const { return m_hasMoreSolutions; }
+  float progress() const override;
+
+ private:
+  bool step() override;
+  void didEnd() override { m_expression = Expression(); }
+
+  Solver<double> m_solver;
+  Expression m_expression;
+  NextSolution m_next;
+  Coordinate2D<double> *m_solutions;
+  double m_initialStart;
+  int m_maxNumberOfSolutions;
+  int m_numberOfSolutions;
+  bool m_hasMoreSolutions;
+};
+
+}  // namespace Poincare
+
+#endif
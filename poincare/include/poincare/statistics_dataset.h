@@ -43,7 +43,7 @@ class StatisticsDataset {
  public:
   static StatisticsDataset<T> BuildFromChildren(
       const ExpressionNode* e, const ApproximationContext& approximationContext,
-      ListComplex<T> evaluationArray[]);
+      FloatList<T> evaluationArray[]);
 
   StatisticsDataset(const DatasetColumn<T>* values,
                     const DatasetColumn<T>* weights, bool lnOfValues = false,
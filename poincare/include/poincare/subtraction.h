@@ -58,6 +58,16 @@ class SubtractionNode final : public ExpressionNode {
     return ApproximationHelper::MapReduce<double>(this, approximationContext,
                                                   Compute<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapReduceToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapReduceToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 
   /* Layout */
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode,
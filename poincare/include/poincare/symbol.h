@@ -59,14 +59,31 @@ class SymbolNode final : public SymbolAbstractNode {
       const ApproximationContext& approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return templatedApproximateToComplex<float>(approximationContext, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return templatedApproximateToComplex<double>(approximationContext, result);
+  }
 
   bool isUnknown() const;
 
  private:
   size_t nodeSize() const override { return sizeof(SymbolNode); }
+  // Value cached by the context, if any
+  template <typename T>
+  bool scalarApproximationFromContext(
+      const ApproximationContext& approximationContext,
+      std::complex<T>* result) const;
   template <typename T>
   Evaluation<T> templatedApproximate(
       const ApproximationContext& approximationContext) const;
+  template <typename T>
+  bool templatedApproximateToComplex(
+      const ApproximationContext& approximationContext,
+      std::complex<T>* result) const;
 };
 
 class Symbol final : public SymbolAbstract {
@@ -7,6 +7,8 @@
 namespace Poincare {
 
 class TangentNode final : public ExpressionNode {
+  friend class DerivativeTape;
+
  public:
   constexpr static AliasesList k_functionName = "tan";
 
@@ -61,6 +63,16 @@ class TangentNode final : public ExpressionNode {
     return ApproximationHelper::MapOneChild<double>(this, approximationContext,
                                                     computeOnComplex<double>);
   }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<float>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<float>(
+        this, approximationContext, computeOnComplex<float>, result);
+  }
+  bool approximateToComplex(const ApproximationContext& approximationContext,
+                            std::complex<double>* result) const override {
+    return ApproximationHelper::MapOneChildToComplex<double>(
+        this, approximationContext, computeOnComplex<double>, result);
+  }
 };
 
 class Tangent final : public ExpressionOneChild<Tangent, TangentNode> {
@@ -1,6 +1,7 @@
 #ifndef POINCARE_TREE_POOL_H
 #define POINCARE_TREE_POOL_H
 
+#include <omg/thread_local.h>
 #include <poincare/ghost_node.h>
 #include <stddef.h>
 #include <string.h>
@@ -22,7 +23,7 @@ class TreePool final {
   friend class Checkpoint;
 
  public:
-  static OMG::GlobalBox<TreePool> sharedPool
+  static OMG_THREAD_LOCAL OMG::GlobalBox<TreePool> sharedPool
 #if PLATFORM_DEVICE
       __attribute__((section(".bss.$poincare_pool")))
 #endif
@@ -84,7 +85,7 @@ class TreePool final {
   constexpr static int MaxNumberOfNodes = BufferSize / sizeof(TreeNode);
   constexpr static int k_maxNodeOffset = BufferSize / ByteAlignment;
 #if ASSERTIONS
-  static bool s_treePoolLocked;
+  static OMG_THREAD_LOCAL bool s_treePoolLocked;
 #endif
 
   // TreeNode
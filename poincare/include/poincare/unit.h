@@ -4,6 +4,7 @@
 #include <poincare/aliases_list.h>
 #include <poincare/expression.h>
 #include <poincare/helpers.h>
+#include <poincare/identifier_index.h>
 
 #include <array>
 
@@ -1653,6 +1654,14 @@ class Unit : public Expression {
   }
 
  private:
+  /* Root symbols are indexed by their last byte, since they can be preceded
+   * by a prefix. Each category is a dimension, numbered as in
+   * Representative::DefaultRepresentatives. */
+  typedef IdentifierIndex<uint32_t> SymbolIndex;
+  static_assert(Representative::k_numberOfDimensions <= 32,
+                "The dimensions do not fit in the SymbolIndex categories");
+  static const SymbolIndex s_symbolIndex;
+
   UnitNode* node() const { return static_cast<UnitNode*>(Expression::node()); }
   Expression removeUnit(Expression* unit);
 };
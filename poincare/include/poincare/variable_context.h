@@ -25,6 +25,9 @@ class VariableContext : public ContextWithParent {
                                                  int length) override;
   bool setExpressionForSymbolAbstract(const Expression& expression,
                                       const SymbolAbstract& symbol) override;
+  bool scalarApproximationForSymbol(
+      const char* name, const ApproximationContext& approximationContext,
+      bool doublePrecision, std::complex<double>* value) override;
 
  protected:
   const Expression protectedExpressionForSymbolAbstract(
@@ -0,0 +1,39 @@
+#ifndef POINCARE_WORKER_POOL_H
+#define POINCARE_WORKER_POOL_H
+
+/* The state of Poincare that is modified while approximating or reducing an
+ * expression is thread local, so that each worker of the WorkerPool has its
+ * own TreePool and its own checkpoints. */
+#if POINCARE_WORKER_POOL && !OMG_THREAD_LOCAL_GLOBALS
+#error "The worker pool needs OMG_THREAD_LOCAL_GLOBALS"
+#endif
+
+namespace Poincare {
+
+/* Pool of threads for embarrassingly parallel work, only compiled in on the
+ * simulators that have host threads. Elsewhere, the jobs run one after the
+ * other on the calling thread, so that callers do not depend on the platform.
+ * The workers are shared by all the sessions of the process.
+ *
+ * A job runs on a worker with an empty TreePool and the Preferences of the
+ * calling thread: it cannot use the handles of the calling thread, nor the
+ * Context, the Storage or any other state of the apps. It can rebuild an
+ * expression in its own pool from the address of the nodes in the pool of the
+ * calling thread, which does not change while Run waits for the jobs to
+ * finish. Each job should write its result in a slot of its own, so that the
+ * results do not depend on the order the jobs ran in. */
+
+class WorkerPool {
+ public:
+  typedef void (*Job)(int index, void* context);
+
+  // Run job(i, context) for every i in [0, numberOfJobs) and wait for them
+  static void Run(int numberOfJobs, Job job, void* context);
+  static int NumberOfWorkers();
+
+  constexpr static int k_maxNumberOfWorkers = 8;
+};
+
+}  // namespace Poincare
+
+#endif
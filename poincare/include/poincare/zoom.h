@@ -176,7 +176,8 @@ class Zoom {
   Context *m_context;
   float m_defaultHalfLength;
   float m_normalRatio;
-  const float m_maxFloat;
+  // Not const, so that a Zoom can be carried by the steps of a job
+  float m_maxFloat;
 };
 
 }  // namespace Poincare
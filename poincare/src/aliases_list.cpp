@@ -24,18 +24,4 @@ int AliasesList::maxDifferenceWith(const char* alias, int aliasLen) const {
   return maxValueOfComparison;
 }
 
-const char* AliasesList::nextAlias(
-    const char* currentPositionInAliasesList) const {
-  if (!hasMultipleAliases()) {
-    return nullptr;
-  }
-  assert(strlen(currentPositionInAliasesList) != 0);
-  const char* beginningOfNextAlias =
-      currentPositionInAliasesList + strlen(currentPositionInAliasesList) + 1;
-  if (beginningOfNextAlias[0] == 0) {
-    return nullptr;  // End of list
-  }
-  return beginningOfNextAlias;
-}
-
 }  // namespace Poincare
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include <assert.h>
+#include <poincare/absolute_value.h>
+#include <poincare/addition.h>
+#include <poincare/approximation_dispatch.h>
+#include <poincare/approximation_helper.h>
+#include <poincare/arc_cosine.h>
+#include <poincare/arc_sine.h>
+#include <poincare/arc_tangent.h>
+#include <poincare/based_integer.h>
+#include <poincare/complex.h>
+#include <poincare/complex_argument.h>
+#include <poincare/conjugate.h>
+#include <poincare/cosine.h>
+#include <poincare/decimal.h>
+#include <poincare/division.h>
+#include <poincare/float.h>
+#include <poincare/imaginary_part.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
+#include <poincare/real_part.h>
+#include <poincare/sine.h>
+#include <poincare/square_root.h>
+#include <poincare/subtraction.h>
+#include <poincare/tangent.h>
+
+namespace Poincare {
+
+namespace ApproximationDispatch {
+
+/* The kernels below follow the steps of their virtual counterparts in
+ * ApproximationHelper and in the nodes. They differ in the way they reach the
+ * children: Approximate returns the node following the subtree it has
+ * approximated, which is the next child of its parent. The virtual path finds
+ * it with nextSibling, which walks the whole subtree again.
+ * Approximate returns nullptr if the subtree is not a scalar. */
+
+using Node = const ExpressionNode*;
+
+template <typename T>
+static Node Approximate(Node e,
+                        const ApproximationContext& approximationContext,
+                        std::complex<T>* result);
+
+static Node Next(const TreeNode* e) { return static_cast<Node>(e->next()); }
+
+static Node NextSibling(const TreeNode* e) {
+  return static_cast<Node>(e->nextSibling());
+}
+
+template <typename T>
+static Node Virtual(Node e, const ApproximationContext& approximationContext,
+                    std::complex<T>* result) {
+  return e->approximateToComplex(approximationContext, result) ? NextSibling(e)
+                                                               : nullptr;
+}
+
+template <typename T, typename NumberNode>
+static Node Number(Node e, const ApproximationContext& approximationContext,
+                   std::complex<T>* result) {
+  // NumberNode is final, so that the qualified call is not virtual
+  static_cast<const NumberNode*>(e)->NumberNode::approximateToComplex(
+      approximationContext, result);
+  return Next(e);
+}
+
+template <typename T, ApproximationHelper::ComplexCompute<T> Compute>
+static Node MapOneChild(Node e,
+                        const ApproximationContext& approximationContext,
+                        std::complex<T>* result) {
+  assert(e->numberOfChildren() == 1);
+  std::complex<T> c;
+  Node end = Approximate<T>(Next(e), approximationContext, &c);
+  if (end) {
+    *result = ComplexNode<T>::Sanitized(
+        Compute(c, approximationContext.complexFormat(),
+                approximationContext.angleUnit()));
+  }
+  return end;
+}
+
+template <typename T,
+          ApproximationHelper::ComplexAndComplexReduction<T> Compute>
+static Node MapReduce(Node e, const ApproximationContext& approximationContext,
+                      std::complex<T>* result) {
+  int childrenNumber = e->numberOfChildren();
+  assert(childrenNumber > 0);
+  std::complex<T> c;
+  Node child = Next(e);
+  for (int i = 0; i < childrenNumber; i++) {
+    std::complex<T> childComplex;
+    Node nextChild =
+        Approximate<T>(child, approximationContext, &childComplex);
+    if (!nextChild) {
+      return nullptr;
+    }
+    c = i == 0 ? childComplex
+               : ComplexNode<T>::Sanitized(Compute(
+                     c, childComplex, approximationContext.complexFormat()));
+    if (std::isnan(c.real()) || std::isnan(c.imag())) {
+      *result = complexNAN<T>();
+      return NextSibling(e);
+    }
+    child = nextChild;
+  }
+  *result = c;
+  return child;
+}
+
+template <typename T>
+static Node Opposite(Node e, const ApproximationContext& approximationContext,
+                     std::complex<T>* result) {
+  std::complex<T> c;
+  Node end = Approximate<T>(Next(e), approximationContext, &c);
+  if (end) {
+    *result = ComplexNode<T>::Sanitized(MultiplicationNode::computeOnComplex<T>(
+        -1, c, approximationContext.complexFormat()));
+  }
+  return end;
+}
+
+template <typename T>
+static Node Power(Node e, const ApproximationContext& approximationContext,
+                  std::complex<T>* result) {
+  if (approximationContext.complexFormat() ==
+      Preferences::ComplexFormat::Real) {
+    // The real roots of c^(p/q) are handled by the node
+    return Virtual<T>(e, approximationContext, result);
+  }
+  std::complex<T> base, index;
+  Node indexNode = Approximate<T>(Next(e), approximationContext, &base);
+  Node end = indexNode
+                 ? Approximate<T>(indexNode, approximationContext, &index)
+                 : nullptr;
+  if (end) {
+    std::complex<T> c =
+        ComplexNode<T>::Sanitized(PowerNode::computeOnComplex<T>(
+            base, index, approximationContext.complexFormat()));
+    *result =
+        std::isnan(c.real()) || std::isnan(c.imag()) ? complexNAN<T>() : c;
+  }
+  return end;
+}
+
+template <typename T>
+static Node Approximate(Node e,
+                        const ApproximationContext& approximationContext,
+                        std::complex<T>* result) {
+  using Type = ExpressionNode::Type;
+  switch (e->type()) {
+    case Type::Rational:
+      return Number<T, RationalNode>(e, approximationContext, result);
+    case Type::BasedInteger:
+      return Number<T, BasedIntegerNode>(e, approximationContext, result);
+    case Type::Decimal:
+      return Number<T, DecimalNode>(e, approximationContext, result);
+    case Type::Float:
+      return Number<T, FloatNode<float>>(e, approximationContext, result);
+    case Type::Double:
+      return Number<T, FloatNode<double>>(e, approximationContext, result);
+    case Type::Addition:
+      return MapReduce<T, AdditionNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Subtraction:
+      return MapReduce<T, SubtractionNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Multiplication:
+      return MapReduce<T, MultiplicationNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Division:
+      return MapReduce<T, DivisionNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Power:
+      return Power<T>(e, approximationContext, result);
+    case Type::Opposite:
+      return Opposite<T>(e, approximationContext, result);
+    case Type::Parenthesis:
+      return Approximate<T>(Next(e), approximationContext, result);
+    case Type::Sine:
+      return MapOneChild<T, SineNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Cosine:
+      return MapOneChild<T, CosineNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Tangent:
+      return MapOneChild<T, TangentNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::ArcSine:
+      return MapOneChild<T, ArcSineNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::ArcCosine:
+      return MapOneChild<T, ArcCosineNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::ArcTangent:
+      return MapOneChild<T, ArcTangentNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::SquareRoot:
+      return MapOneChild<T, SquareRootNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::NaperianLogarithm:
+      return MapOneChild<T, NaperianLogarithmNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::AbsoluteValue:
+      return MapOneChild<T, AbsoluteValueNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::ComplexArgument:
+      return MapOneChild<T, ComplexArgumentNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::Conjugate:
+      return MapOneChild<T, ConjugateNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::ImaginaryPart:
+      return MapOneChild<T, ImaginaryPartNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    case Type::RealPart:
+      return MapOneChild<T, RealPartNode::computeOnComplex<T>>(
+          e, approximationContext, result);
+    default:
+      return Virtual<T>(e, approximationContext, result);
+  }
+}
+
+template <typename T>
+bool ApproximateToComplex(const ExpressionNode* e,
+                          const ApproximationContext& approximationContext,
+                          std::complex<T>* result) {
+  return Approximate<T>(e, approximationContext, result) != nullptr;
+}
+
+template bool ApproximateToComplex<float>(const ExpressionNode*,
+                                          const ApproximationContext&,
+                                          std::complex<float>*);
+template bool ApproximateToComplex<double>(const ExpressionNode*,
+                                           const ApproximationContext&,
+                                           std::complex<double>*);
+
+}  // namespace ApproximationDispatch
+
+}  // namespace Poincare
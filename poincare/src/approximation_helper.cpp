@@ -380,6 +380,62 @@ Evaluation<T> ApproximationHelper::MapReduce(
   return result;
 }
 
+template <typename T>
+bool ApproximationHelper::ComplexOfEvaluation(Evaluation<T> evaluation,
+                                              std::complex<T> *result) {
+  if (evaluation.type() != EvaluationNode<T>::Type::Complex) {
+    return false;
+  }
+  *result = evaluation.complexAtIndex(0);
+  return true;
+}
+
+template <typename T>
+bool ApproximationHelper::MapOneChildToComplex(
+    const ExpressionNode *expression,
+    const ApproximationContext &approximationContext, ComplexCompute<T> compute,
+    std::complex<T> *result) {
+  assert(expression->numberOfChildren() == 1);
+  std::complex<T> c;
+  if (!expression->childAtIndex(0)->approximateToComplex(approximationContext,
+                                                         &c)) {
+    return false;
+  }
+  *result = ComplexNode<T>::Sanitized(compute(
+      c, approximationContext.complexFormat(), approximationContext.angleUnit()));
+  return true;
+}
+
+template <typename T>
+bool ApproximationHelper::MapReduceToComplex(
+    const ExpressionNode *expression,
+    const ApproximationContext &approximationContext,
+    ComplexAndComplexReduction<T> computeOnComplexes, std::complex<T> *result) {
+  // Same steps as MapReduce
+  int childrenNumber = expression->numberOfChildren();
+  assert(childrenNumber > 0);
+  std::complex<T> c;
+  ExpressionNode *child = expression->childAtIndex(0);
+  for (int i = 0; i < childrenNumber; i++) {
+    if (i > 0) {
+      child = static_cast<ExpressionNode *>(child->nextSibling());
+    }
+    std::complex<T> childComplex;
+    if (!child->approximateToComplex(approximationContext, &childComplex)) {
+      return false;
+    }
+    c = i == 0 ? childComplex
+               : ComplexNode<T>::Sanitized(computeOnComplexes(
+                     c, childComplex, approximationContext.complexFormat()));
+    if (std::isnan(c.real()) || std::isnan(c.imag())) {
+      *result = complexNAN<T>();
+      return true;
+    }
+  }
+  *result = c;
+  return true;
+}
+
 template <typename T>
 MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrixAndComplex(
     const MatrixComplex<T> m, const std::complex<T> c,
@@ -476,6 +532,27 @@ Poincare::ApproximationHelper::MapReduce<double>(
     const ApproximationContext &approximationContext,
     Poincare::ApproximationHelper::ReductionFunction<double> reductionFunction);
 
+template bool Poincare::ApproximationHelper::ComplexOfEvaluation<float>(
+    Poincare::Evaluation<float>, std::complex<float> *);
+template bool Poincare::ApproximationHelper::ComplexOfEvaluation<double>(
+    Poincare::Evaluation<double>, std::complex<double> *);
+template bool Poincare::ApproximationHelper::MapOneChildToComplex<float>(
+    const Poincare::ExpressionNode *, const ApproximationContext &,
+    Poincare::ApproximationHelper::ComplexCompute<float>,
+    std::complex<float> *);
+template bool Poincare::ApproximationHelper::MapOneChildToComplex<double>(
+    const Poincare::ExpressionNode *, const ApproximationContext &,
+    Poincare::ApproximationHelper::ComplexCompute<double>,
+    std::complex<double> *);
+template bool Poincare::ApproximationHelper::MapReduceToComplex<float>(
+    const Poincare::ExpressionNode *, const ApproximationContext &,
+    Poincare::ApproximationHelper::ComplexAndComplexReduction<float>,
+    std::complex<float> *);
+template bool Poincare::ApproximationHelper::MapReduceToComplex<double>(
+    const Poincare::ExpressionNode *, const ApproximationContext &,
+    Poincare::ApproximationHelper::ComplexAndComplexReduction<double>,
+    std::complex<double> *);
+
 template Poincare::MatrixComplex<float>
 Poincare::ApproximationHelper::ElementWiseOnMatrixAndComplex<float>(
     const Poincare::MatrixComplex<float>, const std::complex<float>,
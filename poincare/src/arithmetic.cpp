@@ -8,7 +8,7 @@
 
 namespace Poincare {
 
-Arithmetic* Arithmetic::s_lock = nullptr;
+OMG_THREAD_LOCAL Arithmetic* Arithmetic::s_lock = nullptr;
 
 Integer Arithmetic::GCD(const Integer& a, const Integer& b) {
   if (a.isOverflow() || b.isOverflow()) {
@@ -23,19 +23,23 @@ extern "C" {
 namespace Poincare {
 
 template <typename T>
-ComplexNode<T>::ComplexNode(std::complex<T> c)
-    : EvaluationNode<T>(), std::complex<T>(c.real(), c.imag()) {
+std::complex<T> ComplexNode<T>::Sanitized(std::complex<T> c) {
   if (!std::isnan(c.imag()) && c.imag() != static_cast<T>(0.0)) {
     Expression::SetEncounteredComplex(true);
   }
-  if (this->real() == -0) {
-    this->real(0);
+  if (c.real() == -0) {
+    c.real(0);
   }
-  if (this->imag() == -0) {
-    this->imag(0);
+  if (c.imag() == -0) {
+    c.imag(0);
   }
+  return c;
 }
 
+template <typename T>
+ComplexNode<T>::ComplexNode(std::complex<T> c)
+    : EvaluationNode<T>(), std::complex<T>(Sanitized(c)) {}
+
 template <typename T>
 T ComplexNode<T>::ToScalar(const std::complex<T> c) {
   return c.imag() == static_cast<T>(0.0) ? c.real() : NAN;
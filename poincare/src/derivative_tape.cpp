@@ -0,0 +1,400 @@
+#include <assert.h>
+#include <poincare/absolute_value.h>
+#include <poincare/addition.h>
+#include <poincare/arc_tangent.h>
+#include <poincare/complex.h>
+#include <poincare/cosine.h>
+#include <poincare/derivative_tape.h>
+#include <poincare/division.h>
+#include <poincare/logarithm.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
+#include <poincare/power.h>
+#include <poincare/sine.h>
+#include <poincare/square_root.h>
+#include <poincare/subtraction.h>
+#include <poincare/symbol.h>
+#include <poincare/tangent.h>
+#include <poincare/trigonometry.h>
+#include <string.h>
+
+namespace Poincare {
+
+void DerivativeTape::reset() {
+  m_numberOfInstructions = 0;
+  m_numberOfConstants = 0;
+  m_status = Status::NotCompiled;
+  m_complexFormat = Preferences::ComplexFormat::Real;
+  m_angleUnit = Preferences::AngleUnit::Radian;
+}
+
+bool DerivativeTape::compile(const Expression e, const char* unknown,
+                             const ApproximationContext& approximationContext) {
+  reset();
+  m_complexFormat = approximationContext.complexFormat();
+  m_angleUnit = approximationContext.angleUnit();
+  int depth = 0;
+  bool success = !e.recursivelyMatches(Expression::IsRandom) &&
+                 compileNode(e, unknown, approximationContext, &depth);
+  assert(!success || depth == 1);
+  m_status = success ? Status::Compiled : Status::Failed;
+  return success;
+}
+
+bool DerivativeTape::push(Operation operation, int8_t operand) {
+  if (m_numberOfInstructions >= k_maxNumberOfInstructions) {
+    return false;
+  }
+  m_instructions[m_numberOfInstructions++] = {operation, operand};
+  return true;
+}
+
+static bool IsUnknown(const Expression e, Context* context, void* unknown) {
+  return e.type() == ExpressionNode::Type::Symbol &&
+         strcmp(static_cast<const Symbol&>(e).name(),
+                static_cast<const char*>(unknown)) == 0;
+}
+
+static bool DependsOn(const Expression e, const char* unknown) {
+  return e.recursivelyMatches(IsUnknown, nullptr,
+                              SymbolicComputation::DoNotReplaceAnySymbol,
+                              const_cast<char*>(unknown));
+}
+
+bool DerivativeTape::compileNode(
+    const Expression e, const char* unknown,
+    const ApproximationContext& approximationContext, int* depth) {
+  using Type = ExpressionNode::Type;
+  if (!DependsOn(e, unknown)) {
+    double value = e.approximateToScalar<double>(approximationContext);
+    if (std::isnan(value) || m_numberOfConstants >= k_maxNumberOfConstants ||
+        *depth >= k_maxStackDepth) {
+      return false;
+    }
+    m_constants[m_numberOfConstants] = value;
+    (*depth)++;
+    return push(Operation::Constant, m_numberOfConstants++);
+  }
+  Type type = e.type();
+  if (type == Type::Symbol) {
+    if (*depth >= k_maxStackDepth) {
+      return false;
+    }
+    (*depth)++;
+    return push(Operation::Unknown);
+  }
+  if (type == Type::Parenthesis) {
+    return compileNode(e.childAtIndex(0), unknown, approximationContext, depth);
+  }
+  if (type == Type::Power && !DependsOn(e.childAtIndex(1), unknown)) {
+    /* Integer exponents get their own instruction, which is defined for
+     * negative bases. */
+    double exponent =
+        e.childAtIndex(1).approximateToScalar<double>(approximationContext);
+    if (exponent == std::round(exponent) && std::fabs(exponent) <= INT8_MAX) {
+      return compileNode(e.childAtIndex(0), unknown, approximationContext,
+                         depth) &&
+             push(Operation::IntegerPower, static_cast<int8_t>(exponent));
+    }
+  }
+
+  Operation operation;
+  switch (type) {
+    case Type::Addition:
+      operation = Operation::Addition;
+      break;
+    case Type::Subtraction:
+      operation = Operation::Subtraction;
+      break;
+    case Type::Multiplication:
+      operation = Operation::Multiplication;
+      break;
+    case Type::Division:
+      operation = Operation::Division;
+      break;
+    case Type::Power:
+      operation = Operation::Power;
+      break;
+    case Type::Opposite:
+      operation = Operation::Opposite;
+      break;
+    case Type::SquareRoot:
+      operation = Operation::SquareRoot;
+      break;
+    case Type::NaperianLogarithm:
+      operation = Operation::NaperianLogarithm;
+      break;
+    case Type::Logarithm:
+      if (e.numberOfChildren() != 1) {
+        return false;
+      }
+      operation = Operation::CommonLogarithm;
+      break;
+    case Type::Sine:
+      operation = Operation::Sine;
+      break;
+    case Type::Cosine:
+      operation = Operation::Cosine;
+      break;
+    case Type::Tangent:
+      operation = Operation::Tangent;
+      break;
+    case Type::ArcTangent:
+      operation = Operation::ArcTangent;
+      break;
+    case Type::AbsoluteValue:
+      operation = Operation::AbsoluteValue;
+      break;
+    default:
+      return false;
+  }
+  // n-ary operators are written as n-1 binary instructions
+  int numberOfChildren = e.numberOfChildren();
+  for (int i = 0; i < numberOfChildren; i++) {
+    if (!compileNode(e.childAtIndex(i), unknown, approximationContext,
+                     depth) ||
+        (i > 0 && !push(operation))) {
+      return false;
+    }
+    if (i > 0) {
+      (*depth)--;
+    }
+  }
+  return numberOfChildren > 1 || push(operation);
+}
+
+/* Read the real value of the result of a kernel. Return false if it is not
+ * real, in which case the tape gives up. */
+template <typename T>
+static bool RealValue(std::complex<T> c, T* result) {
+  c = ComplexNode<T>::Sanitized(c);
+  if (std::isnan(c.real()) || std::isnan(c.imag())) {
+    *result = NAN;
+    return true;
+  }
+  *result = c.real();
+  return c.imag() == static_cast<T>(0.);
+}
+
+/* The derivatives are divided as DivisionNode divides, which is undefined
+ * rather than infinite by zero. The derivatives are then undefined where the
+ * expression is not differentiable, as √(x) and ln(x) at 0, like the
+ * approximation of the derivative expression. */
+template <typename T>
+static T Quotient(T numerator, T denominator) {
+  return denominator == static_cast<T>(0.) ? static_cast<T>(NAN)
+                                           : numerator / denominator;
+}
+
+// factor×u^exponent, which is undefined rather than infinite at u = 0
+template <typename T>
+static T Monomial(T factor, T u, T exponent) {
+  if (factor == static_cast<T>(0.)) {
+    return factor;
+  }
+  return u == static_cast<T>(0.) && exponent < static_cast<T>(0.)
+             ? static_cast<T>(NAN)
+             : factor * std::pow(u, exponent);
+}
+
+// Chain rule, with g the function and its derivatives at u
+template <typename T>
+static DerivativeTape::Jet<T> Compose(DerivativeTape::Jet<T> u, T g, T dg,
+                                      T d2g) {
+  return {g, dg * u.firstDerivative,
+          d2g * u.firstDerivative * u.firstDerivative +
+              dg * u.secondDerivative};
+}
+
+template <typename T>
+bool DerivativeTape::evaluate(T t, Jet<T>* result) const {
+  using C = std::complex<T>;
+  if (!isCompiled()) {
+    return false;
+  }
+  constexpr T zero = static_cast<T>(0.);
+  constexpr T one = static_cast<T>(1.);
+  constexpr T two = static_cast<T>(2.);
+  // Factor of the derivatives of the trigonometric functions
+  const T k = Trigonometry::ConvertAngleToRadian(1., m_angleUnit);
+  Jet<T> stack[k_maxStackDepth];
+  int depth = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    Instruction instruction = m_instructions[i];
+    Operation operation = instruction.operation;
+    if (operation == Operation::Unknown) {
+      stack[depth++] = {t, one, zero};
+      continue;
+    }
+    if (operation == Operation::Constant) {
+      stack[depth++] = {static_cast<T>(m_constants[instruction.operand]), zero,
+                        zero};
+      continue;
+    }
+    Jet<T>& u = operation <= Operation::Division ? stack[depth - 2]
+                                                 : stack[depth - 1];
+    Jet<T> v = stack[depth - 1];
+    T u0 = u.value;
+    T g;
+    switch (operation) {
+      case Operation::Addition:
+      case Operation::Subtraction: {
+        T sign = operation == Operation::Addition ? one : -one;
+        if (!RealValue(operation == Operation::Addition
+                           ? AdditionNode::computeOnComplex<T>(
+                                 C(u0), C(v.value), m_complexFormat)
+                           : SubtractionNode::computeOnComplex<T>(
+                                 C(u0), C(v.value), m_complexFormat),
+                       &g)) {
+          return false;
+        }
+        u = {g, u.firstDerivative + sign * v.firstDerivative,
+             u.secondDerivative + sign * v.secondDerivative};
+        depth--;
+        break;
+      }
+      case Operation::Multiplication:
+        if (!RealValue(MultiplicationNode::computeOnComplex<T>(
+                           C(u0), C(v.value), m_complexFormat),
+                       &g)) {
+          return false;
+        }
+        u = {g, u.firstDerivative * v.value + u0 * v.firstDerivative,
+             u.secondDerivative * v.value +
+                 two * u.firstDerivative * v.firstDerivative +
+                 u0 * v.secondDerivative};
+        depth--;
+        break;
+      case Operation::Division: {
+        if (!RealValue(DivisionNode::computeOnComplex<T>(C(u0), C(v.value),
+                                                         m_complexFormat),
+                       &g)) {
+          return false;
+        }
+        T first = Quotient(u.firstDerivative - g * v.firstDerivative, v.value);
+        u = {g, first,
+             Quotient(u.secondDerivative - two * first * v.firstDerivative -
+                          g * v.secondDerivative,
+                      v.value)};
+        depth--;
+        break;
+      }
+      case Operation::Opposite:
+        u = {-u0, -u.firstDerivative, -u.secondDerivative};
+        break;
+      case Operation::IntegerPower: {
+        T n = static_cast<T>(instruction.operand);
+        if (!RealValue(PowerNode::computeOnComplex<T>(C(u0), C(n),
+                                                      m_complexFormat),
+                       &g)) {
+          return false;
+        }
+        u = Compose(u, g, Monomial(n, u0, n - one),
+                    Monomial(n * (n - one), u0, n - two));
+        break;
+      }
+      case Operation::Power: {
+        // u^v = exp(v×ln(u)), which is only differentiated for u > 0
+        Jet<T>& base = stack[depth - 2];
+        T b0 = base.value;
+        if (!RealValue(PowerNode::computeOnComplex<T>(C(b0), C(v.value),
+                                                      m_complexFormat),
+                       &g)) {
+          return false;
+        }
+        if (!(b0 > zero) && !std::isnan(g)) {
+          return false;
+        }
+        T lnFirst = base.firstDerivative / b0;
+        T lnSecond = base.secondDerivative / b0 - lnFirst * lnFirst;
+        T lnb = std::log(b0);
+        T h1 = v.firstDerivative * lnb + v.value * lnFirst;
+        T h2 = v.secondDerivative * lnb + two * v.firstDerivative * lnFirst +
+               v.value * lnSecond;
+        base = {g, g * h1, g * (h2 + h1 * h1)};
+        depth--;
+        break;
+      }
+      case Operation::SquareRoot:
+        if (!RealValue(SquareRootNode::computeOnComplex<T>(
+                           C(u0), m_complexFormat, m_angleUnit),
+                       &g)) {
+          return false;
+        }
+        u = Compose(u, g, Quotient(one, two * g),
+                    Quotient(-one, two * two * g * u0));
+        break;
+      case Operation::NaperianLogarithm:
+      case Operation::CommonLogarithm: {
+        bool naperian = operation == Operation::NaperianLogarithm;
+        if (!RealValue(naperian ? NaperianLogarithmNode::computeOnComplex<T>(
+                                      C(u0), m_complexFormat, m_angleUnit)
+                                : LogarithmNode::computeOnComplex<T>(
+                                      C(u0), m_complexFormat, m_angleUnit),
+                       &g)) {
+          return false;
+        }
+        T scale = naperian ? one : one / std::log(static_cast<T>(10.));
+        u = Compose(u, g, Quotient(scale, u0), Quotient(-scale, u0 * u0));
+        break;
+      }
+      case Operation::Sine:
+      case Operation::Cosine: {
+        T sine, cosine;
+        if (!RealValue(SineNode::computeOnComplex<T>(C(u0), m_complexFormat,
+                                                     m_angleUnit),
+                       &sine) ||
+            !RealValue(CosineNode::computeOnComplex<T>(C(u0), m_complexFormat,
+                                                       m_angleUnit),
+                       &cosine)) {
+          return false;
+        }
+        u = operation == Operation::Sine
+                ? Compose(u, sine, k * cosine, -k * k * sine)
+                : Compose(u, cosine, -k * sine, -k * k * cosine);
+        break;
+      }
+      case Operation::Tangent: {
+        if (!RealValue(TangentNode::computeOnComplex<T>(C(u0), m_complexFormat,
+                                                        m_angleUnit),
+                       &g)) {
+          return false;
+        }
+        T first = k * (one + g * g);
+        u = Compose(u, g, first, two * k * g * first);
+        break;
+      }
+      case Operation::ArcTangent: {
+        if (!RealValue(ArcTangentNode::computeOnComplex<T>(
+                           C(u0), m_complexFormat, m_angleUnit),
+                       &g)) {
+          return false;
+        }
+        T denominator = one + u0 * u0;
+        u = Compose(u, g, one / (k * denominator),
+                    -two * u0 / (k * denominator * denominator));
+        break;
+      }
+      default: {
+        assert(operation == Operation::AbsoluteValue);
+        if (!RealValue(AbsoluteValueNode::computeOnComplex<T>(
+                           C(u0), m_complexFormat, m_angleUnit),
+                       &g)) {
+          return false;
+        }
+        // |u| is not differentiable where u is null
+        T sign = u0 > zero ? one : u0 < zero ? -one : static_cast<T>(NAN);
+        u = Compose(u, g, sign, u0 == zero ? static_cast<T>(NAN) : zero);
+        break;
+      }
+    }
+  }
+  assert(depth == 1);
+  *result = stack[0];
+  return true;
+}
+
+template bool DerivativeTape::evaluate<float>(float, Jet<float>*) const;
+template bool DerivativeTape::evaluate<double>(double, Jet<double>*) const;
+
+}  // namespace Poincare
@@ -2,7 +2,9 @@
 #include <float.h>
 #include <ion.h>
 #include <ion/unicode/utf8_helper.h>
+#include <omg/thread_local.h>
 #include <poincare/addition.h>
+#include <poincare/approximation_dispatch.h>
 #include <poincare/based_integer.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/complex_cartesian.h>
@@ -34,6 +36,7 @@
 #include <poincare/undefined.h>
 #include <poincare/unit.h>
 #include <poincare/variable_context.h>
+#include <poincare/worker_pool.h>
 
 #include <cmath>
 #include <utility>
@@ -42,8 +45,9 @@
 
 namespace Poincare {
 
-static bool s_approximationEncounteredComplex = false;
-static bool s_reductionEncounteredUndistributedList = false;
+static OMG_THREAD_LOCAL bool s_approximationEncounteredComplex = false;
+static OMG_THREAD_LOCAL bool s_reductionEncounteredUndistributedList =
+    false;
 
 /* Constructor & Destructor */
 
@@ -589,11 +593,11 @@ bool Expression::hasDefinedComplexApproximation(
   }
   /* We return true when both real and imaginary approximation are defined and
    * imaginary part is not null. */
-  Evaluation<T> approximation = node()->approximate(T(), approximationContext);
-  if (approximation.type() != EvaluationNode<T>::Type::Complex) {
+  std::complex<T> z;
+  if (!ApproximationDispatch::ApproximateToComplex<T>(
+          node(), approximationContext, &z)) {
     return false;
   }
-  Complex<T> z = static_cast<Complex<T> &>(approximation);
   T b = z.imag();
   if (b == static_cast<T>(0.) || std::isinf(b) || std::isnan(b)) {
     return false;
@@ -809,6 +813,16 @@ Expression Expression::makePositiveAnyNegativeNumeralFactor(
 template <typename U>
 Evaluation<U> Expression::approximateToEvaluation(
     const ApproximationContext &approximationContext) const {
+  std::complex<U> c;
+  if (approximateToComplex(approximationContext, &c)) {
+    return Complex<U>::Builder(c);
+  }
+  return approximateToEvaluationTree<U>(approximationContext);
+}
+
+template <typename U>
+Evaluation<U> Expression::approximateToEvaluationTree(
+    const ApproximationContext &approximationContext) const {
   s_approximationEncounteredComplex = false;
   Evaluation<U> e = node()->approximate(U(), approximationContext);
   if (approximationContext.complexFormat() ==
@@ -1593,7 +1607,94 @@ Expression Expression::approximateKeepingUnits(
 template <typename U>
 U Expression::approximateToScalar(
     const ApproximationContext &approximationContext) const {
-  return approximateToEvaluation<U>(approximationContext).toScalar();
+  std::complex<U> c;
+  if (approximateToComplex(approximationContext, &c)) {
+    return ComplexNode<U>::ToScalar(c);
+  }
+  return approximateToEvaluationTree<U>(approximationContext).toScalar();
+}
+
+/* Return True if the node may not approximate to a scalar, False if it does
+ * whatever its children, and Unknown if it does when its children do. */
+static TrinaryBoolean NodeMayNotApproximateToScalar(
+    const ExpressionNode *node, Context *context) {
+  switch (node->type()) {
+    case ExpressionNode::Type::Point:
+    case ExpressionNode::Type::RandintNoRepeat:
+      return TrinaryBoolean::True;
+    // These reduce lists and matrices to scalars
+    case ExpressionNode::Type::Determinant:
+    case ExpressionNode::Type::ListElement:
+    case ExpressionNode::Type::ListMaximum:
+    case ExpressionNode::Type::ListMean:
+    case ExpressionNode::Type::ListMedian:
+    case ExpressionNode::Type::ListMinimum:
+    case ExpressionNode::Type::ListProduct:
+    case ExpressionNode::Type::ListSampleStandardDeviation:
+    case ExpressionNode::Type::ListStandardDeviation:
+    case ExpressionNode::Type::ListSum:
+    case ExpressionNode::Type::ListVariance:
+    case ExpressionNode::Type::MatrixTrace:
+    case ExpressionNode::Type::VectorDot:
+    case ExpressionNode::Type::VectorNorm:
+      return TrinaryBoolean::False;
+    case ExpressionNode::Type::Symbol: {
+      if (!context) {
+        return TrinaryBoolean::Unknown;
+      }
+      const char *name = static_cast<const SymbolNode *>(node)->name();
+      return BinaryToTrinaryBool(
+          context->expressionTypeForIdentifier(name, strlen(name)) ==
+          Context::SymbolAbstractType::List);
+    }
+    default:
+      // The lists and the matrices are the last types
+      return node->type() >= ExpressionNode::Type::List &&
+                     node->type() <= ExpressionNode::Type::Matrix
+                 ? TrinaryBoolean::True
+                 : TrinaryBoolean::Unknown;
+  }
+}
+
+bool Expression::approximationMayNotBeScalar(Context *context) const {
+  const TreeNode *end = node()->nextSibling();
+  const TreeNode *n = node();
+  while (n != end) {
+    switch (NodeMayNotApproximateToScalar(
+        static_cast<const ExpressionNode *>(n), context)) {
+      case TrinaryBoolean::True:
+        return true;
+      case TrinaryBoolean::False:
+        n = n->nextSibling();
+        break;
+      default:
+        n = n->next();
+    }
+  }
+  return false;
+}
+
+template <typename U>
+bool Expression::approximateToComplex(
+    const ApproximationContext &approximationContext,
+    std::complex<U> *result) const {
+  /* Give up before approximating anything, rather than once the scalar parts
+   * of the expression have been approximated, since the caller would then
+   * approximate them again on the Evaluation tree. */
+  if (approximationMayNotBeScalar(approximationContext.context())) {
+    return false;
+  }
+  s_approximationEncounteredComplex = false;
+  if (!ApproximationDispatch::ApproximateToComplex<U>(
+          node(), approximationContext, result)) {
+    return false;
+  }
+  if (approximationContext.complexFormat() ==
+          Preferences::ComplexFormat::Real &&
+      s_approximationEncounteredComplex) {
+    *result = complexNAN<U>();
+  }
+  return true;
 }
 
 template <typename U>
@@ -1618,6 +1719,88 @@ U Expression::approximateWithValueForSymbol(
   return approximateToScalar<U>(newContext);
 }
 
+namespace {
+
+template <typename U>
+struct ApproximationBatch {
+  const void *address;
+  size_t size;
+  const char *symbol;
+  const U *values;
+  U *results;
+  int numberOfValues;
+  int numberOfJobs;
+  ApproximationContext approximationContext;
+};
+
+template <typename U>
+void ApproximateBatchSlice(int index, void *context) {
+  const ApproximationBatch<U> *batch =
+      static_cast<const ApproximationBatch<U> *>(context);
+  int start = index * batch->numberOfValues / batch->numberOfJobs;
+  int end = (index + 1) * batch->numberOfValues / batch->numberOfJobs;
+  ExceptionCheckpoint checkpoint;
+  if (ExceptionRun(checkpoint)) {
+    // The expression is copied from the pool of the calling thread
+    Expression e =
+        Expression::ExpressionFromAddress(batch->address, batch->size);
+    for (int i = start; i < end; i++) {
+      batch->results[i] = e.approximateWithValueForSymbol<U>(
+          batch->symbol, batch->values[i], batch->approximationContext);
+    }
+  } else {
+    for (int i = start; i < end; i++) {
+      batch->results[i] = NAN;
+    }
+  }
+}
+
+bool DependsOnOtherSymbols(const Expression e, Context *context,
+                           void *symbol) {
+  return e.isOfType({ExpressionNode::Type::Symbol,
+                     ExpressionNode::Type::Function,
+                     ExpressionNode::Type::Sequence}) &&
+         !(e.type() == ExpressionNode::Type::Symbol &&
+           strcmp(static_cast<const Symbol &>(e).name(),
+                  static_cast<const char *>(symbol)) == 0);
+}
+
+}  // namespace
+
+template <typename U>
+void Expression::approximateWithValuesForSymbol(
+    const char *symbol, const U *values, U *results, int numberOfValues,
+    const ApproximationContext &approximationContext) const {
+  /* The workers cannot read the context, nor draw random numbers
+   * reproducibly. */
+  constexpr int k_numberOfJobsPerWorker = 4;
+  int numberOfWorkers = WorkerPool::NumberOfWorkers();
+  if (numberOfWorkers == 0 || numberOfValues < 2 * numberOfWorkers ||
+      recursivelyMatches(IsRandom, nullptr,
+                         SymbolicComputation::DoNotReplaceAnySymbol) ||
+      recursivelyMatches(DependsOnOtherSymbols, nullptr,
+                         SymbolicComputation::DoNotReplaceAnySymbol,
+                         const_cast<char *>(symbol))) {
+    for (int i = 0; i < numberOfValues; i++) {
+      results[i] = approximateWithValueForSymbol<U>(symbol, values[i],
+                                                    approximationContext);
+    }
+    return;
+  }
+  ApproximationBatch<U> batch = {
+      .address = addressInPool(),
+      .size = size(),
+      .symbol = symbol,
+      .values = values,
+      .results = results,
+      .numberOfValues = numberOfValues,
+      .numberOfJobs = std::min(numberOfValues,
+                               k_numberOfJobsPerWorker * numberOfWorkers),
+      .approximationContext = approximationContext};
+  batch.approximationContext.setContext(nullptr);
+  WorkerPool::Run(batch.numberOfJobs, ApproximateBatchSlice<U>, &batch);
+}
+
 Expression Expression::cloneAndApproximateKeepingSymbols(
     ReductionContext reductionContext) const {
   bool dummy;
@@ -1945,12 +2128,25 @@ template Evaluation<float> Expression::approximateToEvaluation(
 template Evaluation<double> Expression::approximateToEvaluation(
     const ApproximationContext &approximationContext) const;
 
+template bool Expression::approximateToComplex(
+    const ApproximationContext &approximationContext,
+    std::complex<float> *result) const;
+template bool Expression::approximateToComplex(
+    const ApproximationContext &approximationContext,
+    std::complex<double> *result) const;
+
 template float Expression::approximateWithValueForSymbol(
     const char *symbol, float x,
     const ApproximationContext &approximationContext) const;
 template double Expression::approximateWithValueForSymbol(
     const char *symbol, double x,
     const ApproximationContext &approximationContext) const;
+template void Expression::approximateWithValuesForSymbol(
+    const char *symbol, const float *values, float *results,
+    int numberOfValues, const ApproximationContext &approximationContext) const;
+template void Expression::approximateWithValuesForSymbol(
+    const char *symbol, const double *values, double *results,
+    int numberOfValues, const ApproximationContext &approximationContext) const;
 
 template Expression Expression::approximateKeepingUnits<double>(
     const ReductionContext &reductionContext) const;
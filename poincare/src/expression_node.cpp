@@ -1,4 +1,5 @@
 #include <poincare/addition.h>
+#include <poincare/approximation_helper.h>
 #include <poincare/arc_tangent.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/constant.h>
@@ -121,6 +122,20 @@ int ExpressionNode::simplificationOrderSameType(const ExpressionNode* e,
   return 0;
 }
 
+bool ExpressionNode::approximateToComplex(
+    const ApproximationContext& approximationContext,
+    std::complex<float>* result) const {
+  return ApproximationHelper::ComplexOfEvaluation<float>(
+      approximate(SinglePrecision(), approximationContext), result);
+}
+
+bool ExpressionNode::approximateToComplex(
+    const ApproximationContext& approximationContext,
+    std::complex<double>* result) const {
+  return ApproximationHelper::ComplexOfEvaluation<double>(
+      approximate(DoublePrecision(), approximationContext), result);
+}
+
 Expression ExpressionNode::shallowReduce(
     const ReductionContext& reductionContext) {
   Expression e(this);
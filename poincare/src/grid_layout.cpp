@@ -233,7 +233,51 @@ KDPoint GridLayoutNode::positionOfChild(LayoutNode *l, KDFont::Size font) {
   }
   y += rowBaseline(row, font) - l->baseline(font) +
        row * verticalGridEntryMargin(font);
-  return KDPoint(x, y);
+  return KDPoint(x, y).translatedBy(gridOrigin(font));
+}
+
+void GridLayoutNode::positionChildren(KDFont::Size font) {
+  if (m_numberOfColumns > k_maxNumberOfColumnsPositionedAtOnce) {
+    return LayoutNode::positionChildren(font);
+  }
+  KDCoordinate columnWidths[k_maxNumberOfColumnsPositionedAtOnce] = {};
+  int column = 0;
+  for (LayoutNode *l : children()) {
+    columnWidths[column] =
+        std::max(columnWidths[column], l->layoutSize(font).width());
+    column = (column + 1) % m_numberOfColumns;
+  }
+  /* Each row is walked twice: once to compute its baseline and height, and
+   * once to position its children. */
+  LayoutNode *firstChildOfRow = numberOfChildren() > 0 ? childAtIndex(0)
+                                                       : nullptr;
+  KDPoint origin = gridOrigin(font);
+  KDCoordinate y = origin.y();
+  for (int row = 0; row < m_numberOfRows; row++) {
+    KDCoordinate aboveBaseline = 0;
+    KDCoordinate underBaseline = 0;
+    LayoutNode *l = firstChildOfRow;
+    for (column = 0; column < m_numberOfColumns; column++) {
+      KDCoordinate b = l->baseline(font);
+      aboveBaseline = std::max(aboveBaseline, b);
+      underBaseline = std::max<KDCoordinate>(
+          underBaseline, l->layoutSize(font).height() - b);
+      l = static_cast<LayoutNode *>(l->nextSibling());
+    }
+    KDCoordinate x = origin.x();
+    l = firstChildOfRow;
+    for (column = 0; column < m_numberOfColumns; column++) {
+      setPositionOfChild(
+          l,
+          KDPoint(x + (columnWidths[column] - l->layoutSize(font).width()) / 2,
+                  y + aboveBaseline - l->baseline(font)),
+          font);
+      x += columnWidths[column] + horizontalGridEntryMargin(font);
+      l = static_cast<LayoutNode *>(l->nextSibling());
+    }
+    y += aboveBaseline + underBaseline + verticalGridEntryMargin(font);
+    firstChildOfRow = l;
+  }
 }
 
 // Private
@@ -381,6 +425,8 @@ void GridLayout::setDimensions(int rows, int columns) {
   assert(rows * columns == numberOfChildren());
   setNumberOfRows(rows);
   setNumberOfColumns(columns);
+  // Rows and columns may have been added or deleted away from the cursor
+  node()->invalidSizesPositionsAndBaselinesUpToRoot();
 }
 
 }  // namespace Poincare
@@ -107,6 +107,15 @@ KDPoint HorizontalLayoutNode::positionOfChild(LayoutNode *l,
   return KDPoint(x, y);
 }
 
+void HorizontalLayoutNode::positionChildren(KDFont::Size font) {
+  KDCoordinate x = 0;
+  KDCoordinate b = baseline(font);
+  for (LayoutNode *c : children()) {
+    setPositionOfChild(c, KDPoint(x, b - c->baseline(font)), font);
+    x += c->layoutSize(font).width();
+  }
+}
+
 KDSize HorizontalLayoutNode::layoutSizeBetweenIndexes(int leftIndex,
                                                       int rightIndex,
                                                       KDFont::Size font) const {
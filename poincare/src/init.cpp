@@ -9,4 +9,9 @@ void Init() {
   TreePool::sharedPool.init();
 }
 
+void Shutdown() {
+  TreePool::sharedPool.deinit();
+  Preferences::sharedPreferences.deinit();
+}
+
 }  // namespace Poincare
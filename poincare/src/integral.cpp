@@ -1,5 +1,7 @@
 #include <float.h>
+#include <ion.h>
 #include <poincare/addition.h>
+#include <poincare/approximation_dispatch.h>
 #include <poincare/complex.h>
 #include <poincare/integral.h>
 #include <poincare/integral_layout.h>
@@ -19,6 +21,19 @@ namespace Poincare {
 
 constexpr Expression::FunctionHelper Integral::s_functionHelper;
 
+void IntegralPanelCache::reset() {
+  m_integrandChecksum = 0;
+  m_gridStep = NAN;
+  for (Panel& panel : m_panels) {
+    panel.index = k_noPanel;
+  }
+}
+
+IntegralPanelCache::Panel* IntegralPanelCache::panelAtIndex(int32_t index) {
+  int32_t slot = index % k_numberOfPanels;
+  return &m_panels[slot < 0 ? slot + k_numberOfPanels : slot];
+}
+
 int IntegralNode::numberOfChildren() const {
   return Integral::s_functionHelper.numberOfChildren();
 }
@@ -122,11 +137,9 @@ Evaluation<T> IntegralNode::templatedApproximate(
       return Complex<T>::Builder(detailedResult.integral);
     }
   }
-  /* Choose the right substitution to use in Gauss-Konrod.
-   * We are using a (0,inf) -> (-1,1) like substitution when a bound is above
-   * these thresholds to deal with big but finite bounds */
-  constexpr T leftOpenThreshold = -1000.0;
-  constexpr T rightOpenThreshold = 1000.0;
+  // Choose the right substitution to use in Gauss-Konrod
+  constexpr T leftOpenThreshold = k_leftOpenThreshold;
+  constexpr T rightOpenThreshold = k_rightOpenThreshold;
   T start, end, scale = 1.0;
   if (a > b) {
     scale = -1.0;
@@ -182,33 +195,165 @@ bool IntegralNode::DetailedResultIsValid(DetailedResult<T> result) {
 }
 
 template <typename T>
-T IntegralNode::integrand(
-    T x, Substitution<T> substitution,
-    const ApproximationContext& approximationContext) const {
+T IntegralNode::SubstitutedArgument(T x, Substitution<T> substitution) {
+  switch (substitution.type) {
+    case Substitution<T>::Type::None:
+      return x;
+    case Substitution<T>::Type::LeftOpen: {
+      T z = 1.0 / (x + 1.0);
+      return substitution.originB - (2.0 * z - 1.0);
+    }
+    case Substitution<T>::Type::RightOpen: {
+      T z = 1.0 / (x + 1);
+      return 2.0 * z + substitution.originA - 1.0;
+    }
+    default: {
+      assert(substitution.type == Substitution<T>::Type::RealLine);
+      T x2 = x * x;
+      T inv = 1.0 / (1.0 - x2);
+      return x * inv;
+    }
+  }
+}
+
+template <typename T>
+T IntegralNode::SubstitutedIntegrand(T x, T value,
+                                     Substitution<T> substitution) {
   switch (substitution.type) {
     case Substitution<T>::Type::None:
-      return firstChildScalarValueForArgument(x, approximationContext);
+      return value;
     case Substitution<T>::Type::LeftOpen: {
       T z = 1.0 / (x + 1.0);
-      T arg = substitution.originB - (2.0 * z - 1.0);
-      return firstChildScalarValueForArgument(arg, approximationContext) * z *
-             z;
+      return value * z * z;
     }
     case Substitution<T>::Type::RightOpen: {
       T z = 1.0 / (x + 1);
-      T arg = 2.0 * z + substitution.originA - 1.0;
-      return firstChildScalarValueForArgument(arg, approximationContext) * z *
-             z;
+      return value * z * z;
     }
     default: {
       assert(substitution.type == Substitution<T>::Type::RealLine);
       T x2 = x * x;
       T inv = 1.0 / (1.0 - x2);
       T w = (1.0 + x2) * inv * inv;
-      T arg = x * inv;
-      return firstChildScalarValueForArgument(arg, approximationContext) * w;
+      return value * w;
+    }
+  }
+}
+
+template <typename T>
+void IntegralNode::integrands(
+    const T* x, T* values, int numberOfValues, Substitution<T> substitution,
+    const ApproximationContext& approximationContext) const {
+  assert(childAtIndex(1)->type() == Type::Symbol);
+  Symbol symbol = Symbol(static_cast<SymbolNode*>(childAtIndex(1)));
+  VariableContext variableContext =
+      VariableContext(symbol.name(), approximationContext.context());
+  ApproximationContext childContext = approximationContext;
+  childContext.setContext(&variableContext);
+  ExpressionNode* integrand = childAtIndex(0);
+  for (int i = 0; i < numberOfValues; i++) {
+    variableContext.setApproximationForVariable<T>(
+        SubstitutedArgument(x[i], substitution));
+    /* As in firstChildScalarValueForArgument, without building an evaluation
+     * when the integrand is a scalar. */
+    std::complex<T> c;
+    T value = ApproximationDispatch::ApproximateToComplex<T>(
+                  integrand, childContext, &c)
+                  ? ComplexNode<T>::ToScalar(c)
+                  : integrand->approximate(T(), childContext).toScalar();
+    values[i] = SubstitutedIntegrand(x[i], value, substitution);
+  }
+}
+
+uint32_t IntegralNode::integrandChecksum() const {
+  /* The nodes of the pool hold identifiers which change with each clone of the
+   * integrand, its serialization does not. */
+  constexpr int k_bufferSize = 256;
+  char buffer[k_bufferSize];
+  Expression integrand = Expression(childAtIndex(0));
+  int length = integrand.serialize(buffer, k_bufferSize);
+  int symbolLength = Expression(childAtIndex(1))
+                         .serialize(buffer + length, k_bufferSize - length);
+  if (length + symbolLength >= k_bufferSize - 1) {
+    // The serialization may have been truncated
+    return 0;
+  }
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t*>(buffer),
+                        length + symbolLength);
+}
+
+double IntegralNode::approximateWithPanelCache(
+    IntegralPanelCache* cache, double gridStep,
+    const ApproximationContext& approximationContext) const {
+  double a = childAtIndex(2)->approximate(double(), approximationContext)
+                 .toScalar();
+  double b = childAtIndex(3)->approximate(double(), approximationContext)
+                 .toScalar();
+  double start = std::min(a, b);
+  double end = std::max(a, b);
+  double firstPanel = std::floor(start / gridStep);
+  double lastPanel = std::ceil(end / gridStep) - 1.0;
+  /* Panels only help without substitution nor singularities on the bounds,
+   * which tanh-sinh quadrature handles. */
+  bool usePanels =
+      std::isfinite(gridStep) && gridStep > 0.0 &&
+      start >= k_leftOpenThreshold && end <= k_rightOpenThreshold &&
+      lastPanel - firstPanel < IntegralPanelCache::k_numberOfPanels &&
+      std::fabs(firstPanel) < INT32_MAX && std::fabs(lastPanel) < INT32_MAX &&
+      !std::isnan(firstChildScalarValueForArgument(a, approximationContext)) &&
+      !std::isnan(firstChildScalarValueForArgument(b, approximationContext)) &&
+      !Expression(childAtIndex(0))
+           .recursivelyMatches(Expression::IsRandom, nullptr,
+                               SymbolicComputation::DoNotReplaceAnySymbol);
+  uint32_t checksum = usePanels ? integrandChecksum() : 0;
+  if (checksum == 0) {
+    return templatedApproximate<double>(approximationContext).toScalar();
+  }
+  if (checksum != cache->m_integrandChecksum ||
+      gridStep != cache->m_gridStep ||
+      approximationContext.complexFormat() != cache->m_complexFormat ||
+      approximationContext.angleUnit() != cache->m_angleUnit) {
+    cache->reset();
+    cache->m_integrandChecksum = checksum;
+    cache->m_gridStep = gridStep;
+    cache->m_complexFormat = approximationContext.complexFormat();
+    cache->m_angleUnit = approximationContext.angleUnit();
+  }
+  constexpr double precision = Float<double>::SqrtEpsilonLax();
+  Substitution<double> substitution = {Substitution<double>::Type::None, start,
+                                       end};
+  DetailedResult<double> total = {0.0, 0.0};
+  for (int32_t index = firstPanel; index <= lastPanel; index++) {
+    double panelStart = index * gridStep;
+    double panelEnd = (index + 1) * gridStep;
+    double from = std::max(start, panelStart);
+    double to = std::min(end, panelEnd);
+    if (from >= to) {
+      continue;
+    }
+    bool isFullPanel = from == panelStart && to == panelEnd;
+    IntegralPanelCache::Panel* cachedPanel = cache->panelAtIndex(index);
+    DetailedResult<double> panel;
+    if (isFullPanel && cachedPanel->index == index) {
+      panel = {cachedPanel->integral, cachedPanel->absoluteError};
+    } else {
+      panel = adaptiveQuadrature<double>(from, to, precision,
+                                         k_maxNumberOfIterations, substitution,
+                                         approximationContext);
+      if (!DetailedResultIsValid(panel)) {
+        return NAN;
+      }
+      if (isFullPanel) {
+        *cachedPanel = {index, panel.integral, panel.absoluteError};
+      }
     }
+    total.integral += panel.integral;
+    total.absoluteError += panel.absoluteError;
   }
+  if (!DetailedResultIsValid(total)) {
+    return NAN;
+  }
+  return a > b ? -total.integral : total.integral;
 }
 
 Expression IntegralNode::rewriteIntegrandNear(
@@ -405,9 +550,6 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(
       0.142775938577060080797094273138717, 0.147739104901338491374841515972068,
       0.149445554002916905664936468389821};
 
-  T fv1[10];
-  T fv2[10];
-
   T center = static_cast<T>(0.5) * (a + b);
   T halfLength = static_cast<T>(0.5) * (b - a);
   T absHalfLength = std::fabs(halfLength);
@@ -416,25 +558,30 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(
   errorResult.integral = NAN;
   errorResult.absoluteError = 0;
 
-  T gaussIntegral = 0;
-  T fCenter = integrand(center, substitution, approximationContext);
-  if (std::isnan(fCenter)) {
-    return errorResult;
-  }
-  T kronrodIntegral = wKronrod[10] * fCenter;
-  T absKronrodIntegral = std::fabs(kronrodIntegral);
+  /* The 21 nodes are approximated together, the center first and then each
+   * pair of symmetric nodes. */
+  T nodes[21];
+  T values[21];
+  nodes[0] = center;
   for (int j = 0; j < 10; j++) {
     T xDelta = halfLength * x[j];
-    T fval1 = integrand(center - xDelta, substitution, approximationContext);
-    if (std::isnan(fval1)) {
-      return errorResult;
-    }
-    T fval2 = integrand(center + xDelta, substitution, approximationContext);
-    if (std::isnan(fval2)) {
+    nodes[2 * j + 1] = center - xDelta;
+    nodes[2 * j + 2] = center + xDelta;
+  }
+  integrands(nodes, values, 21, substitution, approximationContext);
+  for (int j = 0; j < 21; j++) {
+    if (std::isnan(values[j])) {
       return errorResult;
     }
-    fv1[j] = fval1;
-    fv2[j] = fval2;
+  }
+  T fCenter = values[0];
+
+  T gaussIntegral = 0;
+  T kronrodIntegral = wKronrod[10] * fCenter;
+  T absKronrodIntegral = std::fabs(kronrodIntegral);
+  for (int j = 0; j < 10; j++) {
+    T fval1 = values[2 * j + 1];
+    T fval2 = values[2 * j + 2];
     T fsum = fval1 + fval2;
     if (j % 2 == 1) {
       gaussIntegral += wGauss[j / 2] * fsum;
@@ -448,8 +595,8 @@ IntegralNode::DetailedResult<T> IntegralNode::kronrodGaussQuadrature(
       wKronrod[10] * std::fabs(fCenter - halfKronrodIntegral);
   for (int j = 0; j < 10; j++) {
     kronrodIntegralDifference +=
-        wKronrod[j] * (std::fabs(fv1[j] - halfKronrodIntegral) +
-                       std::fabs(fv2[j] - halfKronrodIntegral));
+        wKronrod[j] * (std::fabs(values[2 * j + 1] - halfKronrodIntegral) +
+                       std::fabs(values[2 * j + 2] - halfKronrodIntegral));
   }
   T integral = kronrodIntegral * halfLength;
   absKronrodIntegral = absKronrodIntegral * absHalfLength;
@@ -545,6 +692,21 @@ void Integral::deepReduceChildren(const ReductionContext& reductionContext) {
   }
 }
 
+double Integral::approximateWithPanelCache(
+    IntegralPanelCache* cache, double gridStep,
+    const ApproximationContext& approximationContext) const {
+  Expression::SetEncounteredComplex(false);
+  double result = static_cast<const IntegralNode*>(node())
+                      ->approximateWithPanelCache(cache, gridStep,
+                                                  approximationContext);
+  if (approximationContext.complexFormat() ==
+          Preferences::ComplexFormat::Real &&
+      Expression::EncounteredComplex()) {
+    return NAN;
+  }
+  return result;
+}
+
 Expression Integral::shallowReduce(ReductionContext reductionContext) {
   {
     Expression e = SimplificationHelper::defaultShallowReduce(
@@ -0,0 +1,70 @@
+#include <assert.h>
+#include <ion/timing.h>
+#include <poincare/circuit_breaker_checkpoint.h>
+#include <poincare/exception_checkpoint.h>
+#include <poincare/job.h>
+
+namespace Poincare {
+
+Job::Status Job::advance(uint64_t deadline) {
+  while (isRunning()) {
+    m_sliceEnded = false;
+    if (!runStep()) {
+      // Let the caller handle the key press
+      break;
+    }
+    if (m_sliceEnded || Ion::Timing::millis() >= deadline) {
+      break;
+    }
+  }
+  return m_status;
+}
+
+Job::Status Job::runUntilDone() {
+  while (advance(UINT64_MAX) == Status::Running && m_sliceEnded) {
+  }
+  return m_status;
+}
+
+void Job::cancel() {
+  if (isRunning()) {
+    m_status = Status::Cancelled;
+    didEnd();
+  }
+}
+
+bool Job::runStep() {
+  assert(isRunning());
+  bool interrupted = false;
+  bool rolledBack = false;
+  TreeNode* endOfPool;
+  {
+    ExceptionCheckpoint ecp;
+    endOfPool = ecp.endOfPoolBeforeCheckpoint();
+    if (ExceptionRun(ecp)) {
+      CircuitBreakerCheckpoint checkpoint(
+          Ion::CircuitBreaker::CheckpointType::AnyKey);
+      if (CircuitBreakerRun(checkpoint)) {
+        if (step()) {
+          m_status = Status::Completed;
+        }
+      } else {
+        // The checkpoint already rolled back the pool
+        interrupted = true;
+        rolledBack = true;
+      }
+    } else {
+      m_status = Status::Failed;
+      rolledBack = true;
+    }
+  }
+  if (rolledBack) {
+    didRollBackStep(endOfPool);
+  }
+  if (!isRunning()) {
+    didEnd();
+  }
+  return !interrupted;
+}
+
+}  // namespace Poincare
@@ -119,7 +119,9 @@ bool LayoutCursor::move(OMG::Direction direction, bool selecting,
   }
 
   if (*shouldRedrawLayout) {
-    invalidateSizesAndPositions();
+    /* The layouts left by the cursor, such as grids and derivatives, may have
+     * changed their state anywhere in the tree. */
+    m_layout.root().invalidAllSizesPositionsAndBaselines();
   }
   return moved;
 }
@@ -189,6 +191,10 @@ void LayoutCursor::insertLayout(Layout layout, Context *context,
     return;
   }
   assert(!forceRight || !forceLeft);
+  /* The layout edited before the insertion may be merged or detached by the
+   * steps below, so its ancestors are invalidated while they can be reached. */
+  invalidateSizesAndPositions();
+
   // - Step 1 - Delete selection
   deleteAndResetSelection();
 
@@ -1002,12 +1008,25 @@ bool LayoutCursor::setEmptyRectangleVisibilityAtCurrentPosition(
   return result;
 }
 
-void LayoutCursor::invalidateSizesAndPositions() {
-  Layout layoutToInvalidate = m_layout;
-  while (!layoutToInvalidate.parent().isUninitialized()) {
-    layoutToInvalidate = layoutToInvalidate.parent();
+Layout LayoutCursor::editedLayout() const {
+  Layout currentLayout = m_layout;
+  Layout currentParent = currentLayout.parent();
+  while (!currentParent.isUninitialized() &&
+         (currentParent.isHorizontal() ||
+          AutocompletedBracketPairLayoutNode::IsAutoCompletedBracketPairType(
+              currentParent.type()))) {
+    currentLayout = currentParent;
+    currentParent = currentLayout.parent();
   }
+  return currentLayout;
+}
+
+void LayoutCursor::invalidateSizesAndPositions() {
+  /* The sizes of the layouts outside of the edited layout only depend on
+   * their subtree, which did not change, unless they are its ancestors. */
+  Layout layoutToInvalidate = editedLayout();
   layoutToInvalidate.invalidAllSizesPositionsAndBaselines();
+  layoutToInvalidate.node()->invalidSizesPositionsAndBaselinesUpToRoot();
 }
 
 void LayoutCursor::privateDelete(LayoutNode::DeletionMethod deletionMethod,
@@ -1256,15 +1275,8 @@ void LayoutCursor::balanceAutocompletedBracketsAndKeepAValidCursor() {
    * it's useless to take the parent horizontal layout of the fraction, since
    * brackets outside of the fraction won't impact the ones inside the fraction
    * */
-  Layout currentLayout = m_layout;
+  Layout currentLayout = editedLayout();
   Layout currentParent = currentLayout.parent();
-  while (!currentParent.isUninitialized() &&
-         (currentParent.isHorizontal() ||
-          AutocompletedBracketPairLayoutNode::IsAutoCompletedBracketPairType(
-              currentParent.type()))) {
-    currentLayout = currentParent;
-    currentParent = currentLayout.parent();
-  }
   // If the top bracket does not have an horizontal parent, create one
   if (!currentLayout.isHorizontal()) {
     assert(!currentParent.isUninitialized());
@@ -61,21 +61,17 @@ void LayoutNode::draw(KDContext *ctx, KDPoint p, KDGlyph::Style style,
 
 KDPoint LayoutNode::absoluteOriginWithMargin(KDFont::Size font) {
   LayoutNode *p = parent();
+  if (p == nullptr) {
+    return KDPointZero;
+  }
   if (!m_flags.m_positioned || m_flags.m_positionFontSize != font) {
-    if (p != nullptr) {
-      assert(!SumOverflowsKDCoordinate(p->absoluteOrigin(font).x(),
-                                       p->positionOfChild(this, font).x()));
-      assert(!SumOverflowsKDCoordinate(p->absoluteOrigin(font).y(),
-                                       p->positionOfChild(this, font).y()));
-      m_frame.setOrigin(
-          p->absoluteOrigin(font).translatedBy(p->positionOfChild(this, font)));
-    } else {
-      m_frame.setOrigin(KDPointZero);
-    }
-    m_flags.m_positioned = true;
-    m_flags.m_positionFontSize = font;
+    p->positionChildren(font);
+    assert(m_flags.m_positioned && m_flags.m_positionFontSize == font);
   }
-  return m_frame.origin();
+  KDPoint parentOrigin = p->absoluteOrigin(font);
+  assert(!SumOverflowsKDCoordinate(parentOrigin.x(), m_frame.origin().x()));
+  assert(!SumOverflowsKDCoordinate(parentOrigin.y(), m_frame.origin().y()));
+  return parentOrigin.translatedBy(m_frame.origin());
 }
 
 KDSize LayoutNode::layoutSize(KDFont::Size font) {
@@ -138,6 +134,18 @@ void LayoutNode::invalidAllSizesPositionsAndBaselines() {
   }
 }
 
+void LayoutNode::invalidSizesPositionsAndBaselinesUpToRoot() {
+  LayoutNode *l = this;
+  while (l != nullptr) {
+    l->m_flags.m_sized = false;
+    l->m_flags.m_baselined = false;
+    for (LayoutNode *c : l->children()) {
+      c->m_flags.m_positioned = false;
+    }
+    l = l->parent();
+  }
+}
+
 int LayoutNode::indexAfterHorizontalCursorMove(
     OMG::HorizontalDirection direction, int currentIndex,
     bool *shouldRedrawLayout) {
@@ -220,6 +228,20 @@ bool LayoutNode::deleteGraySquaresBeforeLeavingGrid(Layout layoutToExclude) {
 
 // Protected and private
 
+void LayoutNode::positionChildren(KDFont::Size font) {
+  for (LayoutNode *l : children()) {
+    setPositionOfChild(l, positionOfChild(l, font), font);
+  }
+}
+
+void LayoutNode::setPositionOfChild(LayoutNode *child, KDPoint position,
+                                    KDFont::Size font) {
+  assert(child->parent() == this);
+  child->m_frame.setOrigin(position);
+  child->m_flags.m_positioned = true;
+  child->m_flags.m_positionFontSize = font;
+}
+
 bool LayoutNode::protectedIsIdenticalTo(Layout l) {
   if (numberOfChildren() != l.numberOfChildren()) {
     return false;
@@ -11,6 +11,8 @@
 #include <poincare/simplification_helper.h>
 #include <poincare/undefined.h>
 
+#include <cmath>
+
 #include "poincare/symbol_abstract.h"
 
 namespace Poincare {
@@ -91,14 +93,91 @@ Evaluation<T> ListNode::extremumApproximation(
                                           approximationContext);
 }
 
+/* Neumaier's variant of Kahan summation: the rounding error of each addition
+ * is accumulated apart and added back at the end, so that the error does not
+ * grow with the length of the list. */
+template <typename T>
+class CompensatedSum {
+ public:
+  CompensatedSum() : m_sum(0.0), m_compensation(0.0) {}
+  void add(T x) {
+    T sum = m_sum + x;
+    m_compensation += std::fabs(m_sum) >= std::fabs(x) ? (m_sum - sum) + x
+                                                        : (x - sum) + m_sum;
+    m_sum = sum;
+  }
+  // Infinite sums would turn the compensation into NAN
+  T value() const {
+    return std::isfinite(m_sum) ? m_sum + m_compensation : m_sum;
+  }
+
+ private:
+  T m_sum;
+  T m_compensation;
+};
+
+template <typename T>
+class RealProduct {
+ public:
+  RealProduct() : m_product(1.0) {}
+  void add(T x) { m_product *= x; }
+  T value() const { return m_product; }
+
+ private:
+  T m_product;
+};
+
+/* Accumulate the elements on their real values as long as they are real, which
+ * avoids building an evaluation for each partial result. From the first
+ * element that is not real on, fall back on the generic reduction. */
+template <typename T, typename Accumulator, typename Reduction>
+Evaluation<T> ListNode::reduceElements(
+    const ApproximationContext& approximationContext,
+    Reduction reductionFunction) const {
+  assert(numberOfChildren() > 0);
+  Accumulator accumulator;
+  bool isFirstElement = true;
+  Evaluation<T> result;
+  for (ExpressionNode* child : children()) {
+    Evaluation<T> childEvaluation =
+        child->approximate(T(), approximationContext);
+    if (result.isUninitialized()) {
+      if (childEvaluation.type() == EvaluationNode<T>::Type::Complex) {
+        std::complex<T> z = childEvaluation.complexAtIndex(0);
+        if (z.imag() == static_cast<T>(0.0) && !std::isnan(z.real())) {
+          accumulator.add(z.real());
+          isFirstElement = false;
+          continue;
+        }
+      }
+      if (isFirstElement) {
+        isFirstElement = false;
+        result = childEvaluation;
+        if (result.isUndefined()) {
+          return Complex<T>::Undefined();
+        }
+        continue;
+      }
+      result = Complex<T>::Builder(accumulator.value());
+    }
+    result = reductionFunction(result, childEvaluation,
+                               approximationContext.complexFormat());
+    if (result.isUndefined()) {
+      return Complex<T>::Undefined();
+    }
+  }
+  return result.isUninitialized() ? Complex<T>::Builder(accumulator.value())
+                                  : result;
+}
+
 template <typename T>
 Evaluation<T> ListNode::sumOfElements(
     const ApproximationContext& approximationContext) {
   if (numberOfChildren() == 0) {
     return Complex<T>::Builder(0.0);
   }
-  return ApproximationHelper::MapReduce<T>(
-      this, approximationContext,
+  return reduceElements<T, CompensatedSum<T>>(
+      approximationContext,
       [](Evaluation<T> eval1, Evaluation<T> eval2,
          Preferences::ComplexFormat complexFormat) {
         return ApproximationHelper::Reduce<T>(
@@ -115,8 +194,8 @@ Evaluation<T> ListNode::productOfElements(
   if (numberOfChildren() == 0) {
     return Complex<T>::Builder(1.0);
   }
-  return ApproximationHelper::MapReduce<T>(
-      this, approximationContext,
+  return reduceElements<T, RealProduct<T>>(
+      approximationContext,
       [](Evaluation<T> eval1, Evaluation<T> eval2,
          Preferences::ComplexFormat complexFormat) {
         return ApproximationHelper::Reduce<T>(
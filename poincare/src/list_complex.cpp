@@ -4,6 +4,8 @@
 #include <poincare/point_evaluation.h>
 #include <poincare/undefined.h>
 
+#include <algorithm>
+
 namespace Poincare {
 
 template <typename T>
@@ -59,8 +61,48 @@ ListComplex<T> ListComplex<T>::Undefined() {
   return undefList;
 }
 
+template <typename T>
+bool ListComplex<T>::sortRealValues() {
+  int n = numberOfChildren();
+  if (n > k_maxNumberOfSortedRealValues) {
+    return false;
+  }
+  T values[k_maxNumberOfSortedRealValues];
+  int i = 0;
+  for (EvaluationNode<T> *c : node()->children()) {
+    if (c->type() != EvaluationNode<T>::Type::Complex) {
+      return false;
+    }
+    std::complex<T> z = *static_cast<ComplexNode<T> *>(c);
+    if (z.imag() != static_cast<T>(0.0) || std::isnan(z.real())) {
+      return false;
+    }
+    values[i++] = z.real();
+  }
+  Helpers::Sort(
+      [](int i, int j, void *context, int numberOfElements) {
+        T *values = static_cast<T *>(context);
+        std::swap(values[i], values[j]);
+      },
+      [](int i, int j, void *context, int numberOfElements) {
+        T *values = static_cast<T *>(context);
+        return values[i] >= values[j];
+      },
+      values, n);
+  // Only the values of the children are overwritten, in place
+  i = 0;
+  for (EvaluationNode<T> *c : node()->children()) {
+    std::complex<T> *z = static_cast<ComplexNode<T> *>(c);
+    *z = values[i++];
+  }
+  return true;
+}
+
 template <typename T>
 bool ListComplex<T>::sort() {
+  if (sortRealValues()) {
+    return true;
+  }
   bool listOfDefinedScalars = this->isListOfDefinedScalars();
   bool listOfDefinedPoints = this->isListOfDefinedPoints();
   if (!listOfDefinedScalars && !listOfDefinedPoints) {
@@ -18,7 +18,7 @@ Expression ListMeanNode::shallowReduce(
 template <typename T>
 Evaluation<T> ListMeanNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
-  ListComplex<T> evaluationArray[2];
+  FloatList<T> evaluationArray[2];
   StatisticsDataset<T> dataset = StatisticsDataset<T>::BuildFromChildren(
       this, approximationContext, evaluationArray);
   if (dataset.isUndefined()) {
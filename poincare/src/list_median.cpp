@@ -18,7 +18,7 @@ Expression ListMedianNode::shallowReduce(
 template <typename T>
 Evaluation<T> ListMedianNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
-  ListComplex<T> evaluationArray[2];
+  FloatList<T> evaluationArray[2];
   StatisticsDataset<T> dataset = StatisticsDataset<T>::BuildFromChildren(
       this, approximationContext, evaluationArray);
   if (dataset.isUndefined()) {
@@ -46,7 +46,7 @@ Expression ListMedian::shallowReduce(ReductionContext reductionContext) {
       }
     }
   }
-  ListComplex<double> evaluationArray[2];
+  FloatList<double> evaluationArray[2];
   StatisticsDataset<double> dataset =
       StatisticsDataset<double>::BuildFromChildren(node(), approximationContext,
                                                    evaluationArray);
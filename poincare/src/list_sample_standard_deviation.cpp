@@ -18,7 +18,7 @@ Expression ListSampleStandardDeviationNode::shallowReduce(
 template <typename T>
 Evaluation<T> ListSampleStandardDeviationNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
-  ListComplex<T> evaluationArray[2];
+  FloatList<T> evaluationArray[2];
   StatisticsDataset<T> dataset = StatisticsDataset<T>::BuildFromChildren(
       this, approximationContext, evaluationArray);
   if (dataset.isUndefined()) {
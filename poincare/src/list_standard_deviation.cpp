@@ -15,7 +15,7 @@ Expression ListStandardDeviationNode::shallowReduce(
 template <typename T>
 Evaluation<T> ListStandardDeviationNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
-  ListComplex<T> evaluationArray[2];
+  FloatList<T> evaluationArray[2];
   StatisticsDataset<T> dataset = StatisticsDataset<T>::BuildFromChildren(
       this, approximationContext, evaluationArray);
   if (dataset.isUndefined()) {
@@ -17,7 +17,7 @@ Expression ListVarianceNode::shallowReduce(
 template <typename T>
 Evaluation<T> ListVarianceNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
-  ListComplex<T> evaluationArray[2];
+  FloatList<T> evaluationArray[2];
   StatisticsDataset<T> dataset = StatisticsDataset<T>::BuildFromChildren(
       this, approximationContext, evaluationArray);
   if (dataset.isUndefined()) {
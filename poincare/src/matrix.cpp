@@ -788,11 +788,16 @@ Expression Matrix::computeInverseOrDeterminant(
   }
 }
 
+template int Matrix::ArrayInverse<float>(float *, int, int);
 template int Matrix::ArrayInverse<double>(double *, int, int);
 template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *,
                                                        int, int);
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *,
                                                         int, int);
+template void Matrix::ArrayRowCanonize<float>(float *, int, int, float *,
+                                              bool);
+template void Matrix::ArrayRowCanonize<double>(double *, int, int, double *,
+                                               bool);
 template void Matrix::ArrayRowCanonize<std::complex<float>>(
     std::complex<float> *, int, int, std::complex<float> *, bool);
 template void Matrix::ArrayRowCanonize<std::complex<double>>(
@@ -56,21 +56,54 @@ std::complex<T> MatrixComplexNode<T>::trace() const {
   return c;
 }
 
+template <typename T>
+void MatrixComplexNode<T>::copyOperands(std::complex<T> *operands) const {
+  int i = 0;
+  for (EvaluationNode<T> *c : this->children()) {
+    operands[i++] = c->type() == EvaluationNode<T>::Type::Complex
+                        ? *static_cast<ComplexNode<T> *>(c)
+                        : std::complex<T>(NAN, NAN);
+  }
+}
+
+template <typename T>
+bool MatrixComplexNode<T>::copyRealOperands(T *operands) const {
+  int i = 0;
+  for (EvaluationNode<T> *c : this->children()) {
+    if (c->type() != EvaluationNode<T>::Type::Complex) {
+      return false;
+    }
+    std::complex<T> z = *static_cast<ComplexNode<T> *>(c);
+    if (z.imag() != static_cast<T>(0.0)) {
+      return false;
+    }
+    operands[i++] = z.real();
+  }
+  return true;
+}
+
 template <typename T>
 std::complex<T> MatrixComplexNode<T>::determinant() const {
   if (numberOfRows() != numberOfColumns() || numberOfChildren() == 0 ||
       numberOfChildren() > Matrix::k_maxNumberOfChildren) {
     return std::complex<T>(NAN, NAN);
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfChildren];
-  int childrenNumber = numberOfChildren();
-  for (int i = 0; i < childrenNumber; i++) {
-    // Returns complex<T>(NAN, NAN) if Node type is not Complex
-    operandsCopy[i] = complexAtIndex(i);
+  /* The determinant only needs the forward elimination, which picks the
+   * biggest pivot of each column and is therefore more accurate as well. */
+  constexpr bool reduced = false;
+  T realOperands[Matrix::k_maxNumberOfChildren];
+  if (copyRealOperands(realOperands)) {
+    T determinant = 1.0;
+    Matrix::ArrayRowCanonize(realOperands, m_numberOfRows, m_numberOfColumns,
+                             &determinant, reduced);
+    return determinant;
   }
+  std::complex<T> operandsCopy[Matrix::k_maxNumberOfChildren];
+  // Non complex children are copied as complex<T>(NAN, NAN)
+  copyOperands(operandsCopy);
   std::complex<T> determinant = std::complex<T>(1);
   Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns,
-                           &determinant);
+                           &determinant, reduced);
   return determinant;
 }
 
@@ -80,20 +113,27 @@ MatrixComplex<T> MatrixComplexNode<T>::inverse() const {
       numberOfChildren() > Matrix::k_maxNumberOfChildren) {
     return MatrixComplex<T>::Undefined();
   }
+  /* Intentionally swapping dimensions for inverse, although it doesn't make a
+   * difference because it is square. */
+  T realOperands[Matrix::k_maxNumberOfChildren];
+  if (copyRealOperands(realOperands)) {
+    if (Matrix::ArrayInverse(realOperands, m_numberOfRows, m_numberOfColumns) ==
+        0) {
+      return MatrixComplex<T>::Builder(realOperands, m_numberOfColumns,
+                                       m_numberOfRows);
+    }
+    return MatrixComplex<T>::Undefined();
+  }
   std::complex<T> operandsCopy[Matrix::k_maxNumberOfChildren];
-  int i = 0;
   for (EvaluationNode<T> *c : this->children()) {
     if (c->type() != EvaluationNode<T>::Type::Complex) {
       return MatrixComplex<T>::Undefined();
     }
-    operandsCopy[i] = complexAtIndex(i);
-    i++;
   }
+  copyOperands(operandsCopy);
   int result =
       Matrix::ArrayInverse(operandsCopy, m_numberOfRows, m_numberOfColumns);
   if (result == 0) {
-    /* Intentionally swapping dimensions for inverse, although it doesn't make a
-     * difference because it is square. */
     return MatrixComplex<T>::Builder(operandsCopy, m_numberOfColumns,
                                      m_numberOfRows);
   }
@@ -125,14 +165,18 @@ MatrixComplex<T> MatrixComplexNode<T>::ref(bool reduced) const {
       numberOfChildren() > Matrix::k_maxNumberOfChildren) {
     return MatrixComplex<T>::Undefined();
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfChildren];
-  int childrenNumber = numberOfChildren();
-  for (int i = 0; i < childrenNumber; i++) {
-    // Returns complex<T>(NAN, NAN) if Node type is not Complex
-    operandsCopy[i] = complexAtIndex(i);
-  }
   /* Reduced row echelon form is also called row canonical form. To compute the
    * row echelon form (non reduced one), fewer steps are required. */
+  T realOperands[Matrix::k_maxNumberOfChildren];
+  if (copyRealOperands(realOperands)) {
+    Matrix::ArrayRowCanonize(realOperands, m_numberOfRows, m_numberOfColumns,
+                             static_cast<T *>(nullptr), reduced);
+    return MatrixComplex<T>::Builder(realOperands, m_numberOfRows,
+                                     m_numberOfColumns);
+  }
+  std::complex<T> operandsCopy[Matrix::k_maxNumberOfChildren];
+  // Non complex children are copied as complex<T>(NAN, NAN)
+  copyOperands(operandsCopy);
   Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns,
                            static_cast<std::complex<T> *>(nullptr), reduced);
   return MatrixComplex<T>::Builder(operandsCopy, m_numberOfRows,
@@ -185,6 +229,17 @@ Evaluation<T> MatrixComplexNode<T>::cross(MatrixComplex<T> *e) const {
 
 // MATRIX COMPLEX REFERENCE
 
+template <typename T>
+MatrixComplex<T> MatrixComplex<T>::Builder(T *operands, int numberOfRows,
+                                           int numberOfColumns) {
+  MatrixComplex<T> m = MatrixComplex<T>::Builder();
+  for (int i = 0; i < numberOfRows * numberOfColumns; i++) {
+    m.addChildAtIndexInPlace(Complex<T>::Builder(operands[i]), i, i);
+  }
+  m.setDimensions(numberOfRows, numberOfColumns);
+  return m;
+}
+
 template <typename T>
 MatrixComplex<T> MatrixComplex<T>::Builder(std::complex<T> *operands,
                                            int numberOfRows,
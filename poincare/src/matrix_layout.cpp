@@ -107,10 +107,8 @@ KDSize MatrixLayoutNode::computeSize(KDFont::Size font) {
   return SquareBracketPairLayoutNode::SizeGivenChildSize(gridSize(font));
 }
 
-KDPoint MatrixLayoutNode::positionOfChild(LayoutNode *l, KDFont::Size font) {
-  assert(indexOfChild(l) >= 0);
-  return GridLayoutNode::positionOfChild(l, font).translatedBy(
-      SquareBracketPairLayoutNode::ChildOffset(gridHeight(font)));
+KDPoint MatrixLayoutNode::gridOrigin(KDFont::Size font) {
+  return SquareBracketPairLayoutNode::ChildOffset(gridHeight(font));
 }
 
 KDCoordinate MatrixLayoutNode::computeBaseline(KDFont::Size font) {
@@ -151,6 +151,26 @@ MatrixComplex<T> MultiplicationNode::computeOnMatrices(
   if (m.numberOfColumns() != n.numberOfRows()) {
     return MatrixComplex<T>::Undefined();
   }
+  constexpr int k_maxNumberOfChildren = Matrix::k_maxNumberOfChildren;
+  int mNumberOfRows = m.numberOfRows();
+  int mNumberOfColumns = m.numberOfColumns();
+  int nNumberOfColumns = n.numberOfColumns();
+  if (mNumberOfRows * mNumberOfColumns <= k_maxNumberOfChildren &&
+      mNumberOfColumns * nNumberOfColumns <= k_maxNumberOfChildren &&
+      mNumberOfRows * nNumberOfColumns <= k_maxNumberOfChildren) {
+    /* Real matrices are multiplied on dense arrays, since complexAtIndex walks
+     * the children and complex products cost four real ones. */
+    T mOperands[k_maxNumberOfChildren];
+    T nOperands[k_maxNumberOfChildren];
+    if (m.copyRealOperands(mOperands) && n.copyRealOperands(nOperands)) {
+      T resultOperands[k_maxNumberOfChildren];
+      Multiplication::computeOnArrays(mOperands, nOperands, resultOperands,
+                                      mNumberOfColumns, mNumberOfRows,
+                                      nNumberOfColumns);
+      return MatrixComplex<T>::Builder(resultOperands, mNumberOfRows,
+                                       nNumberOfColumns);
+    }
+  }
   MatrixComplex<T> result = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfRows(); i++) {
     for (int j = 0; j < n.numberOfColumns(); j++) {
@@ -1659,6 +1679,11 @@ template std::complex<double> MultiplicationNode::computeOnComplex<double>(
     const std::complex<double>, const std::complex<double>,
     Preferences::ComplexFormat);
 
+template void Multiplication::computeOnArrays<float>(float *m, float *n,
+                                                     float *result,
+                                                     int mNumberOfColumns,
+                                                     int mNumberOfRows,
+                                                     int nNumberOfColumns);
 template void Multiplication::computeOnArrays<double>(double *m, double *n,
                                                       double *result,
                                                       int mNumberOfColumns,
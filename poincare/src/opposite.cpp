@@ -25,6 +25,19 @@ Evaluation<T> OppositeNode::templatedApproximate(
                                      approximationContext.complexFormat());
 }
 
+template <typename T>
+bool OppositeNode::templatedApproximateToComplex(
+    const ApproximationContext& approximationContext,
+    std::complex<T>* result) const {
+  std::complex<T> c;
+  if (!childAtIndex(0)->approximateToComplex(approximationContext, &c)) {
+    return false;
+  }
+  *result = ComplexNode<T>::Sanitized(MultiplicationNode::computeOnComplex<T>(
+      -1, c, approximationContext.complexFormat()));
+  return true;
+}
+
 /* Layout */
 
 bool OppositeNode::childAtIndexNeedsUserParentheses(const Expression& child,
@@ -32,6 +32,13 @@ Evaluation<T> ParenthesisNode::templatedApproximate(
   return childAtIndex(0)->approximate(T(), approximationContext);
 }
 
+template <typename T>
+bool ParenthesisNode::templatedApproximateToComplex(
+    const ApproximationContext& approximationContext,
+    std::complex<T>* result) const {
+  return childAtIndex(0)->approximateToComplex(approximationContext, result);
+}
+
 Expression Parenthesis::shallowReduce(ReductionContext reductionContext) {
   Expression e =
       SimplificationHelper::defaultShallowReduce(*this, &reductionContext);
@@ -2,6 +2,26 @@
 
 namespace Poincare {
 
+constexpr IdentifierIndex<uint8_t> ParsingHelper::s_reservedNamesIndex = [] {
+  IdentifierIndex<uint8_t> index(IdentifierIndex<uint8_t>::Key::FirstByte);
+  for (const SpecialIdentifier& identifier : s_specialIdentifiers) {
+    index.addNames(identifier.identifierAliasesList, SpecialIdentifierName);
+  }
+  for (const ConstantNode::ConstantInfo& info : ConstantNode::k_constants) {
+    index.addNames(info.m_aliasesList, ConstantName);
+  }
+  index.addNames(AliasesLists::k_thetaAliases, ThetaName);
+  index.addNames(LogicalOperatorNotNode::k_name, LogicalOperatorName);
+  for (const BinaryLogicalOperatorNode::OperatorName& logicalOperator :
+       BinaryLogicalOperatorNode::k_operatorNames) {
+    index.addNames(logicalOperator.name, LogicalOperatorName);
+  }
+  for (const Expression::FunctionHelper* helper : s_reservedFunctions) {
+    index.addNames(helper->aliasesList(), ReservedFunctionName);
+  }
+  return index;
+}();
+
 const Expression::FunctionHelper* const* ParsingHelper::GetReservedFunction(
     const char* name, size_t nameLength) {
   const Expression::FunctionHelper* const* reservedFunction =
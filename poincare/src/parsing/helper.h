@@ -1,6 +1,7 @@
 #ifndef POINCARE_PARSING_HELPER_H
 #define POINCARE_PARSING_HELPER_H
 
+#include <poincare/identifier_index.h>
 #include <poincare_expressions.h>
 
 #include <array>
@@ -23,6 +24,19 @@ class ParsingHelper {
   ReservedFunctionsUpperBound() {
     return s_reservedFunctionsUpperBound;
   }
+  /* Categories of the reserved names, as bits of a mask. The categories in
+   * which a name may be found are given by a single lookup in a compile-time
+   * index, so that the other categories need not be searched. */
+  enum ReservedNameCategory : uint8_t {
+    SpecialIdentifierName = 1 << 0,
+    ConstantName = 1 << 1,
+    ThetaName = 1 << 2,
+    LogicalOperatorName = 1 << 3,
+    ReservedFunctionName = 1 << 4,
+  };
+  static uint8_t ReservedNameCategories(const char *name, size_t nameLength) {
+    return s_reservedNamesIndex.categoriesOf(name, nameLength);
+  }
   static bool IsSpecialIdentifierName(const char *name, size_t nameLength);
   static bool IsLogicalOperator(const char *name, size_t nameLength,
                                 Token::Type *returnType);
@@ -183,6 +197,9 @@ class ParsingHelper {
   constexpr static int k_numberOfInverses = std::size(s_inverses);
   constexpr static FunctionMapping const *s_inverseFunctionsUpperBound =
       s_inverses + (k_numberOfInverses);
+
+  // Reserved names indexed by their first byte
+  static const IdentifierIndex<uint8_t> s_reservedNamesIndex;
 };
 
 }  // namespace Poincare
@@ -450,17 +450,24 @@ Token::Type Tokenizer::stringTokenType(const char* string,
           lastCharOfString) {
     return Token::Type::CustomIdentifier;
   }
-  if (ParsingHelper::IsSpecialIdentifierName(string, *length)) {
+  /* Most of the strings tried while splitting identifiers are not reserved
+   * names, so only search the tables of the categories they may belong to. */
+  uint8_t categories = ParsingHelper::ReservedNameCategories(string, *length);
+  if ((categories & ParsingHelper::SpecialIdentifierName) &&
+      ParsingHelper::IsSpecialIdentifierName(string, *length)) {
     return Token::Type::SpecialIdentifier;
   }
-  if (Constant::IsConstant(string, *length)) {
+  if ((categories & ParsingHelper::ConstantName) &&
+      Constant::IsConstant(string, *length)) {
     return Token::Type::Constant;
   }
-  if (AliasesLists::k_thetaAliases.contains(string, *length)) {
+  if ((categories & ParsingHelper::ThetaName) &&
+      AliasesLists::k_thetaAliases.contains(string, *length)) {
     return Token::Type::CustomIdentifier;
   }
   Token::Type logicalOperatorType;
-  if (ParsingHelper::IsLogicalOperator(string, *length, &logicalOperatorType)) {
+  if ((categories & ParsingHelper::LogicalOperatorName) &&
+      ParsingHelper::IsLogicalOperator(string, *length, &logicalOperatorType)) {
     return logicalOperatorType;
   }
   if (string[0] == '_') {
@@ -480,7 +487,8 @@ Token::Type Tokenizer::stringTokenType(const char* string,
     return *(string + *length) == '(' ? Token::Type::ReservedFunction
                                       : Token::Type::Unit;
   }
-  if (ParsingHelper::GetReservedFunction(string, *length) != nullptr) {
+  if ((categories & ParsingHelper::ReservedFunctionName) &&
+      ParsingHelper::GetReservedFunction(string, *length) != nullptr) {
     return Token::Type::ReservedFunction;
   }
   /* When parsing for unit conversion, the identifier "m" should always
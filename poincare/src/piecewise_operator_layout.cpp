@@ -65,12 +65,9 @@ KDSize PiecewiseOperatorLayoutNode::computeSize(KDFont::Size font) {
   return sizeWithBrace;
 }
 
-KDPoint PiecewiseOperatorLayoutNode::positionOfChild(LayoutNode *l,
-                                                     KDFont::Size font) {
-  assert(indexOfChild(l) >= 0);
-  return GridLayoutNode::positionOfChild(l, font).translatedBy(
-      KDPoint(CurlyBraceLayoutNode::k_curlyBraceWidth,
-              CurlyBraceLayoutNode::k_lineThickness));
+KDPoint PiecewiseOperatorLayoutNode::gridOrigin(KDFont::Size font) {
+  return KDPoint(CurlyBraceLayoutNode::k_curlyBraceWidth,
+                 CurlyBraceLayoutNode::k_lineThickness);
 }
 
 KDCoordinate PiecewiseOperatorLayoutNode::computeBaseline(KDFont::Size font) {
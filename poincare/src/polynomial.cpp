@@ -1,5 +1,6 @@
 #include <poincare/addition.h>
 #include <poincare/arithmetic.h>
+#include <poincare/complex.h>
 #include <poincare/complex_argument.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/division.h>
@@ -14,7 +15,9 @@
 #include <poincare/sign_function.h>
 #include <poincare/square_root.h>
 #include <poincare/subtraction.h>
+#include <poincare/symbol.h>
 #include <poincare/undefined.h>
+#include <poincare/variable_context.h>
 
 namespace Poincare {
 
@@ -544,6 +547,151 @@ int Polynomial::CubicPolynomialRoots(Expression a, Expression b, Expression c,
   return !root1->isUndefined() + !root2->isUndefined() + !root3->isUndefined();
 }
 
+bool Polynomial::ApproximateCoefficients(
+    const Expression e, const char *symbol, int degree,
+    const ApproximationContext &approximationContext,
+    std::complex<double> *coefficients) {
+  assert(0 < degree && degree <= k_maxApproximateDegree);
+  /* On the unit circle, the values of a polynomial whose roots are far from
+   * it are dominated by its constant or leading coefficient, and the rounding
+   * error of the transform swamps the others. They are computed again on the
+   * circle whose radius is the geometric mean of the moduli of the non null
+   * roots, where the lowest and leading terms have the same magnitude. Bounds
+   * on the moduli such as Fujiwara's are too loose for this: it exceeds 100
+   * for the roots 1 to 15. */
+  if (!ApproximateCoefficientsOnCircle(e, symbol, degree, 1.0,
+                                       approximationContext, coefficients)) {
+    return false;
+  }
+  if (coefficients[degree] == 0.0) {
+    return true;
+  }
+  int lowest = 0;
+  while (coefficients[lowest] == 0.0) {
+    lowest++;
+  }
+  if (lowest == degree) {
+    return true;
+  }
+  double radius =
+      std::pow(std::abs(coefficients[lowest] / coefficients[degree]),
+               1.0 / (degree - lowest));
+  return ApproximateCoefficientsOnCircle(e, symbol, degree, radius,
+                                         approximationContext, coefficients);
+}
+
+bool Polynomial::ApproximateCoefficientsOnCircle(
+    const Expression e, const char *symbol, int degree, double radius,
+    const ApproximationContext &approximationContext,
+    std::complex<double> *coefficients) {
+  /* The polynomial is evaluated at r*w^j, where w^j are the n-th roots of
+   * unity with n = degree + 1, and its coefficients are given by the inverse
+   * discrete Fourier transform of the values:
+   * c_k = 1/(n*r^k) * sum p(r*w^j)*w^(-jk). The transform is unitary, so the
+   * scaled coefficients c_k*r^k are as precise as the values. */
+  int n = degree + 1;
+  std::complex<double> values[k_maxApproximateDegree + 1];
+  VariableContext variableContext(symbol, approximationContext.context());
+  ApproximationContext valueContext = approximationContext;
+  valueContext.setContext(&variableContext);
+  // The values on the circle are complex whatever the complex format
+  valueContext.setComplextFormat(Preferences::ComplexFormat::Cartesian);
+  for (int j = 0; j < n; j++) {
+    std::complex<double> z = std::polar(radius, 2 * M_PI * j / n);
+    variableContext.setExpressionForSymbolAbstract(
+        Complex<double>::Builder(z).complexToExpression(
+            Preferences::ComplexFormat::Cartesian),
+        Symbol::Builder(symbol, strlen(symbol)));
+    if (!e.approximateToComplex<double>(valueContext, values + j) ||
+        !std::isfinite(values[j].real()) || !std::isfinite(values[j].imag())) {
+      return false;
+    }
+  }
+  double maxValue = 0.0;
+  for (int j = 0; j < n; j++) {
+    maxValue = std::max(maxValue, std::abs(values[j]));
+  }
+  /* Coefficients below the rounding error of the transform are null, which
+   * keeps the null roots of x^n for instance exact. */
+  double threshold = n * Float<double>::Epsilon() * maxValue;
+  for (int k = 0; k < n; k++) {
+    std::complex<double> sum = 0.0;
+    for (int j = 0; j < n; j++) {
+      // j*k is reduced modulo n to compute w^(-jk) precisely
+      sum += values[j] * std::polar(1.0, -2 * M_PI * ((j * k) % n) / n);
+    }
+    sum /= static_cast<double>(n);
+    coefficients[k] =
+        std::abs(sum) <= threshold ? 0.0 : sum / std::pow(radius, k);
+  }
+  return true;
+}
+
+int Polynomial::ApproximateRoots(const std::complex<double> *coefficients,
+                                 int degree, std::complex<double> *roots) {
+  assert(0 < degree && degree <= k_maxApproximateDegree);
+  std::complex<double> leading = coefficients[degree];
+  if (leading == 0.0) {
+    return 0;
+  }
+  /* The initial guesses are spread on a circle whose radius is Fujiwara's
+   * bound on the moduli of the roots, halved. They are offset from the real
+   * axis to break the symmetry of polynomials with real coefficients. */
+  double radius = 0.0;
+  for (int i = 0; i < degree; i++) {
+    radius = std::max(radius, std::pow(std::abs(coefficients[i] / leading),
+                                       1.0 / (degree - i)));
+  }
+  if (radius == 0.0) {
+    // The polynomial is a monomial
+    for (int i = 0; i < degree; i++) {
+      roots[i] = 0.0;
+    }
+    return degree;
+  }
+  for (int i = 0; i < degree; i++) {
+    roots[i] = std::polar(radius, (2 * M_PI * i + 0.4) / degree);
+  }
+  /* Each iteration moves every root by the Newton step corrected by the
+   * repulsion of the other roots: w = N / (1 - N * sum 1/(z_i - z_j)). The
+   * updated roots are used as soon as they are computed. */
+  for (int iteration = 0; iteration < k_maxNumberOfAberthIterations;
+       iteration++) {
+    bool converged = true;
+    for (int i = 0; i < degree; i++) {
+      std::complex<double> value = coefficients[degree];
+      std::complex<double> derivative = 0.0;
+      for (int k = degree - 1; k >= 0; k--) {
+        derivative = derivative * roots[i] + value;
+        value = value * roots[i] + coefficients[k];
+      }
+      if (value == 0.0 || derivative == 0.0) {
+        continue;
+      }
+      std::complex<double> newtonStep = value / derivative;
+      std::complex<double> repulsion = 0.0;
+      for (int j = 0; j < degree; j++) {
+        if (j != i) {
+          repulsion += 1.0 / (roots[i] - roots[j]);
+        }
+      }
+      std::complex<double> step = newtonStep / (1.0 - newtonStep * repulsion);
+      if (!std::isfinite(step.real()) || !std::isfinite(step.imag())) {
+        return 0;
+      }
+      roots[i] -= step;
+      converged = converged && std::abs(step) <= Float<double>::Epsilon() *
+                                                     std::abs(roots[i]);
+    }
+    if (converged) {
+      break;
+    }
+  }
+  /* Multiple roots converge linearly and may not reach the precision above,
+   * they are still returned as approximations of the cluster. */
+  return degree;
+}
+
 Expression Polynomial::ReducePolynomial(
     const Expression *coefficients, int degree, Expression parameter,
     const ReductionContext &reductionContext) {
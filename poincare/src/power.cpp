@@ -457,6 +457,26 @@ defaultApproximation:
   return result.isUndefined() ? Complex<T>::Undefined() : result;
 }
 
+template <typename T>
+bool PowerNode::templatedApproximateToComplex(
+    const ApproximationContext &approximationContext,
+    std::complex<T> *result) const {
+  if (approximationContext.complexFormat() ==
+      Preferences::ComplexFormat::Real) {
+    // Handle the real roots of c^(p/q) in templatedApproximate
+    return ExpressionNode::approximateToComplex(approximationContext, result);
+  }
+  std::complex<T> base, index;
+  if (!childAtIndex(0)->approximateToComplex(approximationContext, &base) ||
+      !childAtIndex(1)->approximateToComplex(approximationContext, &index)) {
+    return false;
+  }
+  std::complex<T> c = ComplexNode<T>::Sanitized(
+      computeOnComplex<T>(base, index, approximationContext.complexFormat()));
+  *result = std::isnan(c.real()) || std::isnan(c.imag()) ? complexNAN<T>() : c;
+  return true;
+}
+
 // Power
 
 int Power::getPolynomialCoefficients(Context *context, const char *symbolName,
@@ -1830,5 +1850,11 @@ template Evaluation<float> Poincare::PowerNode::templatedApproximate<float>(
     const Poincare::ApproximationContext &approximationContext) const;
 template Evaluation<double> Poincare::PowerNode::templatedApproximate<double>(
     const Poincare::ApproximationContext &approximationContext) const;
+template bool Poincare::PowerNode::templatedApproximateToComplex<float>(
+    const Poincare::ApproximationContext &approximationContext,
+    std::complex<float> *result) const;
+template bool Poincare::PowerNode::templatedApproximateToComplex<double>(
+    const Poincare::ApproximationContext &approximationContext,
+    std::complex<double> *result) const;
 
 }  // namespace Poincare
@@ -20,12 +20,14 @@ Solver<T>::Solver(T xStart, T xEnd, const char *unknown, Context *context,
       m_angleUnit(angleUnit),
       m_lastInterest(Interest::None),
       m_growthSpeed(sizeof(T) == sizeof(double) ? GrowthSpeed::Precise
-                                                : GrowthSpeed::Fast) {}
+                                                : GrowthSpeed::Fast),
+      m_derivativeTape(nullptr) {}
 
 template <typename T>
 Coordinate2D<T> Solver<T>::next(FunctionEvaluation f, const void *aux,
                                 BracketTest test, HoneResult hone,
-                                DiscontinuityEvaluation discontinuityTest) {
+                                DiscontinuityEvaluation discontinuityTest,
+                                const DerivativeTape *derivativeTape) {
   Coordinate2D<T> p1, p2(start(), f(start(), aux)),
       p3(nextX(p2.x(), end(), static_cast<T>(1.)), k_NAN);
   p3.setY(f(p3.x(), aux));
@@ -65,8 +67,9 @@ Coordinate2D<T> Solver<T>::next(FunctionEvaluation f, const void *aux,
     }
 
     if (interest != Interest::None) {
-      Coordinate2D<T> solution = honeAndRoundSolution(
-          f, aux, start.x(), end.x(), interest, hone, discontinuityTest);
+      Coordinate2D<T> solution =
+          honeAndRoundSolution(f, aux, start.x(), end.x(), interest, test,
+                               hone, discontinuityTest, derivativeTape);
       if (std::isfinite(solution.x()) &&
           (std::isfinite(solution.y()) ||
            interest == Interest::Discontinuity) &&
@@ -102,7 +105,15 @@ Coordinate2D<T> Solver<T>::next(const Expression &e, BracketTest test,
                                                        p->approximationContext);
   };
 
-  return next(f, &parameters, test, hone, &DiscontinuityTestForExpression);
+  /* The tape can only be used on the expression it was compiled from, and not
+   * on one of its children. */
+  const DerivativeTape *derivativeTape =
+      !m_derivativeTapeExpression.isUninitialized() &&
+              e.identifier() == m_derivativeTapeExpression.identifier()
+          ? m_derivativeTape
+          : nullptr;
+  return next(f, &parameters, test, hone, &DiscontinuityTestForExpression,
+              derivativeTape);
 }
 
 template <typename T>
@@ -299,6 +310,80 @@ Coordinate2D<T> Solver<T>::CompositeBrentForRoot(FunctionEvaluation f,
              : Coordinate2D<T>();
 }
 
+template <typename T>
+Coordinate2D<T> Solver<T>::NewtonHone(FunctionEvaluation f, const void *aux,
+                                      const DerivativeTape *tape, T xMin,
+                                      T xMax, Interest interest, T precision) {
+  constexpr int k_maxNumberOfIterations = 50;
+  constexpr T k_two = static_cast<T>(2.);
+  const Coordinate2D<T> failure(k_NAN, k_NAN);
+  /* g is the function whose root is searched, f for roots and f' for extrema,
+   * and dg its derivative. */
+  T g, dg;
+  auto evaluate = [tape, interest, &g, &dg](T x) {
+    DerivativeTape::Jet<T> jet;
+    if (!tape->evaluate<T>(x, &jet)) {
+      return false;
+    }
+    g = interest == Interest::Root ? jet.value : jet.firstDerivative;
+    dg = interest == Interest::Root ? jet.firstDerivative
+                                    : jet.secondDerivative;
+    return std::isfinite(g) && std::isfinite(dg);
+  };
+  T xLeft = std::min(xMin, xMax), xRight = std::max(xMin, xMax);
+  if (!evaluate(xLeft)) {
+    return failure;
+  }
+  T gLeft = g;
+  if (!evaluate(xRight)) {
+    return failure;
+  }
+  T gRight = g;
+  /* Orient the bracket so that g(xLow) < 0 < g(xHigh). Around a minimum, f'
+   * goes from negative to positive, and the other way around a maximum. */
+  bool increasing = gLeft < k_zero && k_zero < gRight;
+  bool decreasing = gRight < k_zero && k_zero < gLeft;
+  if (!(interest == Interest::LocalMinimum  ? increasing
+        : interest == Interest::LocalMaximum ? decreasing
+                                             : increasing || decreasing)) {
+    return failure;
+  }
+  T xLow = increasing ? xLeft : xRight;
+  T xHigh = increasing ? xRight : xLeft;
+
+  T x = (xLow + xHigh) / k_two;
+  T dx = std::fabs(xHigh - xLow);
+  T previousDx = dx;
+  if (!evaluate(x)) {
+    return failure;
+  }
+  for (int i = 0; i < k_maxNumberOfIterations; i++) {
+    if (((x - xHigh) * dg - g) * ((x - xLow) * dg - g) > k_zero ||
+        std::fabs(k_two * g) > std::fabs(previousDx * dg)) {
+      // The Newton step leaves the bracket or converges slowly: bisect
+      previousDx = dx;
+      dx = (xHigh - xLow) / k_two;
+      x = xLow + dx;
+    } else {
+      previousDx = dx;
+      dx = g / dg;
+      x -= dx;
+    }
+    if (std::fabs(dx) < precision) {
+      return Coordinate2D<T>(x, f(x, aux));
+    }
+    if (!evaluate(x)) {
+      return failure;
+    }
+    if (g < k_zero) {
+      xLow = x;
+    } else {
+      xHigh = x;
+    }
+  }
+  return failure;
+}
+
 template <typename T>
 bool Solver<T>::DiscontinuityTestForExpression(T x1, T x2, const void *aux) {
   const Solver<T>::FunctionEvaluationParameters *p =
@@ -632,7 +717,9 @@ Coordinate2D<T> Solver<T>::nextRootInAddition(const Expression &e) const {
 template <typename T>
 Coordinate2D<T> Solver<T>::honeAndRoundSolution(
     FunctionEvaluation f, const void *aux, T start, T end, Interest interest,
-    HoneResult hone, DiscontinuityEvaluation discontinuityTest) {
+    BracketTest test, HoneResult hone,
+    DiscontinuityEvaluation discontinuityTest,
+    const DerivativeTape *derivativeTape) {
   TrinaryBoolean discontinuous = TrinaryBoolean::Unknown;
   if (discontinuityTest) {
     discontinuous = discontinuityTest(start, end, aux) ? TrinaryBoolean::True
@@ -649,8 +736,20 @@ Coordinate2D<T> Solver<T>::honeAndRoundSolution(
   T precision = discontinuous == TrinaryBoolean::True
                     ? precisionForDiscontinuousFunctions
                     : NullTolerance(start);
-  Coordinate2D<T> solution =
-      hone(f, aux, start, end, interest, precision, discontinuous);
+  Coordinate2D<T> solution(k_NAN, k_NAN);
+  if (derivativeTape && discontinuous != TrinaryBoolean::True) {
+    solution = NewtonHone(f, aux, derivativeTape, start, end, interest,
+                          precision);
+    /* An extremum found when searching roots is only a root if it is null, as
+     * in CompositeBrentForRoot. */
+    if (test == EvenOrOddRootInBracket && interest != Interest::Root &&
+        !(std::fabs(solution.y()) < NullTolerance(solution.x()))) {
+      solution = Coordinate2D<T>(k_NAN, k_NAN);
+    }
+  }
+  if (!std::isfinite(solution.x())) {
+    solution = hone(f, aux, start, end, interest, precision, discontinuous);
+  }
   if (!std::isfinite(solution.x()) || !validSolution(solution.x())) {
     return solution;
   }
@@ -711,7 +810,7 @@ template Solver<double>::Solver(double, double, const char *, Context *,
                                 Preferences::AngleUnit);
 template Coordinate2D<double> Solver<double>::next(
     FunctionEvaluation, const void *, BracketTest, HoneResult,
-    DiscontinuityEvaluation discontinuityTest);
+    DiscontinuityEvaluation discontinuityTest, const DerivativeTape *);
 template Coordinate2D<double> Solver<double>::nextRoot(const Expression &);
 template Coordinate2D<double> Solver<double>::nextMinimum(const Expression &);
 template Coordinate2D<double> Solver<double>::nextIntersection(
@@ -737,7 +836,7 @@ template Solver<float>::Solver(float, float, const char *, Context *,
                                Preferences::AngleUnit);
 template Coordinate2D<float> Solver<float>::next(
     FunctionEvaluation, const void *, BracketTest, HoneResult,
-    DiscontinuityEvaluation discontinuityTest);
+    DiscontinuityEvaluation discontinuityTest, const DerivativeTape *);
 template float Solver<float>::MaximalStep(float);
 
 }  // namespace Poincare
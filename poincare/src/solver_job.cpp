@@ -0,0 +1,51 @@
+#include <assert.h>
+#include <poincare/solver_job.h>
+
+#include <algorithm>
+
+namespace Poincare {
+
+SolverJob::SolverJob(Solver<double> solver, const Expression &e,
+                     NextSolution next, Coordinate2D<double> *solutions,
+                     int maxNumberOfSolutions)
+    : m_solver(solver),
+      m_expression(e),
+      m_next(next),
+      m_solutions(solutions),
+      m_initialStart(solver.start()),
+      m_maxNumberOfSolutions(maxNumberOfSolutions),
+      m_numberOfSolutions(0),
+      m_hasMoreSolutions(false) {
+  assert(maxNumberOfSolutions > 0);
+}
+
+float SolverJob::progress() const {
+  if (!isRunning()) {
+    return 1.f;
+  }
+  double amplitude = m_solver.end() - m_initialStart;
+  if (amplitude == 0.) {
+    return 0.f;
+  }
+  return std::clamp(
+      static_cast<float>((m_solver.start() - m_initialStart) / amplitude), 0.f,
+      1.f);
+}
+
+bool SolverJob::step() {
+  // Work on a copy so that an interrupted step can be run again
+  Solver<double> solver = m_solver;
+  Coordinate2D<double> solution = (solver.*m_next)(m_expression);
+  if (std::isnan(solution.x())) {
+    return true;
+  }
+  m_solver = solver;
+  if (m_numberOfSolutions == m_maxNumberOfSolutions) {
+    m_hasMoreSolutions = true;
+    return true;
+  }
+  m_solutions[m_numberOfSolutions++] = solution;
+  return false;
+}
+
+}  // namespace Poincare
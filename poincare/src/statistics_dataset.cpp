@@ -11,7 +11,7 @@ namespace Poincare {
 template <typename T>
 StatisticsDataset<T> StatisticsDataset<T>::BuildFromChildren(
     const ExpressionNode *e, const ApproximationContext &approximationContext,
-    ListComplex<T> evaluationArray[]) {
+    FloatList<T> evaluationArray[]) {
   int n = e->numberOfChildren();
   if (n == 0) {
     return StatisticsDataset<T>();
@@ -22,10 +22,20 @@ StatisticsDataset<T> StatisticsDataset<T>::BuildFromChildren(
     if (childEval.type() != EvaluationNode<T>::Type::ListComplex) {
       return StatisticsDataset<T>();
     }
-    evaluationArray[i] = static_cast<ListComplex<T> &>(childEval);
+    /* Copy the scalar values into a FloatList, whose values are accessed in
+     * constant time, whereas ListComplex walks its children. */
+    evaluationArray[i] = FloatList<T>::Builder();
+    int index = 0;
+    for (EvaluationNode<T> *c : childEval.node()->children()) {
+      evaluationArray[i].addValueAtIndex(
+          c->type() == EvaluationNode<T>::Type::Complex
+              ? ComplexNode<T>::ToScalar(c->complexAtIndex(0))
+              : static_cast<T>(NAN),
+          index);
+      index++;
+    }
   }
-  if (n > 1 && evaluationArray[0].numberOfChildren() !=
-                   evaluationArray[1].numberOfChildren()) {
+  if (n > 1 && evaluationArray[0].length() != evaluationArray[1].length()) {
     return StatisticsDataset<T>();
   }
   return n == 1
@@ -2,6 +2,7 @@
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/unicode/utf8_helper.h>
 #include <poincare/code_point_layout.h>
+#include <poincare/complex.h>
 #include <poincare/context.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/layout_helper.h>
@@ -91,9 +92,28 @@ bool SymbolNode::derivate(const ReductionContext& reductionContext,
   return Symbol(this).derivate(reductionContext, symbol, symbolValue);
 }
 
+template <typename T>
+bool SymbolNode::scalarApproximationFromContext(
+    const ApproximationContext& approximationContext,
+    std::complex<T>* result) const {
+  assert(approximationContext.context());
+  std::complex<double> value;
+  if (!approximationContext.context()->scalarApproximationForSymbol(
+          m_name, approximationContext, sizeof(T) == sizeof(double),
+          &value)) {
+    return false;
+  }
+  *result = static_cast<std::complex<T>>(value);
+  return true;
+}
+
 template <typename T>
 Evaluation<T> SymbolNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
+  std::complex<T> value;
+  if (scalarApproximationFromContext(approximationContext, &value)) {
+    return Complex<T>::Builder(value);
+  }
   Symbol s(this);
   // No need to preserve undefined symbols because they will be approximated.
   Expression e = SymbolAbstract::Expand(
@@ -105,6 +125,18 @@ Evaluation<T> SymbolNode::templatedApproximate(
   return e.node()->approximate(T(), approximationContext);
 }
 
+template <typename T>
+bool SymbolNode::templatedApproximateToComplex(
+    const ApproximationContext& approximationContext,
+    std::complex<T>* result) const {
+  std::complex<T> value;
+  if (scalarApproximationFromContext(approximationContext, &value)) {
+    *result = ComplexNode<T>::Sanitized(value);
+    return true;
+  }
+  return ExpressionNode::approximateToComplex(approximationContext, result);
+}
+
 bool SymbolNode::isUnknown() const {
   bool result = UTF8Helper::CodePointIs(m_name, UCodePointUnknown);
   if (result) {
@@ -9,10 +9,10 @@
 namespace Poincare {
 
 #if ASSERTIONS
-bool TreePool::s_treePoolLocked = false;
+OMG_THREAD_LOCAL bool TreePool::s_treePoolLocked = false;
 #endif
 
-OMG::GlobalBox<TreePool> TreePool::sharedPool;
+OMG_THREAD_LOCAL OMG::GlobalBox<TreePool> TreePool::sharedPool;
 
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) &&
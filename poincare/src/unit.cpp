@@ -1120,6 +1120,53 @@ Evaluation<T> UnitNode::templatedApproximate(
 }
 
 // Unit
+constexpr Unit::SymbolIndex Unit::s_symbolIndex = [] {
+  uint16_t prefixLengths = 0;
+  for (const Prefix& prefix : k_prefixes) {
+    prefixLengths |= 1 << Helpers::StringLength(prefix.m_symbol);
+  }
+  SymbolIndex index(SymbolIndex::Key::LastByte);
+  int dimension = 0;
+  auto addDimension = [&](const auto& representatives) {
+    for (const Representative& representative : representatives) {
+      index.addNames(representative.m_rootSymbols,
+                     static_cast<uint32_t>(1) << dimension,
+                     representative.m_inputPrefixable == Prefixable::None
+                         ? 1
+                         : prefixLengths);
+    }
+    dimension++;
+  };
+  // In the order of Representative::DefaultRepresentatives
+  addDimension(k_timeRepresentatives);
+  addDimension(k_distanceRepresentatives);
+  addDimension(k_angleRepresentatives);
+  addDimension(k_massRepresentatives);
+  addDimension(k_currentRepresentatives);
+  addDimension(k_temperatureRepresentatives);
+  addDimension(k_amountOfSubstanceRepresentatives);
+  addDimension(k_luminousIntensityRepresentatives);
+  addDimension(k_frequencyRepresentatives);
+  addDimension(k_forceRepresentatives);
+  addDimension(k_pressureRepresentatives);
+  addDimension(k_energyRepresentatives);
+  addDimension(k_powerRepresentatives);
+  addDimension(k_electricChargeRepresentatives);
+  addDimension(k_electricPotentialRepresentatives);
+  addDimension(k_electricCapacitanceRepresentatives);
+  addDimension(k_electricResistanceRepresentatives);
+  addDimension(k_electricConductanceRepresentatives);
+  addDimension(k_magneticFluxRepresentatives);
+  addDimension(k_magneticFieldRepresentatives);
+  addDimension(k_inductanceRepresentatives);
+  addDimension(k_catalyticActivityRepresentatives);
+  addDimension(k_surfaceRepresentatives);
+  addDimension(k_volumeRepresentatives);
+  // The speed representative cannot be parsed
+  assert(dimension == Representative::k_numberOfDimensions - 1);
+  return index;
+}();
+
 Unit Unit::Builder(const Unit::Representative* representative,
                    const Prefix* prefix) {
   void* bufferNode = TreePool::sharedPool->alloc(sizeof(UnitNode));
@@ -1135,8 +1182,12 @@ bool Unit::CanParse(const char* symbol, size_t length,
     symbol++;
     length--;
   }
-  for (int i = 0; i < Representative::k_numberOfDimensions; i++) {
-    if (Representative::DefaultRepresentatives()[i]->canParseWithEquivalents(
+  // Only walk the dimensions with a root symbol ending like symbol
+  uint32_t dimensions = s_symbolIndex.categoriesOf(symbol, length);
+  for (int i = 0; dimensions != 0; i++, dimensions >>= 1) {
+    assert(i < Representative::k_numberOfDimensions);
+    if ((dimensions & 1) &&
+        Representative::DefaultRepresentatives()[i]->canParseWithEquivalents(
             symbol, length, representative, prefix)) {
       return true;
     }
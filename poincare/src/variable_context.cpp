@@ -35,6 +35,18 @@ bool VariableContext::setExpressionForSymbolAbstract(
   return ContextWithParent::setExpressionForSymbolAbstract(expression, symbol);
 }
 
+bool VariableContext::scalarApproximationForSymbol(
+    const char* name, const ApproximationContext& approximationContext,
+    bool doublePrecision, std::complex<double>* value) {
+  if (m_name != nullptr && strcmp(name, m_name) == 0) {
+    // The variable hides the parent's symbol of the same name
+    return false;
+  }
+  assert(parentContext());
+  return parentContext()->scalarApproximationForSymbol(
+      name, approximationContext, doublePrecision, value);
+}
+
 const Expression VariableContext::protectedExpressionForSymbolAbstract(
     const SymbolAbstract& symbol, bool clone,
     ContextWithParent* lastDescendantContext) {
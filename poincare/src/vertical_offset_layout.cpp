@@ -126,7 +126,12 @@ bool VerticalOffsetLayoutNode::setEmptyVisibility(EmptyRectangle::State state) {
     return false;
   }
   m_emptyBaseVisibility = state;
-  return baseLayout() == nullptr;  // Return true if empty is displayed
+  if (baseLayout() != nullptr) {
+    return false;
+  }
+  // The empty base is displayed or hidden
+  invalidSizesPositionsAndBaselinesUpToRoot();
+  return true;
 }
 
 KDSize VerticalOffsetLayoutNode::computeSize(KDFont::Size font) {
@@ -0,0 +1,162 @@
+#include <assert.h>
+#include <ion/circuit_breaker.h>
+#include <poincare/preferences.h>
+#include <poincare/tree_pool.h>
+#include <poincare/worker_pool.h>
+
+#if POINCARE_WORKER_POOL
+#include <omg/global_box.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace Poincare {
+
+#if POINCARE_WORKER_POOL
+
+namespace {
+
+struct Batch {
+  WorkerPool::Job job;
+  void* context;
+  // The jobs of the round in [nextJob, endJob)
+  int endJob;
+  std::atomic<int> nextJob;
+  // The jobs run with the preferences of the session that runs the batch
+  const Preferences* preferences;
+};
+
+/* The workers wait for a new generation of jobs. Run waits until each of them
+ * is done with the batch, which lives on the stack of Run. */
+struct State {
+  std::mutex mutex;
+  std::condition_variable newBatch;
+  std::condition_variable batchDone;
+  // Held by the thread whose batch is on the workers
+  std::mutex runMutex;
+  Batch* batch = nullptr;
+  unsigned int generation = 0;
+  int numberOfBusyWorkers = 0;
+};
+
+/* The state is never destroyed: the detached workers still wait on its
+ * condition variable when the process exits. */
+OMG::GlobalBox<State> s_state;
+std::once_flag s_workersStarted;
+int s_numberOfWorkers = 0;
+
+void WorkerMain() {
+  TreePool::sharedPool.init();
+  Preferences::sharedPreferences.init();
+  unsigned int generation = 0;
+  std::unique_lock<std::mutex> lock(s_state->mutex);
+  while (true) {
+    s_state->newBatch.wait(
+        lock, [&generation] { return s_state->generation != generation; });
+    generation = s_state->generation;
+    Batch* batch = s_state->batch;
+    lock.unlock();
+    *Preferences::sharedPreferences.get() = *batch->preferences;
+    int index;
+    while ((index = batch->nextJob++) < batch->endJob) {
+      batch->job(index, batch->context);
+    }
+    lock.lock();
+    if (--s_state->numberOfBusyWorkers == 0) {
+      s_state->batchDone.notify_one();
+    }
+  }
+}
+
+void StartWorkers() {
+  int numberOfWorkers = std::min<int>(std::thread::hardware_concurrency(),
+                                      WorkerPool::k_maxNumberOfWorkers);
+  if (numberOfWorkers < 2) {
+    // A single worker would only leave the calling thread waiting
+    return;
+  }
+  s_state.init();
+  for (int i = 0; i < numberOfWorkers; i++) {
+    std::thread(WorkerMain).detach();
+  }
+  s_numberOfWorkers = numberOfWorkers;
+}
+
+void RunOnThisThread(int firstJob, int endJob, WorkerPool::Job job,
+                     void* context) {
+  for (int i = firstJob; i < endJob; i++) {
+    job(i, context);
+  }
+}
+
+// Returns false if the workers were busy with the batch of another thread
+bool RunRoundOnWorkers(int firstJob, int endJob, WorkerPool::Job job,
+                       void* context) {
+  /* The workers are shared by the sessions of the process. While they work
+   * for another thread, or if a job runs a batch itself, the jobs run on the
+   * calling thread. */
+  std::unique_lock<std::mutex> running(s_state->runMutex, std::try_to_lock);
+  if (!running.owns_lock()) {
+    return false;
+  }
+  Batch batch = {job, context, endJob, {firstJob},
+                 Preferences::sharedPreferences};
+  std::unique_lock<std::mutex> lock(s_state->mutex);
+  assert(!s_state->batch && s_state->numberOfBusyWorkers == 0);
+  s_state->batch = &batch;
+  s_state->numberOfBusyWorkers = s_numberOfWorkers;
+  s_state->generation++;
+  s_state->newBatch.notify_all();
+  s_state->batchDone.wait(lock,
+                          [] { return s_state->numberOfBusyWorkers == 0; });
+  s_state->batch = nullptr;
+  return true;
+}
+
+}  // namespace
+
+int WorkerPool::NumberOfWorkers() {
+  // The sessions of several threads may need the workers at the same time
+  std::call_once(s_workersStarted, StartWorkers);
+  return s_numberOfWorkers;
+}
+
+void WorkerPool::Run(int numberOfJobs, Job job, void* context) {
+  if (numberOfJobs <= 1 || NumberOfWorkers() == 0) {
+    RunOnThisThread(0, numberOfJobs, job, context);
+    return;
+  }
+  /* If the calling thread jumped to a checkpoint of the circuit breaker while
+   * waiting, the workers would be left with a batch on a stack that no longer
+   * exists, and with the mutexes locked. The circuit breaker is locked while
+   * the workers run a round of one job each, so that an interruption is only
+   * loaded between two rounds, once the workers are done with the batch. */
+  for (int firstJob = 0; firstJob < numberOfJobs;
+       firstJob += s_numberOfWorkers) {
+    int endJob = std::min(firstJob + s_numberOfWorkers, numberOfJobs);
+    Ion::CircuitBreaker::lock();
+    bool ranOnWorkers = RunRoundOnWorkers(firstJob, endJob, job, context);
+    Ion::CircuitBreaker::unlock();
+    if (!ranOnWorkers) {
+      RunOnThisThread(firstJob, endJob, job, context);
+    }
+  }
+}
+
+#else
+
+int WorkerPool::NumberOfWorkers() { return 0; }
+
+void WorkerPool::Run(int numberOfJobs, Job job, void* context) {
+  for (int i = 0; i < numberOfJobs; i++) {
+    job(i, context);
+  }
+}
+
+#endif
+
+}  // namespace Poincare
@@ -1,7 +1,13 @@
 #include <apps/shared/global_context.h>
+#include <poincare/approximation_dispatch.h>
 #include <poincare/constant.h>
 #include <poincare/infinity.h>
+#include <poincare/integral.h>
 #include <poincare/undefined.h>
+#include <poincare/worker_pool.h>
+
+#include <atomic>
+#include <iterator>
 
 #include "helper.h"
 
@@ -2134,6 +2140,47 @@ QUIZ_CASE(poincare_approximation_lists_functions) {
   assert_expression_approximates_to<double>("max({1,7,i})", Undefined::Name());
   assert_expression_approximates_to_scalar<double>("sum({1,2,3})", 6.);
   assert_expression_approximates_to_scalar<double>("prod({1,4,9})", 36.);
+  // Real sums are compensated
+  assert_expression_approximates_to_scalar<double>("sum({10^16,1,-10^16})",
+                                                   1.);
+  assert_expression_approximates_to<double>("sum({1,2,i,3})", "6+i");
+  assert_expression_approximates_to<double>("sum({1,undef,3})",
+                                            Undefined::Name());
+  assert_expression_approximates_to<double>("sum({inf,1})", "∞");
+  assert_expression_approximates_to<double>("sum({inf,-inf})",
+                                            Undefined::Name());
+  assert_expression_approximates_to<double>("prod({2,i,3})", "6×i");
+  assert_expression_approximates_to<double>("prod({[[1]],2})",
+                                            Undefined::Name());
+}
+
+QUIZ_CASE(poincare_approximation_dense_kernels) {
+  // Lists of a hundred real elements
+  assert_expression_approximates_to_scalar<double>(
+      "mean(sequence(1/k,k,100))", 0.051873775176396206);
+  assert_expression_approximates_to_scalar<double>(
+      "mean(sequence(rem(37k,101),k,100))", 50.5);
+  assert_expression_approximates_to_scalar<double>(
+      "med(sequence(rem(37k,101),k,100))", 50.5);
+  assert_expression_approximates_to_scalar<double>(
+      "var(sequence(rem(37k,101),k,100))", 833.25);
+  assert_expression_approximates_to<double>(
+      "sort(sequence(rem(37k,10),k,12))", "{0,1,2,3,4,4,5,6,7,7,8,9}");
+  assert_expression_approximates_to<float>(
+      "sort(sequence(rem(37k,10),k,12))", "{0,1,2,3,4,4,5,6,7,7,8,9}");
+  // Ten by ten real matrices
+  assert_expression_approximates_to<double>("det(2×identity(10))", "1024");
+  assert_expression_approximates_to<float>("det(2×identity(10))", "1024");
+  assert_expression_approximates_to<double>(
+      "det(inverse(2×identity(10)))", "9.765625ᴇ-4");
+  assert_expression_approximates_to<double>(
+      "det((2×identity(10))×(3×identity(10)))", "60466176");
+  assert_expression_approximates_to<double>("[[1,2][3,4]]×[[5,6][7,8]]",
+                                            "[[19,22][43,50]]");
+  assert_expression_approximates_to<double>("[[1,i][3,4]]×[[5,6][7,8]]",
+                                            "[[5+7×i,6+8×i][43,50]]");
+  // The determinant picks the biggest pivot
+  assert_expression_approximates_to<double>("det([[10^-20,1][1,1]])", "-1");
 }
 
 QUIZ_CASE(poincare_approximation_mixed_fraction) {
@@ -2216,6 +2263,259 @@ QUIZ_CASE(poincare_approximation_point) {
                                             "{(3,7),(11,15)}");
 }
 
+template <typename T>
+void assert_expression_approximates_to_complex(
+    const char *expression, bool isScalar,
+    Preferences::ComplexFormat complexFormat = Cartesian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  ApproximationContext approximationContext(&globalContext, complexFormat,
+                                            Radian);
+  std::complex<T> c;
+  quiz_assert_print_if_failure(
+      e.approximateToComplex<T>(approximationContext, &c) == isScalar,
+      expression);
+  if (!isScalar) {
+    return;
+  }
+  // The value must be the one of the Evaluation
+  Expression::SetEncounteredComplex(false);
+  Evaluation<T> evaluation =
+      static_cast<ExpressionNode *>(static_cast<TreeHandle &>(e).node())
+          ->approximate(T(), approximationContext);
+  quiz_assert_print_if_failure(
+      evaluation.type() == EvaluationNode<T>::Type::Complex, expression);
+  std::complex<T> expected = evaluation.complexAtIndex(0);
+  if (complexFormat == Preferences::ComplexFormat::Real &&
+      Expression::EncounteredComplex()) {
+    expected = complexNAN<T>();
+  }
+  quiz_assert_print_if_failure(
+      (c.real() == expected.real() ||
+       (std::isnan(c.real()) && std::isnan(expected.real()))) &&
+          (c.imag() == expected.imag() ||
+           (std::isnan(c.imag()) && std::isnan(expected.imag()))),
+      expression);
+}
+
+QUIZ_CASE(poincare_approximation_to_complex) {
+  assert_expression_approximates_to_complex<double>("(2+3i)^5×e^(iπ/3)", true);
+  assert_expression_approximates_to_complex<float>("(2+3i)^5×e^(iπ/3)", true);
+  assert_expression_approximates_to_complex<double>(
+      "-(1.5-2/3)×√(-4)+ln(-1)-arg(i)", true);
+  assert_expression_approximates_to_complex<double>("sin(π)+cos(π/2)", true);
+  assert_expression_approximates_to_complex<double>(
+      "abs(3+4i)+re(conj(i))+im(2-i)", true);
+  assert_expression_approximates_to_complex<double>("(1+undef)×2", true);
+  assert_expression_approximates_to_complex<double>("1/0", true);
+  assert_expression_approximates_to_complex<double>("(-8)^(1/3)", true,
+                                                    Real);
+  assert_expression_approximates_to_complex<double>("√(-1)+1", true, Real);
+  assert_expression_approximates_to_complex<double>("det([[1,2][3,4]])+1",
+                                                    true);
+  // Lists, matrices and points are not scalars
+  assert_expression_approximates_to_complex<double>("{1,2}+1", false);
+  assert_expression_approximates_to_complex<double>("2×[[1,2]]", false);
+  assert_expression_approximates_to_complex<double>("(1,2)", false);
+  assert_expression_approximates_to_complex<double>("sin({1,2})", false);
+
+  // A symbol defined as a list is not a scalar either
+  assert_reduce_and_store("{3,1,2}→L");
+  Shared::GlobalContext globalContext;
+  quiz_assert(parse_expression("2×L+1", &globalContext, false)
+                  .approximationMayNotBeScalar(&globalContext));
+  quiz_assert(parse_expression("sort(L)", &globalContext, false)
+                  .approximationMayNotBeScalar(&globalContext));
+  quiz_assert(!parse_expression("2×a+1", &globalContext, false)
+                   .approximationMayNotBeScalar(&globalContext));
+  assert_expression_approximates_to_complex<double>("2×L+1", false);
+  assert_expression_approximates_to<double>("2×L+1", "{7,3,5}");
+  assert_expression_approximates_to<double>("sort(L)+sin(0)", "{1,2,3}");
+  assert_expression_approximates_to<double>("mean(L)+1", "3");
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("L.lis").destroy();
+}
+
+template <typename T>
+static bool approximates_identically(const ExpressionNode *node,
+                                     const ApproximationContext &context) {
+  std::complex<T> dispatched, virtualResult;
+  bool isScalar = ApproximationDispatch::ApproximateToComplex<T>(
+      node, context, &dispatched);
+  if (isScalar != node->approximateToComplex(context, &virtualResult)) {
+    return false;
+  }
+  return !isScalar || ((dispatched.real() == virtualResult.real() ||
+                        (std::isnan(dispatched.real()) &&
+                         std::isnan(virtualResult.real()))) &&
+                       (dispatched.imag() == virtualResult.imag() ||
+                        (std::isnan(dispatched.imag()) &&
+                         std::isnan(virtualResult.imag()))));
+}
+
+QUIZ_CASE(poincare_approximation_dispatch) {
+  /* Approximate inputs of this file through the type switch of
+   * ApproximationDispatch and through the virtual approximateToComplex of the
+   * nodes. The results must be identical, only the time can differ, which is
+   * measured by benchmark.bin. */
+  constexpr const char *k_corpus[] = {
+      "(2+3i)^5×e^(iπ/3)",
+      "-(1.5-2/3)×√(-4)+ln(-1)-arg(i)",
+      "sin(π)+cos(π/2)",
+      "abs(3+4i)+re(conj(i))+im(2-i)",
+      "3×cos(2π/5)+√(2)",
+      "1/(1+1/(1+1/(1+1/(1+1/2))))",
+      "1+2×3-4/5+6×7-8/9+(1.5-2.5)×(3-4)/(5+6)-7×8+9/10+11×12-13/14",
+      "2^(1/2)×3^(1/3)×5^(1/5)",
+      "arcsin(0.5)+arccos(0.2)+arctan(7)",
+      "tan(1.2)^2-1/cos(1.2)^2",
+      "ln(2)+log(2)-√(-2)",
+      "(1+undef)×2",
+      "1/0",
+      "{1,2}+1",
+  };
+  constexpr int k_numberOfExpressions = std::size(k_corpus);
+  Shared::GlobalContext globalContext;
+  Expression expressions[k_numberOfExpressions];
+  ExpressionNode *nodes[k_numberOfExpressions];
+  for (int i = 0; i < k_numberOfExpressions; i++) {
+    expressions[i] = parse_expression(k_corpus[i], &globalContext, false);
+    nodes[i] = static_cast<ExpressionNode *>(
+        static_cast<TreeHandle &>(expressions[i]).node());
+  }
+  for (Preferences::ComplexFormat complexFormat : {Cartesian, Real}) {
+    ApproximationContext context(&globalContext, complexFormat, Radian);
+    for (int i = 0; i < k_numberOfExpressions; i++) {
+      quiz_assert_print_if_failure(
+          approximates_identically<float>(nodes[i], context) &&
+              approximates_identically<double>(nodes[i], context),
+          k_corpus[i]);
+    }
+  }
+}
+
+QUIZ_CASE(poincare_approximation_with_values_for_symbol) {
+  /* The batch is split among the workers of the WorkerPool when there are
+   * some, and must give the very same values as one approximation per value.
+   */
+  constexpr const char *k_corpus[] = {
+      "x^2×sin(x)+ln(x)",
+      "√(x)-3/x",
+      "piecewise(-x,x<0,x^(1/3))",
+      "floor(x)+arctan(x)^2",
+      "int(t^2,t,0,x)",
+      "x+y",
+  };
+  constexpr int k_numberOfValues = 1000;
+  Shared::GlobalContext globalContext;
+  float values[k_numberOfValues];
+  float results[k_numberOfValues];
+  for (int i = 0; i < k_numberOfValues; i++) {
+    values[i] = -10.f + 20.f * i / k_numberOfValues;
+  }
+  ApproximationContext context(&globalContext, Real, Radian);
+  for (const char *expression : k_corpus) {
+    Expression e = parse_expression(expression, &globalContext, false);
+    e.approximateWithValuesForSymbol<float>("x", values, results,
+                                            k_numberOfValues, context);
+    for (int i = 0; i < k_numberOfValues; i++) {
+      float expected =
+          e.approximateWithValueForSymbol<float>("x", values[i], context);
+      quiz_assert_print_if_failure(
+          results[i] == expected ||
+              (std::isnan(results[i]) && std::isnan(expected)),
+          expression);
+    }
+  }
+}
+
+static void record_job(int index, void *context) {
+  static_cast<std::atomic<int> *>(context)[index]++;
+}
+
+QUIZ_CASE(poincare_worker_pool_runs_every_job) {
+  /* The jobs run in rounds of one job per worker, and the number of jobs is
+   * not a multiple of the number of workers so that the last round is not
+   * full. */
+  constexpr int k_numberOfJobs = 37;
+  std::atomic<int> numberOfRuns[k_numberOfJobs] = {};
+  WorkerPool::Run(k_numberOfJobs, record_job, numberOfRuns);
+  for (int i = 0; i < k_numberOfJobs; i++) {
+    quiz_assert(numberOfRuns[i] == 1);
+  }
+}
+
+QUIZ_CASE(poincare_approximation_integral_panel_cache) {
+  /* While the upper bound moves, as with the cursor of the graph, the panels
+   * of the grid are only integrated once, and the integrals stay within the
+   * tolerance of the quadrature. */
+  constexpr const char *k_integrands[] = {
+      "x^2", "sin(x)", "√(abs(x))", "1/(1+25x^2)", "e^(-x^2)×cos(3x)",
+  };
+  constexpr int k_numberOfIntegrands = std::size(k_integrands);
+  constexpr double k_start = -1.3;
+  constexpr double k_gridStep = 0.5;
+  constexpr int k_numberOfSteps = 60;
+  Shared::GlobalContext globalContext;
+  ApproximationContext context(&globalContext, Real, Radian);
+  IntegralPanelCache cache;
+  for (int k = 0; k < k_numberOfIntegrands; k++) {
+    Expression f = parse_expression(k_integrands[k], &globalContext, false);
+    for (int i = 0; i < k_numberOfSteps; i++) {
+      Integral integral = Integral::Builder(
+          f.clone(), Symbol::Builder('x'), Float<double>::Builder(k_start),
+          Float<double>::Builder(k_start + 0.1 * (i - 10)));
+      double expected = integral.approximateToScalar<double>(context);
+      double result =
+          integral.approximateWithPanelCache(&cache, k_gridStep, context);
+      quiz_assert_print_if_failure(
+          std::fabs(result - expected) <= 1e-9 * (1.0 + std::fabs(expected)),
+          k_integrands[k]);
+    }
+    // Integrals over more panels than the cache holds do not use it
+    for (double end :
+         {k_start + 15.5 * k_gridStep, k_start + 40 * k_gridStep}) {
+      Integral integral = Integral::Builder(
+          f.clone(), Symbol::Builder('x'), Float<double>::Builder(k_start),
+          Float<double>::Builder(end));
+      double expected = integral.approximateToScalar<double>(context);
+      double result =
+          integral.approximateWithPanelCache(&cache, k_gridStep, context);
+      quiz_assert_print_if_failure(
+          std::fabs(result - expected) <= 1e-9 * (1.0 + std::fabs(expected)),
+          k_integrands[k]);
+    }
+  }
+
+  // Singularities on the bounds go through tanh-sinh quadrature
+  struct HardIntegral {
+    const char *expression;
+    double value;
+  };
+  constexpr HardIntegral k_hardIntegrals[] = {
+      {"int(1/√(x),x,0,1)", 2.0},
+      {"int(ln(x)^2,x,0,1)", 2.0},
+      {"int(1/√(x)+1/√(1-x),x,0,1)", 4.0},
+      {"int(ln(x)×√(x),x,0,1)", -4.0 / 9.0},
+      {"int(2/√(1-x^2),x,0,1)", M_PI},
+  };
+  for (HardIntegral hardIntegral : k_hardIntegrals) {
+    Expression e =
+        parse_expression(hardIntegral.expression, &globalContext, false);
+    double result = e.approximateToScalar<double>(context);
+    quiz_assert_print_if_failure(
+        std::fabs(result - hardIntegral.value) <=
+            1e-6 * std::fabs(hardIntegral.value),
+        hardIntegral.expression);
+  }
+  // The panels are not used on integrals with singular bounds
+  Expression singular =
+      parse_expression("int(1/√(x),x,0,1)", &globalContext, false);
+  quiz_assert(std::fabs(static_cast<Integral &>(singular)
+                            .approximateWithPanelCache(&cache, k_gridStep,
+                                                       context) -
+                        2.0) < 1e-6);
+}
+
 QUIZ_CASE(poincare_approximation_keeping_symbols) {
   assert_expression_approximates_keeping_symbols_to("ln(10)+cos(10)+3x",
                                                     "3×x+3.287392846");
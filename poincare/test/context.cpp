@@ -2,6 +2,7 @@
 #include <poincare/addition.h>
 #include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/store.h>
 #include <poincare/subtraction.h>
 #include <poincare/undefined.h>
 
@@ -247,6 +248,47 @@ QUIZ_CASE(poincare_context_function_evaluate_at_undef) {
   Ion::Storage::FileSystem::sharedFileSystem->recordNamed("g.func").destroy();
 }
 
+QUIZ_CASE(poincare_context_cached_approximations) {
+  assert_reduce_and_store("2→a");
+  assert_reduce_and_store("3→b");
+  assert_reduce_and_store("a×x+b→f(x)");
+  assert_reduce_and_store("2i→c");
+
+  Shared::GlobalContext globalContext;
+  ApproximationContext approximationContext(&globalContext, Cartesian, Radian);
+  Expression e = parse_expression("f(x)+a", &globalContext, false);
+  // The values of a and b are cached after the first evaluation
+  for (int i = 0; i < 10; i++) {
+    quiz_assert(e.approximateWithValueForSymbol<double>(
+                    "x", i, approximationContext) == 2 * i + 5);
+    quiz_assert(e.approximateWithValueForSymbol<float>(
+                    "x", i, approximationContext) == 2 * i + 5);
+  }
+
+  // Storing a variable invalidates the cache
+  Expression store = parse_expression("5→a", &globalContext, false);
+  static_cast<Store &>(store).storeValueForSymbol(&globalContext);
+  quiz_assert(e.approximateWithValueForSymbol<double>(
+                  "x", 1., approximationContext) == 13.);
+
+  // A local variable hides the cached value
+  assert_parsed_expression_approximates_with_value_for_symbol(
+      parse_expression("a+1", &globalContext, false), "a", 10., 11.);
+
+  // Values are cached for each complex format
+  Expression c = parse_expression("c^2", &globalContext, false);
+  quiz_assert(c.approximateToScalar<double>(approximationContext) == -4.);
+  ApproximationContext realApproximationContext(&globalContext, Real, Radian);
+  quiz_assert(
+      std::isnan(c.approximateToScalar<double>(realApproximationContext)));
+  quiz_assert(c.approximateToScalar<double>(approximationContext) == -4.);
+
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("a.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("b.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("c.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("f.func").destroy();
+}
+
 template void assert_parsed_expression_approximates_with_value_for_symbol(
     Poincare::Expression, const char *, float, float,
     Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
@@ -1,5 +1,7 @@
+#include <apps/shared/global_context.h>
 #include <ion/storage/file_system.h>
 #include <poincare/derivative.h>
+#include <poincare/derivative_tape.h>
 #include <poincare/nonreal.h>
 #include <poincare/undefined.h>
 
@@ -217,3 +219,87 @@ QUIZ_CASE(poincare_derivative_approximation_higher_order) {
   // Order 5 and above are not handled because recursively too long
   assert_approximate_to("diff(e^(2x),x,0,5)", Undefined::Name());
 }
+
+void assert_tape_evaluates_to(const char* expression, double x, double value,
+                              double firstDerivative, double secondDerivative,
+                              Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  DerivativeTape tape;
+  quiz_assert_print_if_failure(
+      tape.compile(e, "x", ApproximationContext(&context, Real, angleUnit)),
+      expression);
+  DerivativeTape::Jet<double> jet;
+  quiz_assert_print_if_failure(tape.evaluate<double>(x, &jet), expression);
+  constexpr double precision = 1e-14;
+  quiz_assert_print_if_failure(
+      roughly_equal(jet.value, value, precision), expression);
+  quiz_assert_print_if_failure(
+      roughly_equal(jet.firstDerivative, firstDerivative, precision),
+      expression);
+  quiz_assert_print_if_failure(
+      roughly_equal(jet.secondDerivative, secondDerivative, precision),
+      expression);
+}
+
+void assert_tape_does_not_evaluate(const char* expression, double x) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  DerivativeTape tape;
+  DerivativeTape::Jet<double> jet;
+  quiz_assert_print_if_failure(
+      !tape.compile(e, "x", ApproximationContext(&context, Real, Radian)) ||
+          !tape.evaluate<double>(x, &jet),
+      expression);
+}
+
+void assert_tape_derivatives_are_undefined(const char* expression, double x) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  DerivativeTape tape;
+  quiz_assert_print_if_failure(
+      tape.compile(e, "x", ApproximationContext(&context, Real, Radian)),
+      expression);
+  DerivativeTape::Jet<double> jet;
+  quiz_assert_print_if_failure(
+      !tape.evaluate<double>(x, &jet) || (std::isnan(jet.firstDerivative) &&
+                                          std::isnan(jet.secondDerivative)),
+      expression);
+}
+
+QUIZ_CASE(poincare_derivative_tape) {
+  assert_tape_evaluates_to("x", 3., 3., 1., 0.);
+  assert_tape_evaluates_to("x^3-2x+1", 2., 5., 10., 12.);
+  assert_tape_evaluates_to("(x-1)(x-2)(x-3)", 0., -6., 11., -12.);
+  assert_tape_evaluates_to("1/x", -2., -0.5, -0.25, -0.25);
+  assert_tape_evaluates_to("x^(-2)", 2., 0.25, -0.25, 0.375);
+  assert_tape_evaluates_to("-(x+1)/(x-1)", 3., -2., 0.5, -0.5);
+  assert_tape_evaluates_to("√(x)", 4., 2., 0.25, -1. / 32.);
+  assert_tape_evaluates_to("2^x", 0., 1., M_LN2, M_LN2 * M_LN2);
+  assert_tape_evaluates_to("x^x", 1., 1., 1., 2.);
+  assert_tape_evaluates_to("ln(x)", 2., M_LN2, 0.5, -0.25);
+  assert_tape_evaluates_to("log(x)", 10., 1., 0.1 / M_LN10,
+                           -0.01 / M_LN10);
+  assert_tape_evaluates_to("sin(x)", 0., 0., 1., 0.);
+  assert_tape_evaluates_to("cos(2x)", 0., 1., 0., -4.);
+  assert_tape_evaluates_to("sin(x)", 90., 1., 0., -M_PI * M_PI / 32400.,
+                           Degree);
+  assert_tape_evaluates_to("tan(x)", 0., 0., 1., 0.);
+  assert_tape_evaluates_to("arctan(x)", 1., M_PI_4, 0.5, -0.5);
+  assert_tape_evaluates_to("abs(x)", -3., 3., -1., 0.);
+  assert_tape_evaluates_to("e^(2x)", 0., 1., 2., 4.);
+
+  // Nodes without a tape instruction and values that are not real
+  assert_tape_does_not_evaluate("floor(x)", 1.5);
+  assert_tape_does_not_evaluate("random()×x", 1.);
+  assert_tape_does_not_evaluate("√(x)", -1.);
+
+  // Derivatives divided by zero are undefined, as with DivisionNode
+  assert_tape_derivatives_are_undefined("√(x)", 0.);
+  assert_tape_derivatives_are_undefined("ln(x)", 0.);
+  assert_tape_derivatives_are_undefined("log(x)", 0.);
+  assert_tape_derivatives_are_undefined("1/x", 0.);
+  assert_tape_derivatives_are_undefined("x^(-2)", 0.);
+  assert_tape_derivatives_are_undefined("√(x^2+1)-√(x)", 0.);
+  assert_tape_evaluates_to("x^2", 0., 0., 0., 2.);
+}
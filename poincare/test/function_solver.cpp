@@ -1,5 +1,9 @@
 #include <apps/shared/global_context.h>
+#include <poincare/exception_checkpoint.h>
+#include <poincare/rational.h>
 #include <poincare/solver.h>
+#include <poincare/solver_job.h>
+#include <poincare/tree_pool.h>
 
 #include "helper.h"
 
@@ -7,14 +11,12 @@ using namespace Poincare;
 
 typedef Solver<double>::Interest Interest;
 
-void assert_next_solution_is(const char* expression, Context* context,
-                             Solver<double>* solver,
+void assert_next_solution_is(const char* expression, Expression e,
+                             Context* context, Solver<double>* solver,
                              Coordinate2D<double> expected, Interest interest,
                              const char* otherExpression) {
   assert(std::isnan(expected.x()) == std::isnan(expected.y()));
 
-  Expression e = parse_expression(expression, context, false);
-
   Coordinate2D<double> observed;
   switch (interest) {
     case Interest::Root:
@@ -50,14 +52,23 @@ void assert_next_solution_is(const char* expression, Context* context,
 void assert_solutions_are(const char* expression, double start, double end,
                           std::initializer_list<Coordinate2D<double>> expected,
                           Interest interest, Preferences::AngleUnit angleUnit,
-                          const char* otherExpression) {
+                          const char* otherExpression,
+                          bool useDerivativeTape = false) {
   Shared::GlobalContext context;
   Solver<double> solver(start, end, "x", &context, Real, angleUnit);
+  Expression e = parse_expression(expression, &context, false);
+  DerivativeTape tape;
+  if (useDerivativeTape) {
+    quiz_assert_print_if_failure(
+        tape.compile(e, "x", ApproximationContext(&context, Real, angleUnit)),
+        expression);
+    solver.setDerivativeTape(&tape, e);
+  }
   for (Coordinate2D<double> c : expected) {
-    assert_next_solution_is(expression, &context, &solver, c, interest,
+    assert_next_solution_is(expression, e, &context, &solver, c, interest,
                             otherExpression);
   }
-  assert_next_solution_is(expression, &context, &solver,
+  assert_next_solution_is(expression, e, &context, &solver,
                           Coordinate2D<double>(NAN, NAN), interest,
                           otherExpression);
 }
@@ -181,6 +192,33 @@ QUIZ_CASE(poincare_solver_maxima) {
   assert_maxima_are("0.05/x+1.44×x^2", 7., -7., {});
 }
 
+QUIZ_CASE(poincare_solver_derivative_tape) {
+  // Newton's method on the tape finds the same solutions as Brent's methods
+  assert_solutions_are("x^2-4", -5., 100., {R(-2.), R(2.)}, Interest::Root,
+                       Degree, nullptr, true);
+  assert_solutions_are("cos(x)", 500., 0., {R(450.), R(270.), R(90.)},
+                       Interest::Root, Degree, nullptr, true);
+  assert_solutions_are("x^3-2x-5", -10., 10., {R(2.0945514815423265)},
+                       Interest::Root, Degree, nullptr, true);
+  assert_solutions_are("cos(x)", 0., 300., {XY(180., -1.)},
+                       Interest::LocalMinimum, Degree, nullptr, true);
+  assert_solutions_are("(x^2+x+1)/x", -2., 2., {XY(1., 3.)},
+                       Interest::LocalMinimum, Degree, nullptr, true);
+  assert_solutions_are("x^3+200/x", -6., 6.,
+                       {XY(2.8574404375160141, 93.323613642148885)},
+                       Interest::LocalMinimum, Degree, nullptr, true);
+  assert_solutions_are("5+4/sin(x)-2/tan(x)", -10., 10.,
+                       {XY(-7.3303828071957247, 1.5358983848622398),
+                        XY(-1.0471975566950564, 1.5358983848622398),
+                        XY(5.2359877779725741, 1.5358983848622398)},
+                       Interest::LocalMaximum, Radian, nullptr, true);
+  assert_solutions_are("(x^2+x+1)/x", -2., 2., {XY(-1., -1.)},
+                       Interest::LocalMaximum, Degree, nullptr, true);
+  // The tape is not used where the expression is not real
+  assert_solutions_are("√(x)-x", -10., 10., {R(0.), R(1.)}, Interest::Root,
+                       Degree, nullptr, true);
+}
+
 QUIZ_CASE(poincare_solver_intersections) {
   assert_intersections_are("cos(x)", "2", -1., 500., {});
   assert_intersections_are("cos(x)", "1", 500., -1, {XY(360., 1.), XY(0., 1.)});
@@ -195,3 +233,102 @@ QUIZ_CASE(poincare_solver_intersections) {
    * around -1.479, which was the case at some point in history. */
   assert_intersections_are("x^(2x^92)", "3", -1.5, -1.47, {});
 }
+
+// Job that ends its slice after each of its steps, like an animation
+class SlicedJob : public Job {
+ public:
+  constexpr static int k_numberOfSteps = 3;
+  float progress() const override {
+    return static_cast<float>(m_numberOfSteps) / k_numberOfSteps;
+  }
+  int numberOfSteps() const { return m_numberOfSteps; }
+
+ private:
+  bool step() override {
+    m_numberOfSteps++;
+    endSlice();
+    return m_numberOfSteps == k_numberOfSteps;
+  }
+
+  int m_numberOfSteps = 0;
+};
+
+// Job whose step overflows the pool after creating a node
+class OverflowingJob : public Job {
+ public:
+  float progress() const override { return 0.f; }
+  TreeNode* endOfPoolBeforeStep() const { return m_endOfPoolBeforeStep; }
+  int numberOfNodesAfterRollBack() const {
+    return m_numberOfNodesAfterRollBack;
+  }
+  bool hasEnded() const { return m_hasEnded; }
+
+ private:
+  bool step() override {
+    // The handle is not destroyed since Raise jumps out of the step
+    Expression node = Rational::Builder(1);
+    ExceptionCheckpoint::Raise();
+    return true;
+  }
+  void didRollBackStep(TreeNode* endOfPoolBeforeStep) override {
+    m_endOfPoolBeforeStep = endOfPoolBeforeStep;
+    m_numberOfNodesAfterRollBack = TreePool::sharedPool->numberOfNodes();
+  }
+  void didEnd() override { m_hasEnded = true; }
+
+  TreeNode* m_endOfPoolBeforeStep = nullptr;
+  int m_numberOfNodesAfterRollBack = -1;
+  bool m_hasEnded = false;
+};
+
+QUIZ_CASE(poincare_solver_job) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression("cos(x)", &context, false);
+  constexpr int k_maxNumberOfSolutions = 2;
+  Coordinate2D<double> solutions[k_maxNumberOfSolutions];
+
+  // The search is stopped once the buffer is full
+  SolverJob job(Solver<double>(0., 1000., "x", &context, Real, Degree), e,
+                &Solver<double>::nextRoot, solutions, k_maxNumberOfSolutions);
+  quiz_assert(job.isRunning() && job.progress() == 0.f);
+  // A deadline in the past still lets the job advance by a step
+  quiz_assert(job.advance(0) == Job::Status::Running);
+  quiz_assert(job.numberOfSolutions() == 1 && job.progress() > 0.f);
+  quiz_assert(job.runUntilDone() == Job::Status::Completed);
+  quiz_assert(job.numberOfSolutions() == 2 && job.hasMoreSolutions());
+  constexpr double relativePrecision = Float<double>::EpsilonLax();
+  quiz_assert(
+      Helpers::RelativelyEqual(solutions[0].x(), 90., relativePrecision) &&
+      Helpers::RelativelyEqual(solutions[1].x(), 270., relativePrecision));
+  quiz_assert(job.progress() == 1.f);
+
+  SolverJob jobToEnd(Solver<double>(0., 300., "x", &context, Real, Degree), e,
+                     &Solver<double>::nextRoot, solutions,
+                     k_maxNumberOfSolutions);
+  quiz_assert(jobToEnd.runUntilDone() == Job::Status::Completed);
+  quiz_assert(jobToEnd.numberOfSolutions() == 2 &&
+              !jobToEnd.hasMoreSolutions());
+
+  SolverJob cancelledJob(
+      Solver<double>(0., 1000., "x", &context, Real, Degree), e,
+      &Solver<double>::nextRoot, solutions, k_maxNumberOfSolutions);
+  cancelledJob.cancel();
+  quiz_assert(cancelledJob.status() == Job::Status::Cancelled);
+  quiz_assert(cancelledJob.advance(UINT64_MAX) == Job::Status::Cancelled);
+  quiz_assert(cancelledJob.numberOfSolutions() == 0);
+
+  // A step that ends the slice stops advance, but not runUntilDone
+  SlicedJob slicedJob;
+  quiz_assert(slicedJob.advance(UINT64_MAX) == Job::Status::Running);
+  quiz_assert(slicedJob.numberOfSteps() == 1);
+  quiz_assert(slicedJob.runUntilDone() == Job::Status::Completed);
+  quiz_assert(slicedJob.numberOfSteps() == SlicedJob::k_numberOfSteps);
+
+  // The nodes of a rolled back step are freed before didRollBackStep
+  OverflowingJob overflowingJob;
+  int numberOfNodes = TreePool::sharedPool->numberOfNodes();
+  quiz_assert(overflowingJob.advance(UINT64_MAX) == Job::Status::Failed);
+  quiz_assert(overflowingJob.endOfPoolBeforeStep() != nullptr);
+  quiz_assert(overflowingJob.numberOfNodesAfterRollBack() == numberOfNodes);
+  quiz_assert(overflowingJob.hasEnded());
+}
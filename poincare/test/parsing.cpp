@@ -579,6 +579,31 @@ QUIZ_CASE(poincare_parsing_units) {
     }
   }
 
+  // Every alias can be parsed with any of its input prefixes
+  for (int i = 0; i < Unit::Representative::k_numberOfDimensions; i++) {
+    const Unit::Representative* dim =
+        Unit::Representative::DefaultRepresentatives()[i];
+    for (int j = 0; j < dim->numberOfRepresentatives(); j++) {
+      const Unit::Representative* rep =
+          dim->representativesOfSameDimension() + j;
+      for (const char* alias : rep->rootSymbols()) {
+        for (size_t k = 0; k < Unit::Prefix::k_numberOfPrefixes; k++) {
+          const Unit::Prefix* pre = Unit::Prefix::Prefixes() + k;
+          if (rep->isInputPrefixable() ? !rep->canPrefix(pre, true)
+                                       : pre != Unit::Prefix::EmptyPrefix()) {
+            continue;
+          }
+          constexpr static size_t bufferSize = 10;
+          char buffer[bufferSize];
+          size_t length = strlcpy(buffer, pre->symbol(), bufferSize);
+          length += strlcpy(buffer + length, alias, bufferSize - length);
+          quiz_assert_print_if_failure(
+              Unit::CanParse(buffer, length, nullptr, nullptr), buffer);
+        }
+      }
+    }
+  }
+
   // Non-existing units are not parsable
   assert_text_not_parsable("_n");
   assert_text_not_parsable("_a");
@@ -1611,3 +1636,28 @@ QUIZ_CASE(poincare_parsing_piecewise) {
   assert_text_not_parsable("piecewise(-1,undef,i)");
   assert_text_not_parsable("piecewise(4^2,undef,6,4>2)");
 }
+
+QUIZ_CASE(poincare_parsing_identifiers_corpus) {
+  /* Typical inputs of the apps, which split identifiers into reserved names
+   * and units. benchmark.bin times the parsing of the same corpus. */
+  constexpr const char* k_corpus[] = {
+      "3×cos(2π/5)+√(2)",
+      "abcdefghij",
+      "xyzt^2+tanh(x)-arcsin(y)",
+      "int(e^(-x^2),x,0,∞)",
+      "_km/_h→_m/_s",
+      "5_kg×9.81_m/_s^2",
+      "binompdf(3,10,0.2)+normcdf(1,0,1)",
+      "sum(k^2,k,1,n)",
+      "[[1,2][3,4]]^-1",
+      "log(ab)+ln(cd)+exp(ef)",
+      "{1,2,3}+mean({4,5,6})",
+      "piecewise(-x,x<0,x)",
+      "3km+2kg×5mA",
+  };
+  Shared::GlobalContext context;
+  for (const char* input : k_corpus) {
+    Expression e = Expression::Parse(input, &context);
+    quiz_assert_print_if_failure(!e.isUninitialized(), input);
+  }
+}
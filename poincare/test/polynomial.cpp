@@ -117,3 +117,67 @@ QUIZ_CASE(poincare_polynomial_roots_cubic) {
       {"3.687201ᴇ2", "-1.8486ᴇ2-3.196107ᴇ2×i", "-1.8486ᴇ2+3.196107ᴇ2×i"},
       "-6.82187ᴇ16", Cartesian);
 }
+
+template <int N>
+void assert_approximate_roots_of_polynomial_are(
+    const char* polynomial, const std::complex<double> (&roots)[N],
+    const char* symbol = "x") {
+  Shared::GlobalContext context;
+  ReductionContext reductionContext(&context, Cartesian, Radian,
+                                    MetricUnitFormat, SystemForApproximation);
+  ApproximationContext approximationContext(reductionContext);
+  Expression polynomialExp = parse_expression(polynomial, &context, false)
+                                 .cloneAndReduce(reductionContext);
+  int degree = polynomialExp.polynomialDegree(&context, symbol);
+  quiz_assert_print_if_failure(degree == N, polynomial);
+  std::complex<double> coefficients[Polynomial::k_maxApproximateDegree + 1];
+  std::complex<double> obtainedRoots[Polynomial::k_maxApproximateDegree];
+  quiz_assert_print_if_failure(
+      Polynomial::ApproximateCoefficients(polynomialExp, symbol, degree,
+                                          approximationContext, coefficients),
+      polynomial);
+  quiz_assert_print_if_failure(
+      Polynomial::ApproximateRoots(coefficients, degree, obtainedRoots) == N,
+      polynomial);
+  // Each expected root is matched with a distinct obtained root
+  bool matched[N] = {};
+  for (std::complex<double> root : roots) {
+    bool found = false;
+    for (int i = 0; i < N && !found; i++) {
+      if (!matched[i] && std::abs(obtainedRoots[i] - root) < 1e-6) {
+        matched[i] = found = true;
+      }
+    }
+    quiz_assert_print_if_failure(found, polynomial);
+  }
+}
+
+QUIZ_CASE(poincare_polynomial_roots_approximate) {
+  Shared::GlobalContext context;
+  ApproximationContext approximationContext(&context, Real, Radian);
+  std::complex<double> coefficients[4];
+  quiz_assert(Polynomial::ApproximateCoefficients(
+      parse_expression("(x+1)^3", &context, false), "x", 3,
+      approximationContext, coefficients));
+  const double binomials[] = {1., 3., 3., 1.};
+  for (int i = 0; i < 4; i++) {
+    quiz_assert(std::abs(coefficients[i] - binomials[i]) < 1e-12);
+  }
+
+  using namespace std::complex_literals;
+  assert_approximate_roots_of_polynomial_are("x^4-1", {1., -1., 1i, -1i});
+  assert_approximate_roots_of_polynomial_are("x^5", {0., 0., 0., 0., 0.});
+  assert_approximate_roots_of_polynomial_are(
+      "(x-1)(x-2)(x-3)(x-4)(x-5)(x-6)(x-7)", {1., 2., 3., 4., 5., 6., 7.});
+  assert_approximate_roots_of_polynomial_are("(x-1/2)^2×(x^2+4)",
+                                             {0.5, 0.5, 2i, -2i});
+  assert_approximate_roots_of_polynomial_are(
+      "x^3-i", {-1i, std::polar(1., M_PI / 6), std::polar(1., 5 * M_PI / 6)});
+  assert_approximate_roots_of_polynomial_are(
+      "x^6-10^12", {100., -100., std::polar(100., M_PI / 3),
+                    std::polar(100., 2 * M_PI / 3), std::polar(100., -M_PI / 3),
+                    std::polar(100., -2 * M_PI / 3)});
+  assert_approximate_roots_of_polynomial_are("2x^4-3x^2+1",
+                                             {-1., 1., -1. / std::sqrt(2.),
+                                              1. / std::sqrt(2.)});
+}
@@ -3,32 +3,63 @@
 #include <ion.h>
 
 #include "port.h"
+#include "profiler.h"
 extern "C" {
 #include "mphalport.h"
 }
 
-bool micropython_port_vm_hook_loop() {
-  /* This function is called very frequently by the MicroPython engine. We grab
-   * this opportunity to interrupt execution and/or refresh the display on
-   * platforms that need it. */
-
-  /* Doing too many things here slows down Python execution quite a lot. So we
-   * only do things once in a while and return as soon as possible otherwise. */
+int32_t micropython_port_vm_hook_countdown = 1;
 
-  static uint64_t t = Ion::Timing::millis();
+static bool refreshPrintAndInterruptIfNeeded(uint64_t time) {
+  /* We grab the opportunity of the VM hooks to interrupt execution and/or
+   * refresh the display on platforms that need it. Doing so too often slows
+   * down Python execution quite a lot, so it is only done once in a while. */
+  static uint64_t lastRefreshTime = time;
   constexpr static uint64_t delay = 100;
-
-  uint64_t t2 = Ion::Timing::millis();
-  if (t2 - t < delay) {
+  if (time - lastRefreshTime < delay) {
     return false;
   }
-  t = t2;
+  lastRefreshTime = time;
 
   micropython_port_vm_hook_refresh_print();
   // Check if the user asked for an interruption from the keyboard
   return micropython_port_interrupt_if_needed();
 }
 
+void micropython_port_vm_hook_tick(const _mp_code_state_t *codeState,
+                                   const uint8_t *ip) {
+  /* The length of the countdown of jumps is adjusted so that the ticks happen
+   * about every tickPeriod milliseconds, whatever the duration of a jump. It
+   * is capped low enough that a few hundred slow jumps cannot delay the
+   * next tick much, and it starts over when a tick came late, as when a fast
+   * loop is followed by slow iterations. */
+  static uint64_t lastTickTime = 0;
+  static int32_t numberOfJumpsPerTick = 1;
+  constexpr static uint64_t tickPeriod = 4;
+  constexpr static int32_t maxNumberOfJumpsPerTick = 1 << 8;
+
+  uint64_t time = Ion::Timing::millis();
+  uint64_t elapsedTime = time - lastTickTime;
+  if (2 * elapsedTime < tickPeriod &&
+      numberOfJumpsPerTick < maxNumberOfJumpsPerTick) {
+    numberOfJumpsPerTick *= 2;
+  } else if (elapsedTime > 2 * tickPeriod) {
+    numberOfJumpsPerTick = 1;
+  }
+  lastTickTime = time;
+  micropython_port_vm_hook_countdown = numberOfJumpsPerTick;
+
+  MicroPython::Profiler *profiler = MicroPython::Profiler::SharedProfiler();
+  if (profiler->isRunning()) {
+    profiler->recordSample(codeState, ip, time);
+  }
+  refreshPrintAndInterruptIfNeeded(time);
+}
+
+bool micropython_port_vm_hook_loop() {
+  return refreshPrintAndInterruptIfNeeded(Ion::Timing::millis());
+}
+
 void micropython_port_vm_hook_refresh_print() {
   assert(MicroPython::ExecutionEnvironment::currentExecutionEnvironment() !=
          nullptr);
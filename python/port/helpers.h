@@ -8,6 +8,14 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 
+struct _mp_code_state_t;
+
+/* Number of jumps of the VM left before micropython_port_vm_hook_tick is
+ * called by MICROPY_VM_HOOK_LOOP. */
+extern int32_t micropython_port_vm_hook_countdown;
+void micropython_port_vm_hook_tick(const struct _mp_code_state_t* codeState,
+                                   const uint8_t* ip);
+
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
 void micropython_port_vm_hook_refresh_print();
@@ -26,6 +26,7 @@
 
 #include "ulab_tools.h"
 #include "ndarray.h"
+#include "ndarray_contiguous.h"
 #include "ndarray_operators.h"
 #include "numpy/carray/carray.h"
 #include "numpy/carray/carray_tools.h"
@@ -1847,6 +1848,13 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         }
     }
 
+    #if NDARRAY_HAS_CONTIGUOUS_KERNELS
+    mp_obj_t contiguous_results = ndarray_contiguous_binary_op(op, lhs, rhs, ndim, shape);
+    if(contiguous_results != MP_OBJ_NULL) {
+        return contiguous_results;
+    }
+    #endif
+
     switch(op) {
         // first the in-place operators
         #if NDARRAY_HAS_INPLACE_ADD
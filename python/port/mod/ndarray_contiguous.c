@@ -0,0 +1,156 @@
+/*
+ * Kernels of the float arrays, whose elements are contiguous in memory.
+*/
+
+#include "py/runtime.h"
+#include "ndarray.h"
+#include "ndarray_contiguous.h"
+#include "ulab.h"
+
+#if NDARRAY_HAS_CONTIGUOUS_KERNELS
+
+bool ndarray_contiguous_is_float(ndarray_obj_t *ndarray) {
+    // returns true, if the array is of type float, and its elements follow each other
+    // in memory in the order of the indices. The stride of an axis of length 1 is ignored.
+    if(ndarray->dtype != NDARRAY_FLOAT) {
+        return false;
+    }
+    int32_t stride = ndarray->itemsize;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        if((ndarray->shape[i - 1] > 1) && (ndarray->strides[i - 1] != stride)) {
+            return false;
+        }
+        stride *= ndarray->shape[i - 1];
+    }
+    return true;
+}
+
+// a and b are the operands, when they are arrays, and lvalue and rvalue, when they are scalars
+#define CONTIGUOUS_BINARY_LOOP(r, a, b, lvalue, rvalue, len, lscalar, rscalar, OPERATOR)\
+({\
+    if(lscalar) {\
+        for(size_t i = 0; i < (len); i++) {\
+            (r)[i] = (lvalue) OPERATOR (b)[i];\
+        }\
+    } else if(rscalar) {\
+        for(size_t i = 0; i < (len); i++) {\
+            (r)[i] = (a)[i] OPERATOR (rvalue);\
+        }\
+    } else {\
+        for(size_t i = 0; i < (len); i++) {\
+            (r)[i] = (a)[i] OPERATOR (b)[i];\
+        }\
+    }\
+})
+
+mp_obj_t ndarray_contiguous_binary_op(mp_binary_op_t op, ndarray_obj_t *lhs, ndarray_obj_t *rhs, uint8_t ndim, size_t *shape) {
+    // returns MP_OBJ_NULL, if the operands are not suitable, and the generic loops have to be run
+    // Each operand must either be a contiguous float array with the shape of the result, or a scalar
+    // of any type, which is broadcast. At least one of the operands must be a float.
+    if((op != MP_BINARY_OP_ADD) && (op != MP_BINARY_OP_MULTIPLY) &&
+        (op != MP_BINARY_OP_SUBTRACT) && (op != MP_BINARY_OP_TRUE_DIVIDE)) {
+        return MP_OBJ_NULL;
+    }
+    if((lhs->dtype != NDARRAY_FLOAT) && (rhs->dtype != NDARRAY_FLOAT)) {
+        return MP_OBJ_NULL;
+    }
+    size_t len = 1;
+    for(uint8_t i = ULAB_MAX_DIMS - ndim; i < ULAB_MAX_DIMS; i++) {
+        len *= shape[i];
+    }
+    bool lscalar = (lhs->len == 1) && (len > 1);
+    bool rscalar = (rhs->len == 1) && (len > 1);
+    if((!lscalar && ((lhs->len != len) || !ndarray_contiguous_is_float(lhs))) ||
+        (!rscalar && ((rhs->len != len) || !ndarray_contiguous_is_float(rhs)))) {
+        return MP_OBJ_NULL;
+    }
+
+    ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+    mp_float_t *restrict rarray = (mp_float_t *)results->array;
+    const mp_float_t *restrict larray = (mp_float_t *)lhs->array;
+    const mp_float_t *restrict barray = (mp_float_t *)rhs->array;
+    mp_float_t lvalue = lscalar ? ndarray_get_float_value(lhs->array, lhs->dtype) : MICROPY_FLOAT_CONST(0.0);
+    mp_float_t rvalue = rscalar ? ndarray_get_float_value(rhs->array, rhs->dtype) : MICROPY_FLOAT_CONST(0.0);
+
+    if(op == MP_BINARY_OP_ADD) {
+        CONTIGUOUS_BINARY_LOOP(rarray, larray, barray, lvalue, rvalue, len, lscalar, rscalar, +);
+    } else if(op == MP_BINARY_OP_MULTIPLY) {
+        CONTIGUOUS_BINARY_LOOP(rarray, larray, barray, lvalue, rvalue, len, lscalar, rscalar, *);
+    } else if(op == MP_BINARY_OP_SUBTRACT) {
+        CONTIGUOUS_BINARY_LOOP(rarray, larray, barray, lvalue, rvalue, len, lscalar, rscalar, -);
+    } else {
+        CONTIGUOUS_BINARY_LOOP(rarray, larray, barray, lvalue, rvalue, len, lscalar, rscalar, /);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+static mp_float_t ndarray_contiguous_reduce_lanes(mp_float_t *lanes) {
+    // adds the partial sums pairwise
+    for(uint8_t width = NDARRAY_CONTIGUOUS_LANES / 2; width > 0; width /= 2) {
+        for(uint8_t j = 0; j < width; j++) {
+            lanes[j] += lanes[j + width];
+        }
+    }
+    return lanes[0];
+}
+
+mp_float_t ndarray_contiguous_sum(const mp_float_t *array, size_t len) {
+    mp_float_t lanes[NDARRAY_CONTIGUOUS_LANES] = { MICROPY_FLOAT_CONST(0.0) };
+    size_t i = 0;
+    for(; i + NDARRAY_CONTIGUOUS_LANES <= len; i += NDARRAY_CONTIGUOUS_LANES) {
+        for(uint8_t j = 0; j < NDARRAY_CONTIGUOUS_LANES; j++) {
+            lanes[j] += array[i + j];
+        }
+    }
+    for(uint8_t j = 0; i < len; i++, j++) {
+        lanes[j] += array[i];
+    }
+    return ndarray_contiguous_reduce_lanes(lanes);
+}
+
+mp_float_t ndarray_contiguous_squared_deviations(const mp_float_t *array, size_t len, mp_float_t mean) {
+    // returns the sum of the squared differences between the elements and the mean
+    mp_float_t lanes[NDARRAY_CONTIGUOUS_LANES] = { MICROPY_FLOAT_CONST(0.0) };
+    size_t i = 0;
+    for(; i + NDARRAY_CONTIGUOUS_LANES <= len; i += NDARRAY_CONTIGUOUS_LANES) {
+        for(uint8_t j = 0; j < NDARRAY_CONTIGUOUS_LANES; j++) {
+            mp_float_t deviation = array[i + j] - mean;
+            lanes[j] += deviation * deviation;
+        }
+    }
+    for(uint8_t j = 0; i < len; i++, j++) {
+        mp_float_t deviation = array[i] - mean;
+        lanes[j] += deviation * deviation;
+    }
+    return ndarray_contiguous_reduce_lanes(lanes);
+}
+
+mp_float_t ndarray_contiguous_dot(const mp_float_t *array1, const mp_float_t *array2, size_t len) {
+    mp_float_t lanes[NDARRAY_CONTIGUOUS_LANES] = { MICROPY_FLOAT_CONST(0.0) };
+    size_t i = 0;
+    for(; i + NDARRAY_CONTIGUOUS_LANES <= len; i += NDARRAY_CONTIGUOUS_LANES) {
+        for(uint8_t j = 0; j < NDARRAY_CONTIGUOUS_LANES; j++) {
+            lanes[j] += array1[i + j] * array2[i + j];
+        }
+    }
+    for(uint8_t j = 0; i < len; i++, j++) {
+        lanes[j] += array1[i] * array2[i];
+    }
+    return ndarray_contiguous_reduce_lanes(lanes);
+}
+
+void ndarray_contiguous_polyval(mp_float_t *restrict results, const mp_float_t *restrict x, size_t len, const mp_float_t *p, size_t plen) {
+    // Horner's scheme, with the loop over the elements inside the loop over the coefficients.
+    // Each element goes through the same operations as in poly_eval.
+    for(size_t i = 0; i < len; i++) {
+        results[i] = MICROPY_FLOAT_CONST(0.0);
+    }
+    for(size_t j = 0; j < plen; j++) {
+        mp_float_t coefficient = p[j];
+        for(size_t i = 0; i < len; i++) {
+            results[i] = results[i] * x[i] + coefficient;
+        }
+    }
+}
+
+#endif /* NDARRAY_HAS_CONTIGUOUS_KERNELS */
@@ -0,0 +1,30 @@
+/*
+ * Kernels of the float arrays, whose elements are contiguous in memory.
+ *
+ * The loops are plain indexed loops over mp_float_t pointers, so that the
+ * compiler can unroll and vectorise them. The sums are accumulated in
+ * NDARRAY_CONTIGUOUS_LANES independent partial sums, which are added pairwise
+ * at the end: the additions of a sum no longer depend on each other, and the
+ * rounding error grows more slowly than with a single accumulator.
+*/
+
+#ifndef _NDARRAY_CONTIGUOUS_
+#define _NDARRAY_CONTIGUOUS_
+
+#include "ulab.h"
+#include "ndarray.h"
+
+#if NDARRAY_HAS_CONTIGUOUS_KERNELS
+
+#define NDARRAY_CONTIGUOUS_LANES            (8)
+
+bool ndarray_contiguous_is_float(ndarray_obj_t *);
+mp_obj_t ndarray_contiguous_binary_op(mp_binary_op_t , ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *);
+mp_float_t ndarray_contiguous_sum(const mp_float_t *, size_t );
+mp_float_t ndarray_contiguous_squared_deviations(const mp_float_t *, size_t , mp_float_t );
+mp_float_t ndarray_contiguous_dot(const mp_float_t *, const mp_float_t *, size_t );
+void ndarray_contiguous_polyval(mp_float_t *, const mp_float_t *, size_t , const mp_float_t *, size_t );
+
+#endif /* NDARRAY_HAS_CONTIGUOUS_KERNELS */
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "../ulab.h"
 #include "../ulab_tools.h"
+#include "../ndarray_contiguous.h"
 #include "./carray/carray_tools.h"
 #include "numerical.h"
 
@@ -285,6 +286,22 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             // if there are too many degrees of freedom, there is no point in calculating anything
             return mp_obj_new_float(MICROPY_FLOAT_CONST(0.0));
         }
+        #if NDARRAY_HAS_CONTIGUOUS_KERNELS
+        if((ndarray->len > 0) && ndarray_contiguous_is_float(ndarray)) {
+            mp_float_t *farray = (mp_float_t *)ndarray->array;
+            mp_float_t sum = ndarray_contiguous_sum(farray, ndarray->len);
+            if(optype == NUMERICAL_SUM) {
+                return mp_obj_new_float(sum);
+            }
+            mp_float_t mean = sum / ndarray->len;
+            if(optype == NUMERICAL_MEAN) {
+                return mp_obj_new_float(mean);
+            }
+            // two passes instead of the running mean: the second pass is independent of the order
+            mp_float_t S = ndarray_contiguous_squared_deviations(farray, ndarray->len, mean);
+            return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(S / (ndarray->len - ddof)));
+        }
+        #endif
         mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
         mp_float_t M = MICROPY_FLOAT_CONST(0.0);
         mp_float_t m = MICROPY_FLOAT_CONST(0.0);
@@ -19,6 +19,7 @@
 #include "py/objarray.h"
 
 #include "../ulab.h"
+#include "../ndarray_contiguous.h"
 #include "linalg/linalg_tools.h"
 #include "../ulab_tools.h"
 #include "carray/carray_tools.h"
@@ -195,6 +196,14 @@ mp_obj_t poly_polyval(mp_obj_t o_p, mp_obj_t o_x) {
         ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
         mp_float_t *array = (mp_float_t *)ndarray->array;
 
+        #if NDARRAY_HAS_CONTIGUOUS_KERNELS
+        if(ndarray_contiguous_is_float(source)) {
+            ndarray_contiguous_polyval(array, (mp_float_t *)sarray, source->len, p, plen);
+            m_del(mp_float_t, p, plen);
+            return MP_OBJ_FROM_PTR(ndarray);
+        }
+        #endif
+
         mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
 
         // TODO: these loops are really nothing, but the re-impplementation of
@@ -20,6 +20,7 @@
 
 #include "../ulab.h"
 #include "../ulab_tools.h"
+#include "../ndarray_contiguous.h"
 #include "carray/carray_tools.h"
 #include "numerical.h"
 #include "transform.h"
@@ -385,6 +386,21 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
     ndarray_obj_t *results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
     mp_float_t *rarray = (mp_float_t *)results->array;
 
+    #if NDARRAY_HAS_CONTIGUOUS_KERNELS
+    size_t len = m1->shape[ULAB_MAX_DIMS - 1];
+    if((m1->dtype == NDARRAY_FLOAT) && (m2->dtype == NDARRAY_FLOAT) &&
+        ((len < 2) || ((m1->strides[ULAB_MAX_DIMS - 1] == m1->itemsize) &&
+        (m2->strides[ULAB_MAX_DIMS - m2->ndim] == m2->itemsize)))) {
+        // the rows of m1 and the columns of m2 are contiguous
+        for(size_t i=0; i < shape1; i++) {
+            for(size_t j=0; j < shape2; j++) {
+                mp_float_t *row = (mp_float_t *)(array1 + i * m1->strides[ULAB_MAX_DIMS - m1->ndim]);
+                mp_float_t *column = (mp_float_t *)(array2 + j * m2->strides[ULAB_MAX_DIMS - 1]);
+                *rarray++ = ndarray_contiguous_dot(row, column, len);
+            }
+        }
+    } else {
+    #endif
     for(size_t i=0; i < shape1; i++) { // rows of m1
         for(size_t j=0; j < shape2; j++) { // columns of m2
             mp_float_t dot = 0.0;
@@ -402,6 +418,9 @@ mp_obj_t transform_dot(mp_obj_t _m1, mp_obj_t _m2) {
         array1 += m1->strides[ULAB_MAX_DIMS - m1->ndim];
         array2 = m2->array;
     }
+    #if NDARRAY_HAS_CONTIGUOUS_KERNELS
+    }
+    #endif
     if((m1->ndim * m2->ndim) == 1) { // return a scalar, if product of two vectors
         return mp_obj_new_float(*(--rarray));
     } else {
@@ -11,6 +11,8 @@
 
 #define NDARRAY_BINARY_USES_FUN_POINTER     (1)
 
+#define NDARRAY_HAS_CONTIGUOUS_KERNELS      (1)
+
 #define NDARRAY_HAS_BYTESWAP            (0)
 
 #define NDARRAY_HAS_COPY                (0)
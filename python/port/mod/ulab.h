@@ -93,6 +93,14 @@
 #define NDARRAY_BINARY_USES_FUN_POINTER     (0)
 #endif
 
+// Float arrays, whose elements are contiguous in memory, can be processed by
+// dedicated loops that the compiler vectorises, instead of the generic loops
+// over strides and dtypes. This costs around 2 kB.
+
+#ifndef NDARRAY_HAS_CONTIGUOUS_KERNELS
+#define NDARRAY_HAS_CONTIGUOUS_KERNELS      (0)
+#endif
+
 #ifndef NDARRAY_HAS_BINARY_OP_ADD
 #define NDARRAY_HAS_BINARY_OP_ADD           (1)
 #endif
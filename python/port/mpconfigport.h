@@ -125,7 +125,12 @@
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
 
-#define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+/* Reading the clock after each jump of the VM slows down Python execution
+ * quite a lot, so the jumps are only counted down here. */
+#define MICROPY_VM_HOOK_LOOP                       \
+  if (--micropython_port_vm_hook_countdown <= 0) { \
+    micropython_port_vm_hook_tick(code_state, ip); \
+  }
 
 typedef intptr_t mp_int_t;    // must be pointer size
 typedef uintptr_t mp_uint_t;  // must be pointer size
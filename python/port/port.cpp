@@ -7,6 +7,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "profiler.h"
+
 /* py/parsenum.h is a C header which uses C keyword restrict.
  * It does not exist in C++ so we define it here in order to be able to include
  * py/parsenum.h header. */
@@ -54,6 +56,11 @@ bool MicroPython::ExecutionEnvironment::runCode(const char *str) {
    * for the exception handling (because of print). */
   mp_hal_set_interrupt_char((int)Ion::Keyboard::Key::Back);
 
+  Profiler *profiler = Profiler::SharedProfiler();
+  if (m_profiling) {
+    profiler->start();
+  }
+
   bool runSucceeded = true;
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
@@ -70,6 +77,11 @@ bool MicroPython::ExecutionEnvironment::runCode(const char *str) {
     HandleException(&nlr);
   }
 
+  if (m_profiling) {
+    profiler->stop();
+    profiler->printHistogram();
+  }
+
   // Disable the user interruption
   mp_hal_set_interrupt_char(-1);
 
@@ -160,7 +172,9 @@ void MicroPython::init(void *heapStart, void *heapEnd) {
    *   must be kept on the heap
    * - to check if the maximal recursion depth has been reached.
    * Current stack pointer could go backward after initialization. A stack start
-   * pointer defined in main is therefore used. */
+   * pointer defined in main is therefore used.
+   * The state of MicroPython is global, so Python only runs on the main thread,
+   * the only one with a stack start (see Shared::Session). */
   void *stackTopAddress = Ion::stackStart();
 
 #if MP_PORT_USE_STACK_SYMBOLS
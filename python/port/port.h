@@ -19,10 +19,13 @@ class ScriptProvider {
 
 class ExecutionEnvironment {
  public:
-  ExecutionEnvironment() {}
+  ExecutionEnvironment() : m_profiling(false) {}
   ~ExecutionEnvironment();
   static ExecutionEnvironment* currentExecutionEnvironment();
   bool runCode(const char*);
+  /* When profiling, the code is run by the sampling profiler, and the lines
+   * where it spent the most time are printed after it. */
+  void setProfiling(bool profiling) { m_profiling = profiling; }
   static void HandleException(nlr_buf_t* nlr_buf,
                               MicroPython::ExecutionEnvironment* env = nullptr);
   static void HandleExceptionSilently();
@@ -40,6 +43,9 @@ class ExecutionEnvironment {
   virtual void printText(const char* text, size_t length) {}
   virtual void refreshPrintOutput() {}
   void interrupt();
+
+ private:
+  bool m_profiling;
 };
 
 void init(void* heapStart, void* heapEnd);
@@ -0,0 +1,116 @@
+#include "profiler.h"
+
+#include <assert.h>
+#include <ion/timing.h>
+
+extern "C" {
+#include "py/bc.h"
+#include "py/mpprint.h"
+#include "py/objfun.h"
+}
+
+namespace MicroPython {
+
+Profiler* Profiler::SharedProfiler() {
+  static Profiler sProfiler;
+  return &sProfiler;
+}
+
+void Profiler::start() {
+  m_lastSampleTime = Ion::Timing::millis();
+  m_numberOfLines = 0;
+  m_numberOfMilliseconds = 0;
+  m_isRunning = true;
+}
+
+void Profiler::recordSample(const _mp_code_state_t* codeState,
+                            const uint8_t* ip, uint64_t time) {
+  assert(m_isRunning);
+  /* The time since the previous sample was mostly spent on the current line.
+   * The ticks within the same millisecond as the previous sample are not worth
+   * decoding the line. */
+  assert(time >= m_lastSampleTime);
+  uint32_t milliseconds = time - m_lastSampleTime;
+  if (milliseconds == 0) {
+    return;
+  }
+  m_lastSampleTime = time;
+  /* The source line is decoded from the prelude of the bytecode, as for the
+   * traceback of an exception in mp_execute_bytecode. */
+  const byte* prelude = codeState->fun_bc->bytecode;
+  MP_BC_PRELUDE_SIG_DECODE(prelude);
+  MP_BC_PRELUDE_SIZE_DECODE(prelude);
+  const byte* bytecodeStart = prelude + n_info + n_cell;
+#if !MICROPY_PERSISTENT_CODE
+  bytecodeStart = static_cast<const byte*>(
+      MP_ALIGN(bytecodeStart, sizeof(mp_uint_t)));
+#endif
+#if MICROPY_PERSISTENT_CODE
+  qstr sourceFile = prelude[2] | (prelude[3] << 8);
+  const byte* lineInfo = prelude + 4;
+#else
+  const byte* lineInfo = mp_decode_uint_skip(prelude);
+  qstr sourceFile = mp_decode_uint_value(lineInfo);
+  lineInfo = mp_decode_uint_skip(lineInfo);
+#endif
+  int line = mp_bytecode_get_source_line(lineInfo, ip - bytecodeStart);
+
+  m_numberOfMilliseconds += milliseconds;
+  for (int i = 0; i < m_numberOfLines; i++) {
+    if (m_lines[i].line == line && m_lines[i].sourceFile == sourceFile) {
+      m_lines[i].numberOfMilliseconds += milliseconds;
+      return;
+    }
+  }
+  // The time of the lines beyond the table only counts in the total
+  if (m_numberOfLines < k_maxNumberOfLines) {
+    m_lines[m_numberOfLines++] = {sourceFile, static_cast<uint16_t>(line),
+                                  milliseconds};
+  }
+}
+
+int Profiler::numberOfMillisecondsOfLine(qstr sourceFile, int line) const {
+  for (int i = 0; i < m_numberOfLines; i++) {
+    if (m_lines[i].line == line && m_lines[i].sourceFile == sourceFile) {
+      return m_lines[i].numberOfMilliseconds;
+    }
+  }
+  return 0;
+}
+
+void Profiler::printHistogram() {
+  if (m_numberOfMilliseconds == 0) {
+    mp_print_str(&mp_plat_print, "Profile: the script ran too briefly\n");
+    return;
+  }
+  // Sort the lines by decreasing time
+  for (int i = 1; i < m_numberOfLines; i++) {
+    Line l = m_lines[i];
+    int j = i;
+    while (j > 0 && m_lines[j - 1].numberOfMilliseconds < l.numberOfMilliseconds) {
+      m_lines[j] = m_lines[j - 1];
+      j--;
+    }
+    m_lines[j] = l;
+  }
+  mp_printf(&mp_plat_print, "Profile of %d ms\n", m_numberOfMilliseconds);
+  char bar[k_maxBarLength + 1];
+  int numberOfPrintedLines = m_numberOfLines < k_maxNumberOfPrintedLines
+                                 ? m_numberOfLines
+                                 : k_maxNumberOfPrintedLines;
+  for (int i = 0; i < numberOfPrintedLines; i++) {
+    int milliseconds = m_lines[i].numberOfMilliseconds;
+    int barLength =
+        (2 * k_maxBarLength * milliseconds + m_numberOfMilliseconds) /
+        (2 * m_numberOfMilliseconds);
+    for (int k = 0; k < barLength; k++) {
+      bar[k] = '#';
+    }
+    bar[barLength] = 0;
+    mp_printf(&mp_plat_print, "  %q, line %d: %d%% %s\n",
+              m_lines[i].sourceFile, m_lines[i].line,
+              100 * milliseconds / m_numberOfMilliseconds, bar);
+  }
+}
+
+}  // namespace MicroPython
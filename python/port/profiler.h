@@ -0,0 +1,60 @@
+#ifndef PYTHON_PORT_PROFILER_H
+#define PYTHON_PORT_PROFILER_H
+
+extern "C" {
+#include <py/qstr.h>
+#include <stdint.h>
+}
+
+struct _mp_code_state_t;
+
+namespace MicroPython {
+
+/* Sampling profiler of the Python scripts. A sample is recorded at each tick
+ * of the VM hook, which happens after a jump. The line of a sample is
+ * therefore the head of the innermost loop being run, or the target of the
+ * last branch. As the number of jumps between ticks varies, each sample is
+ * weighted by the milliseconds elapsed since the previous one, so that the
+ * histogram measures time rather than jumps. */
+
+class Profiler {
+ public:
+  Profiler()
+      : m_lastSampleTime(0),
+        m_numberOfLines(0),
+        m_numberOfMilliseconds(0),
+        m_isRunning(false) {}
+  static Profiler* SharedProfiler();
+
+  void start();
+  void stop() { m_isRunning = false; }
+  bool isRunning() const { return m_isRunning; }
+  void recordSample(const _mp_code_state_t* codeState, const uint8_t* ip,
+                    uint64_t time);
+  // Print the lines where the most time was spent, with mp_printf
+  void printHistogram();
+
+  int numberOfMilliseconds() const { return m_numberOfMilliseconds; }
+  int numberOfMillisecondsOfLine(qstr sourceFile, int line) const;
+
+ private:
+  constexpr static int k_maxNumberOfLines = 32;
+  constexpr static int k_maxNumberOfPrintedLines = 8;
+  constexpr static int k_maxBarLength = 10;
+
+  struct Line {
+    qstr sourceFile;
+    uint16_t line;
+    uint32_t numberOfMilliseconds;
+  };
+
+  uint64_t m_lastSampleTime;
+  Line m_lines[k_maxNumberOfLines];
+  int m_numberOfLines;
+  int m_numberOfMilliseconds;
+  bool m_isRunning;
+};
+
+}  // namespace MicroPython
+
+#endif
@@ -64,4 +64,54 @@ QUIZ_CASE(python_numpy) {
   assert_command_execution_succeeds(env, "np.arange(0,0)", "array([])\n");
   assert_command_execution_fails(env, "np.arange(0,3,0)");
   assert_command_execution_fails(env, "np.concatenate((0,0))");
+
+  // Contiguous float arrays and strided views of the same values
+  assert_command_execution_succeeds(env, "c = np.linspace(0, 9, 10)");
+  assert_command_execution_succeeds(env, "c[:5] + c[5:]",
+                                    "array([5.0, 7.0, 9.0, 11.0, 13.0])\n");
+  assert_command_execution_succeeds(env, "c[::2] - c[1::2]",
+                                    "array([-1.0, -1.0, -1.0, -1.0, -1.0])\n");
+  assert_command_execution_succeeds(env, "c[:3] * 2",
+                                    "array([0.0, 2.0, 4.0])\n");
+  assert_command_execution_succeeds(env, "c[1:5:3] / 4",
+                                    "array([0.25, 1.0])\n");
+  assert_command_execution_succeeds(env, "c[1:3] / c[2:4]",
+                                    "array([0.5, 0.6666666666666666])\n");
+  assert_command_execution_succeeds(env, "np.sum(c)", "45.0\n");
+  assert_command_execution_succeeds(env, "np.sum(c[::3])", "18.0\n");
+  assert_command_execution_succeeds(env, "np.mean(c)", "4.5\n");
+  assert_command_execution_succeeds(env, "np.std(a)", "1.118033988749895\n");
+  assert_command_execution_succeeds(env, "np.dot(c, c)", "285.0\n");
+  assert_command_execution_succeeds(env, "np.dot(a, np.array([1, 1]))",
+                                    "array([3.0, 7.0])\n");
+  assert_command_execution_succeeds(
+      env, "np.dot(a, a)", "array([[7.0, 10.0],\n       [15.0, 22.0]])\n");
+  assert_command_execution_succeeds(env, "np.polyval([1, 0, -1], c[:3])",
+                                    "array([-1.0, 0.0, 3.0])\n");
+}
+
+QUIZ_CASE(python_numpy_contiguous_kernels) {
+  /* Operations on contiguous arrays go through dedicated loops, which must
+   * give the results of the generic loops run on strided views. The arrays
+   * have more elements than the partial sums of the loops, but not a multiple
+   * of them. */
+  assert_script_execution_succeeds(
+      "import numpy as np\n"
+      "x = np.linspace(0.5, 2.0, 406)\n"
+      "a = x[::2]\n"
+      "b = x[1::2]\n"
+      "ca = np.array(a.tolist())\n"
+      "cb = np.array(b.tolist())\n"
+      "assert ((ca + cb) * ca - cb / ca).tolist() == "
+      "((a + b) * a - b / a).tolist()\n"
+      "assert (ca * 3 - 1).tolist() == (a * 3 - 1).tolist()\n"
+      "p = [1.0, -2.0, 3.0, -4.0]\n"
+      "assert np.polyval(p, ca).tolist() == np.polyval(p, a).tolist()\n"
+      "def close(u, v):\n"
+      "  return abs(u - v) <= 1e-9 * (1 + abs(v))\n"
+      "assert close(np.sum(ca), np.sum(a))\n"
+      "assert close(np.mean(cb), np.mean(b))\n"
+      "assert close(np.std(ca), np.std(a))\n"
+      "assert close(np.dot(ca, cb), np.dot(a, b))\n"
+      "assert close(np.sum(ca), sum(a.tolist()))\n");
 }
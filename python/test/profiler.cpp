@@ -0,0 +1,33 @@
+#include <ion/timing.h>
+#include <python/port/profiler.h>
+#include <quiz.h>
+#include <string.h>
+
+#include "execution_environment.h"
+
+QUIZ_CASE(python_profiler) {
+  MicroPython::Profiler* profiler = MicroPython::Profiler::SharedProfiler();
+  TestExecutionEnvironment env = init_environement();
+  /* The loop lasts long enough to be sampled several times, and the profile
+   * does not account for more time than the script took. */
+  env.setProfiling(true);
+  uint64_t startTime = Ion::Timing::millis();
+  quiz_assert(env.runCode(
+      "exec(\"s = 0\\nfor i in range(300000):\\n  s += i * i\\n\")"));
+  uint64_t elapsedTime = Ion::Timing::millis() - startTime;
+  env.setProfiling(false);
+  quiz_assert(!profiler->isRunning());
+  quiz_assert(profiler->numberOfMilliseconds() > 0);
+  quiz_assert(static_cast<uint64_t>(profiler->numberOfMilliseconds()) <=
+              elapsedTime);
+  const char* header = "Profile of ";
+  quiz_assert(strncmp(env.lastPrintedText(), header, strlen(header)) == 0);
+
+  // Nothing is sampled when profiling is off
+  profiler->start();
+  profiler->stop();
+  assert_command_execution_succeeds(
+      env, "exec(\"for i in range(300000):\\n  pass\\n\")");
+  quiz_assert(profiler->numberOfMilliseconds() == 0);
+  deinit_environment();
+}